@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ServerInfoBeaconClient.h"
+
+#include "ServerInfoBeaconHostObject.h"
+#include "TimerManager.h"
+
+/**
+ * Starts connecting to the server's beacon host.
+ *
+ * @param InSessionId The ID of the session being queried.
+ * @param ConnectString The address and beacon port of the server.
+ * @return True if the connection attempt was started.
+ */
+bool AServerInfoBeaconClient::QueryServerInfo(const FString& InSessionId, const FString& ConnectString)
+{
+	SessionId = InSessionId;
+
+	FURL Url(nullptr, *ConnectString, TRAVEL_Absolute);
+	if (!InitClient(Url))
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("AServerInfoBeaconClient::QueryServerInfo - Could not connect to %s for session %s."),
+			*ConnectString, *SessionId
+		);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Sends the info request once the beacon connection is up.
+ */
+void AServerInfoBeaconClient::OnConnected()
+{
+	Super::OnConnected();
+
+	RequestSentTime = FPlatformTime::Seconds();
+	ServerRequestInfo();
+}
+
+/**
+ * Reports that the server could not be reached and tears the beacon down.
+ */
+void AServerInfoBeaconClient::OnFailure()
+{
+	UE_LOG(LogTemp, Verbose,
+		TEXT("AServerInfoBeaconClient::OnFailure - Could not reach the beacon of session %s."), *SessionId
+	);
+	Super::OnFailure();
+
+	OnServerInfoFailed.ExecuteIfBound(SessionId);
+	DestroyBeaconNextTick();
+}
+
+/**
+ * Answers with the server's live state.
+ */
+void AServerInfoBeaconClient::ServerRequestInfo_Implementation()
+{
+	const AServerInfoBeaconHostObject* HostObject = Cast<AServerInfoBeaconHostObject>(GetBeaconOwner());
+	if (HostObject == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AServerInfoBeaconClient::ServerRequestInfo - No host object to answer with."));
+		return;
+	}
+	ClientReceiveServerInfo(HostObject->GetServerInfo());
+}
+
+bool AServerInfoBeaconClient::ServerRequestInfo_Validate()
+{
+	return true;  // This will allow the RPC to be called
+}
+
+/**
+ * Reports the server's live state and the round trip time of the request, then tears the beacon down.
+ *
+ * @param ServerInfo The server's live state.
+ */
+void AServerInfoBeaconClient::ClientReceiveServerInfo_Implementation(const FServerBeaconInfo& ServerInfo)
+{
+	const int32 PingInMs = FMath::RoundToInt((FPlatformTime::Seconds() - RequestSentTime) * 1000.0);
+	UE_LOG(LogTemp, Verbose,
+		TEXT("AServerInfoBeaconClient::ClientReceiveServerInfo - Session %s has %i/%i players on level %i, %i ms."),
+		*SessionId, ServerInfo.CurrentPlayers, ServerInfo.MaxPlayers, ServerInfo.Level, PingInMs
+	);
+
+	OnServerInfoReceived.ExecuteIfBound(SessionId, ServerInfo, PingInMs);
+	DestroyBeaconNextTick();
+}
+
+/**
+ * Destroys the beacon on the next tick, so the net driver is not torn down while it is still dispatching to it.
+ */
+void AServerInfoBeaconClient::DestroyBeaconNextTick()
+{
+	OnServerInfoReceived.Unbind();
+	OnServerInfoFailed.Unbind();
+	GetWorldTimerManager().SetTimerForNextTick(this, &AServerInfoBeaconClient::DestroyBeacon);
+}
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineBeaconClient.h"
+#include "ServerInfoBeaconClient.generated.h"
+
+/**
+ * @struct FServerBeaconInfo
+ * @brief The live state of a server, as reported by its server info beacon.
+ */
+USTRUCT()
+struct FServerBeaconInfo
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The name the host gave the server. Empty if the host did not name it.
+	 */
+	UPROPERTY()
+	FString ServerName;
+
+	/**
+	 * @brief The number of players currently connected to the server.
+	 */
+	UPROPERTY()
+	int32 CurrentPlayers = 0;
+
+	/**
+	 * @brief The number of players the server was hosted for.
+	 */
+	UPROPERTY()
+	int32 MaxPlayers = 0;
+
+	/**
+	 * @brief The level the server is playing, or 0 while it is in the lobby.
+	 */
+	UPROPERTY()
+	int32 Level = 0;
+};
+
+/**
+ * @brief Executed when a server info beacon got its answer.
+ *
+ * @param SessionId The ID of the session that was queried.
+ * @param ServerInfo The server's live state.
+ * @param PingInMs The round trip time of the query in milliseconds.
+ */
+DECLARE_DELEGATE_ThreeParams(FOnServerInfoReceived, const FString&, const FServerBeaconInfo&, int32);
+
+/**
+ * @brief Executed when a server info beacon could not reach its server.
+ *
+ * @param SessionId The ID of the session that was queried.
+ */
+DECLARE_DELEGATE_OneParam(FOnServerInfoFailed, const FString&);
+
+/**
+ * @class AServerInfoBeaconClient
+ * @brief A one-shot beacon connection that asks a server for its live state.
+ *
+ * Beacons connect through their own net driver and port, next to the game's, without travelling or logging in, so
+ * the server browser can ask a listed server how many players it has, which level it is on and how far away it is
+ * without a new session search. The client connects, sends ServerRequestInfo, receives ClientReceiveServerInfo and
+ * then destroys itself; the round trip of that request is reported as the ping.
+ *
+ * @see AServerInfoBeaconHostObject
+ */
+UCLASS(Transient, NotPlaceable)
+class SIDESCROLLER_API AServerInfoBeaconClient : public AOnlineBeaconClient
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Connects to the server's beacon host and queries its state.
+	 *
+	 * @param InSessionId The ID of the session being queried, passed back through the delegates.
+	 * @param ConnectString The address and beacon port of the server.
+	 * @return True if the connection attempt was started.
+	 */
+	bool QueryServerInfo(const FString& InSessionId, const FString& ConnectString);
+
+	/**
+	 * @brief Executed on the querying client once the server answered.
+	 */
+	FOnServerInfoReceived OnServerInfoReceived;
+
+	/**
+	 * @brief Executed on the querying client if the server could not be reached.
+	 */
+	FOnServerInfoFailed OnServerInfoFailed;
+
+	/**
+	 * @brief Sends the info request as soon as the beacon connection is up.
+	 */
+	virtual void OnConnected() override;
+
+	/**
+	 * @brief Reports the failure and tears the beacon down.
+	 */
+	virtual void OnFailure() override;
+
+protected:
+	/**
+	 * @brief Asks the server for its live state.
+	 *
+	 * Runs on the server, which answers through ClientReceiveServerInfo.
+	 */
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerRequestInfo();
+
+	/**
+	 * @brief Receives the server's live state and reports it together with the round trip time.
+	 *
+	 * @param ServerInfo The server's live state.
+	 */
+	UFUNCTION(Client, Reliable)
+	void ClientReceiveServerInfo(const FServerBeaconInfo& ServerInfo);
+
+private:
+	/**
+	 * @brief Destroys the beacon on the next tick, outside of the net driver call that triggered it.
+	 */
+	void DestroyBeaconNextTick();
+
+	/**
+	 * @brief The ID of the session being queried.
+	 */
+	FString SessionId;
+
+	/**
+	 * @brief FPlatformTime::Seconds when ServerRequestInfo was sent.
+	 */
+	double RequestSentTime = 0.0;
+};
@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ServerInfoBeaconHostObject.h"
+
+#include "GameFramework/GameStateBase.h"
+#include "SideScroller/GameStates/SideScrollerGameState.h"
+#include "SideScroller/SideScrollerGameInstance.h"
+
+/**
+ * Sets AServerInfoBeaconClient as the beacon client class and names the beacon type after it.
+ */
+AServerInfoBeaconHostObject::AServerInfoBeaconHostObject()
+{
+	ClientBeaconActorClass = AServerInfoBeaconClient::StaticClass();
+	BeaconTypeName = ClientBeaconActorClass->GetName();
+}
+
+/**
+ * Gathers the server's name, player counts and current level.
+ *
+ * @return The server's live state.
+ */
+FServerBeaconInfo AServerInfoBeaconHostObject::GetServerInfo() const
+{
+	FServerBeaconInfo ServerInfo;
+
+	const UWorld* World = GetWorld();
+	if (World == nullptr) return ServerInfo;
+
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		ServerInfo.CurrentPlayers = GameState->PlayerArray.Num();
+		if (const ASideScrollerGameState* SideScrollerGameState = Cast<ASideScrollerGameState>(GameState))
+		{
+			ServerInfo.Level = SideScrollerGameState->GetCurrentLevel();
+		}
+	}
+
+	if (const USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(World->GetGameInstance()))
+	{
+		ServerInfo.ServerName = GameInstance->GetServerName();
+		ServerInfo.MaxPlayers = GameInstance->GetNumPlayersToStartGame();
+	}
+	return ServerInfo;
+}
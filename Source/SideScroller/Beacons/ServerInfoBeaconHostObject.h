@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineBeaconHostObject.h"
+#include "ServerInfoBeaconClient.h"
+#include "ServerInfoBeaconHostObject.generated.h"
+
+/**
+ * @class AServerInfoBeaconHostObject
+ * @brief Answers server info beacons on a listen or dedicated server.
+ *
+ * Registered with the AOnlineBeaconHost the game mode opens on the beacon port. Every AServerInfoBeaconClient that
+ * connects gets a server side counterpart spawned by this object, which answers its request with GetServerInfo.
+ *
+ * @see AServerInfoBeaconClient, ASideScrollerGameModeBase
+ */
+UCLASS(Transient, NotPlaceable)
+class SIDESCROLLER_API AServerInfoBeaconHostObject : public AOnlineBeaconHostObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Sets AServerInfoBeaconClient as the beacon client class this object answers.
+	 */
+	AServerInfoBeaconHostObject();
+
+	/**
+	 * @brief Gathers the live state of the server: its name, player counts and current level.
+	 *
+	 * @return The server's live state.
+	 */
+	FServerBeaconInfo GetServerInfo() const;
+};
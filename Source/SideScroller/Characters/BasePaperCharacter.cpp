@@ -7,12 +7,15 @@
 #include "Enemies/EnemyCollisionPaperCharacter.h"
 #include "PaperFlipbookComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 
 #include "Players/PC_PlayerFox.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Subsystems/CosmeticCueSubsystem.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
-ABasePaperCharacter::ABasePaperCharacter()
+ABasePaperCharacter::ABasePaperCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 	Health = DefaultHealth;
@@ -27,6 +30,11 @@ ABasePaperCharacter::ABasePaperCharacter()
 	this->GetCharacterMovement()->SetIsReplicated(true);
 	this->GetSprite()->SetIsReplicated(true);
 	this->SetReplicates(true);
+
+	// Enemies walk and hop all the time, but a few updates a second hold them once they stand still.
+	this->NetUpdateFrequency = 30.f;
+	this->MinNetUpdateFrequency = 5.f;
+	this->NetPriority = 2.f;
 }
 
 void ABasePaperCharacter::BeginPlay()
@@ -72,7 +80,21 @@ void ABasePaperCharacter::AddHealth(const float HealthValue)
 
 void ABasePaperCharacter::SetHealth(const float HealthValue)
 {
+	if (this->Health == HealthValue) return;
+
 	this->Health = HealthValue;
+	// the replication graph backs idle actors off to their minimum rate, so tell it the character changed
+	if (this->HasAuthority()) this->ForceNetUpdate();
+	this->OnHealthChanged();
+}
+
+void ABasePaperCharacter::OnHealthChanged()
+{
+}
+
+void ABasePaperCharacter::OnRep_Health()
+{
+	this->OnHealthChanged();
 }
 
 float ABasePaperCharacter::GetDefaultHealth() const
@@ -99,6 +121,7 @@ USceneComponent* ABasePaperCharacter::GetProjectileSpawnPoint() const
 void ABasePaperCharacter::DoDeath_Implementation()
 {
 	this->bIsDead = true;
+	if (this->HasAuthority()) this->ForceNetUpdate();
 	UE_LOG(LogTemp, Display, TEXT("%s's health depleted!"), *this->GetName());
 	this->SetActorEnableCollision(false);
 	this->GetSprite()->SetLooping(false);
@@ -111,10 +134,11 @@ void ABasePaperCharacter::DoDeath_Implementation()
 		false
 	);
 
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->DeathSound,
 		this->GetSprite(),
-		TEXT("BasePaperCharacterDeath")
+		EAudioEventCategory::Character
 	);
 }
 
@@ -141,21 +165,34 @@ void ABasePaperCharacter::PushHurtCharacter(AActor* DamageCauser)
 /**
  * @param None
  *
- * PlayHurtSound_Implementation is a method implemented in the ABasePaperCharacter class that is used to play a pain
- * sound when the character is hurt.
- 
- * The method uses the UGameplayStatics::SpawnSoundAttached function to spawn a sound attached to the character's sprite.
- * The pain sound to be played is specified by the PainSound member
- * variable of the character.
+ * PlayHurtSound is a method implemented in the ABasePaperCharacter class that is used to play a pain sound when the
+ * character is hurt. It sends a Hurt cue to the players near the character.
  *
  * @return None
  */
-void ABasePaperCharacter::PlayHurtSound_Implementation()
+void ABasePaperCharacter::PlayHurtSound()
+{
+	UCosmeticCueSubsystem::SendCue(this, ECosmeticCue::Hurt);
+}
+
+/**
+ * Plays the pain sound of a Hurt cue.
+ *
+ * The method plays the sound attached to the character's sprite on a pooled voice of the UAudioPoolSubsystem.
+ * The pain sound to be played is specified by the PainSound member variable of the character.
+ *
+ * @param Cue The cue to play.
+ * @param Location Where the cue happened on the server.
+ */
+void ABasePaperCharacter::PlayCosmeticCue(const ECosmeticCue Cue, const FVector& Location)
 {
-	UGameplayStatics::SpawnSoundAttached(
+	if (Cue != ECosmeticCue::Hurt) return;
+
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->PainSound,
 		this->GetSprite(),
-		TEXT("BasePaperCharacterPain")
+		EAudioEventCategory::Character
 	);
 }
 
@@ -502,8 +539,33 @@ void ABasePaperCharacter::DestroyActor()
 		return;
 	}
 
+	// keep level actors around so the level can be reset in place
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>();
+		LevelReset != nullptr && LevelReset->ReleaseToPool(this)
+	) {
+		UE_LOG(LogTemp, Display, TEXT("Pooling, not destroying, %s!"), *this->GetName());
+		return;
+	}
+
 	UE_LOG(LogTemp, Display, TEXT("Destroying %s!"), *this->GetName());
 	this->Destroy();
 	GetWorld()->GetTimerManager().ClearTimer(this->DeathTimerHandle);
 	GetWorld()->GetTimerManager().ClearTimer(this->HurtTimerHandle);
 }
+
+/**
+ * @brief Brings the character back to life after DoDeath.
+ */
+void ABasePaperCharacter::Revive()
+{
+	GetWorld()->GetTimerManager().ClearTimer(this->DeathTimerHandle);
+	GetWorld()->GetTimerManager().ClearTimer(this->HurtTimerHandle);
+
+	this->bIsDead = false;
+	this->SetHealth(this->DefaultHealth);
+	this->SetActorEnableCollision(true);
+	this->GetSprite()->SetLooping(true);
+	this->GetSprite()->SetFlipbook(IdleAnimation);
+	this->GetSprite()->Play();
+	this->GetCharacterMovement()->StopMovementImmediately();
+}
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "PaperCharacter.h"
 #include "PaperFlipbook.h"
+#include "SideScroller/Interfaces/CosmeticCueInterface.h"
 #include "SideScroller/Projectiles/BaseProjectile.h"
 #include "BasePaperCharacter.generated.h"
 
@@ -20,7 +21,7 @@ class APC_PlayerFox;
  *  dealing and taking damage, shooting projectiles, and playing animations.
  */
 UCLASS()
-class SIDESCROLLER_API ABasePaperCharacter : public APaperCharacter
+class SIDESCROLLER_API ABasePaperCharacter : public APaperCharacter, public ICosmeticCueInterface
 {
 	GENERATED_BODY()
 
@@ -83,8 +84,10 @@ public:
 	/**
 	 * Constructor for the ABasePaperCharacter class.
 	 * Initializes the character's default properties and sets up replication.
+	 *
+	 * @param ObjectInitializer Lets subclasses replace default subobjects, like the character movement component.
 	 */
-	ABasePaperCharacter();
+	ABasePaperCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	/**
 	 * \brief Called when the game starts or when spawned.
@@ -194,19 +197,26 @@ public:
 	void PushHurtCharacter(AActor* DamageCauser);
 
 	/**
-	 * @brief Plays the hurt sound.
+	 * @brief Plays the hurt sound for every player near the character.
 	 *
-	 * This method is a BlueprintCallable, NetMulticast, and Reliable function
-	 * which means it can be called from Blueprints, executed on all clients
-	 * and guaranteed to be executed in the correct order.
+	 * Sends a Hurt cue through the UCosmeticCueSubsystem, so the sound costs a few bytes in an unreliable batch
+	 * instead of a reliable multicast. Only does something on the server.
 	 *
 	 * @param None.
 	 *
 	 * @return None.
 	 */
-	UFUNCTION(BlueprintCallable, NetMulticast, Reliable)
+	UFUNCTION(BlueprintCallable)
 	void PlayHurtSound();
 
+	/**
+	 * @brief Plays the pain sound of a Hurt cue.
+	 *
+	 * @param Cue The cue to play.
+	 * @param Location Where the cue happened on the server.
+	 */
+	virtual void PlayCosmeticCue(ECosmeticCue Cue, const FVector& Location) override;
+
 	/**
 	 * Performs a hurt action on the character.
 	 *
@@ -319,6 +329,9 @@ public:
 	/**
 	 * Sets the health value of the character.
 	 *
+	 * On the server a change forces a net update, so the replication graph sends it right away even if the character
+	 * has been idle long enough to be backed off to its MinNetUpdateFrequency.
+	 *
 	 * @param Health The new health value to set.
 	 */
 	UFUNCTION(BlueprintCallable)
@@ -362,7 +375,8 @@ public:
 	/**
 	 * Destroys the actor.
 	 *
-	 * If the actor is a PlayFox, it cleans up instead of destroying it to allow players to spectate.
+	 * If the actor is a PlayFox, it cleans up instead of destroying it to allow players to spectate. Actors that are
+	 * registered with the ULevelResetSubsystem are released to its pool instead of being destroyed.
 	 *
 	 * @param None
 	 * @return None
@@ -412,7 +426,8 @@ private:
 	 anywhere but cannot be modified directly.
 	 
 	 The Health variable is replicated, which means its value is duplicated across all connected clients in a
-	 multiplayer game.
+	 multiplayer game. Clients are told about the change through OnRep_Health, the server through SetHealth; both
+	 call OnHealthChanged.
 	 
 	 \code{.cpp}
 	 float Health = 0;
@@ -421,7 +436,7 @@ private:
 	 \remark
 	 The initial value of Health is set to 0.
 	 */
-	UPROPERTY(VisibleAnywhere, replicated)
+	UPROPERTY(VisibleAnywhere, ReplicatedUsing=OnRep_Health)
 	float Health = 0;
 
 	/**
@@ -559,6 +574,22 @@ protected:
 	UPROPERTY(EditAnywhere)
 	float DefaultHealth = 100.0;
 
+	/**
+	 * @brief Brings the character back to life.
+	 *
+	 * Undoes DoDeath: restores the default health, clears the dead flag and the death and hurt timers, turns
+	 * collision back on and switches the sprite back to the looping idle animation. Used when the level is reset in
+	 * place.
+	 */
+	void Revive();
+
+	/**
+	 * @brief Called after the character's health changed, on the server and on every client.
+	 *
+	 * Does nothing by default. Subclasses override it to react to health changes without polling GetHealth.
+	 */
+	virtual void OnHealthChanged();
+
 	/**
 	 * @brief Calculates the angle between the character's current floor and the character's UpVector.
 	 *
@@ -577,4 +608,11 @@ protected:
 	 * @see FLifetimeProperty
 	 */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	/**
+	 * @brief Called on clients when the replicated health arrived.
+	 */
+	UFUNCTION()
+	void OnRep_Health();
 };
@@ -3,11 +3,17 @@
 
 #include "EnemyCollisionPaperCharacter.h"
 
+#include "EnemyCrowdSpawner.h"
+#include "EnemyMovementComponent.h"
 #include "Components/BoxComponent.h"
 #include "Engine/DamageEvents.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
-AEnemyCollisionPaperCharacter::AEnemyCollisionPaperCharacter()
+AEnemyCollisionPaperCharacter::AEnemyCollisionPaperCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UEnemyMovementComponent>(
+		ACharacter::CharacterMovementComponentName
+	))
 {
 	PrimaryActorTick.bCanEverTick = false;
 	
@@ -38,6 +44,24 @@ void AEnemyCollisionPaperCharacter::BeginPlay()
 	this->RightHurtBox->SetGenerateOverlapEvents(true);
 	this->RightHurtBox->OnComponentBeginOverlap.AddDynamic(this, &AEnemyCollisionPaperCharacter::OnBeginOverlapDelegate);
 	this->RightHurtBox->SetCollisionProfileName("OverlapAllDynamic");
+
+	// walkers promoted from an enemy crowd are reset by their crowd instead
+	if (Cast<AEnemyCrowdSpawner>(this->GetOwner()) != nullptr) return;
+
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->RegisterActor(this);
+	}
+}
+
+void AEnemyCollisionPaperCharacter::ResetToInitialState()
+{
+	Revive();
+
+	if (UEnemyMovementComponent* EnemyMovement = this->GetEnemyMovement())
+	{
+		EnemyMovement->ResetEnemyMovement();
+	}
 }
 
 UBoxComponent* AEnemyCollisionPaperCharacter::GetDamageBox() const
@@ -55,6 +79,11 @@ UBoxComponent* AEnemyCollisionPaperCharacter::GetRightHurtBox() const
 	return RightHurtBox;
 }
 
+UEnemyMovementComponent* AEnemyCollisionPaperCharacter::GetEnemyMovement() const
+{
+	return Cast<UEnemyMovementComponent>(this->GetCharacterMovement());
+}
+
 int AEnemyCollisionPaperCharacter::GetPointWorth() const
 {
 	return this->PointWorth;
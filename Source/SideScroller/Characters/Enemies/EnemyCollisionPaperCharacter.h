@@ -5,20 +5,30 @@
 #include "CoreMinimal.h"
 #include "SideScroller/Characters/BasePaperCharacter.h"
 #include "SideScroller/Interfaces/PointsInterface.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
 #include "EnemyCollisionPaperCharacter.generated.h"
 
+class UEnemyMovementComponent;
+
 /**
  * 
  */
 UCLASS()
-class SIDESCROLLER_API AEnemyCollisionPaperCharacter : public ABasePaperCharacter, public IPointsInterface
+class SIDESCROLLER_API AEnemyCollisionPaperCharacter : public ABasePaperCharacter, public IPointsInterface,
+	public IResettableInterface
 {
 	GENERATED_BODY()
 
 public:
 	virtual void BeginPlay() override;
 
-	AEnemyCollisionPaperCharacter();
+	/**
+	 * @brief Sets up the damage and hurt boxes and gives the enemy a UEnemyMovementComponent, which runs the full
+	 * character movement until a subclass picks a cheaper enemy movement mode.
+	 *
+	 * @param ObjectInitializer Used to replace the character movement component.
+	 */
+	AEnemyCollisionPaperCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	UFUNCTION(BlueprintCallable)
 	void OnHitDelegate(
@@ -46,6 +56,19 @@ public:
 	UFUNCTION(BlueprintCallable)
 	int GetPointWorth() const;
 
+	/**
+	 * @brief Gets the enemy's movement component.
+	 *
+	 * @return The character movement component as a UEnemyMovementComponent.
+	 */
+	UEnemyMovementComponent* GetEnemyMovement() const;
+
+	/**
+	 * @brief Brings the enemy back to life where it started when the level is reset in place, and starts its movement
+	 * over.
+	 */
+	virtual void ResetToInitialState() override;
+
 private:
 	UPROPERTY(EditAnywhere, Category = Points)
 	int PointWorth = 100;
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyCrowdSpawner.h"
+
+#include "EnemyCollisionPaperCharacter.h"
+#include "PaperFlipbook.h"
+#include "PaperGroupedSpriteComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "SideScroller/GameStates/LevelGameState.h"
+#include "SideScroller/Subsystems/EnemyCrowdSubsystem.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
+#include "SideScroller/Subsystems/PlatformNavigationSubsystem.h"
+
+/**
+ * Sets up the spawn box and the grouped sprite component. The spawner replicates but does not move, and it is always
+ * relevant so every client knows the whole crowd; after the walkers have been placed it only replicates when a walker
+ * is promoted, demoted or killed.
+ */
+AEnemyCrowdSpawner::AEnemyCrowdSpawner()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	this->SpawnBox = CreateDefaultSubobject<UBoxComponent>(TEXT("SpawnBox"));
+	this->SpawnBox->SetBoxExtent(FVector(1024.f, 32.f, 256.f));
+	this->SpawnBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	this->SpawnBox->SetHiddenInGame(true);
+	this->SetRootComponent(this->SpawnBox);
+
+	this->WalkerSprites = CreateDefaultSubobject<UPaperGroupedSpriteComponent>(TEXT("WalkerSprites"));
+	this->WalkerSprites->SetupAttachment(this->SpawnBox);
+	this->WalkerSprites->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	this->WalkerSprites->SetMobility(EComponentMobility::Movable);
+
+	this->SetReplicates(true);
+	this->SetReplicatingMovement(false);
+	this->bAlwaysRelevant = true;
+	this->NetUpdateFrequency = 10.f;
+	this->MinNetUpdateFrequency = 1.f;
+}
+
+/**
+ * Places the walkers on the server, then hands the crowd to the crowd subsystem everywhere. Clients register again
+ * once the walkers have replicated.
+ */
+void AEnemyCrowdSpawner::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (this->HasAuthority())
+	{
+		this->SpawnWalkers();
+		this->InitialWalkers = this->Walkers;
+	}
+
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->OnLevelReset.AddUObject(this, &AEnemyCrowdSpawner::OnLevelReset);
+	}
+	if (UEnemyCrowdSubsystem* Crowds = GetWorld()->GetSubsystem<UEnemyCrowdSubsystem>())
+	{
+		Crowds->RegisterCrowd(this);
+	}
+}
+
+/**
+ * Removes the crowd, and any actors its walkers were promoted to, from the crowd subsystem.
+ *
+ * @param EndPlayReason Why the spawner is leaving play.
+ */
+void AEnemyCrowdSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->OnLevelReset.RemoveAll(this);
+	}
+	if (UEnemyCrowdSubsystem* Crowds = GetWorld()->GetSubsystem<UEnemyCrowdSubsystem>())
+	{
+		Crowds->UnregisterCrowd(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/**
+ * Places the walkers. Each one drops onto the highest platform under a random X of the spawn box and walks the part
+ * of it inside the box, less the walker's capsule radius at each end so it turns before it hangs over an edge or
+ * into a wall. The level's random stream is used, so a level with the same seed gets the same crowd.
+ */
+void AEnemyCrowdSpawner::SpawnWalkers()
+{
+	this->Walkers.Reset();
+
+	const UPlatformNavigationSubsystem* Navigation = GetWorld()->GetSubsystem<UPlatformNavigationSubsystem>();
+	if (Navigation == nullptr || !Navigation->HasGraph() || this->WalkerClass == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("AEnemyCrowdSpawner::SpawnWalkers - %s needs a walker class and a platform navigation graph."),
+			*this->GetName()
+		);
+		return;
+	}
+
+	const AEnemyCollisionPaperCharacter* WalkerDefaults =
+		this->WalkerClass->GetDefaultObject<AEnemyCollisionPaperCharacter>();
+	const float HalfWidth = WalkerDefaults->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	const FBox Box = this->SpawnBox->Bounds.GetBox();
+	FRandomStream& Random = ALevelGameState::GetLevelRandomStream(this);
+
+	for (int32 Attempt = 0; Attempt < this->WalkerCount * 4 && this->Walkers.Num() < this->WalkerCount; ++Attempt)
+	{
+		const float X = Random.FRandRange(Box.Min.X, Box.Max.X);
+		const FVector DropPoint(X, Box.GetCenter().Y, Box.Max.Z);
+		const FPlatformNavNode* Node = Navigation->GetNode(Navigation->FindNode(DropPoint));
+		if (Node == nullptr || Node->GetFloorZ(X) < Box.Min.Z) continue;
+
+		FEnemyCrowdWalker& Walker = this->Walkers.AddDefaulted_GetRef();
+		Walker.MinX = FMath::Max(Node->MinX, Box.Min.X) + HalfWidth;
+		Walker.MaxX = FMath::Min(Node->MaxX, Box.Max.X) - HalfWidth;
+		if (Walker.MaxX - Walker.MinX < HalfWidth)
+		{
+			this->Walkers.Pop();
+			continue;
+		}
+
+		Walker.LeftZ = Node->GetFloorZ(Walker.MinX);
+		Walker.RightZ = Node->GetFloorZ(Walker.MaxX);
+		Walker.Speed = this->WalkSpeed * Random.FRandRange(0.8f, 1.2f);
+		Walker.WalkOffset = Random.FRandRange(0.f, 2.f * (Walker.MaxX - Walker.MinX));
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("AEnemyCrowdSpawner::SpawnWalkers - %s placed %i of %i walkers."),
+		*this->GetName(), this->Walkers.Num(), this->WalkerCount
+	);
+}
+
+/**
+ * Changes one walker's replicated state.
+ *
+ * @param WalkerIndex The index of the walker in the crowd.
+ * @param Walker The walker's new state.
+ */
+void AEnemyCrowdSpawner::SetWalker(const int32 WalkerIndex, const FEnemyCrowdWalker& Walker)
+{
+	if (!this->Walkers.IsValidIndex(WalkerIndex)) return;
+	this->Walkers[WalkerIndex] = Walker;
+}
+
+/**
+ * Gets the sprite the walkers are drawn with.
+ *
+ * @return WalkerSprite, or the first frame of the walker class's idle animation, or nullptr.
+ */
+UPaperSprite* AEnemyCrowdSpawner::GetWalkerSprite() const
+{
+	if (this->WalkerSprite != nullptr || this->WalkerClass == nullptr) return this->WalkerSprite;
+
+	const AEnemyCollisionPaperCharacter* WalkerDefaults =
+		this->WalkerClass->GetDefaultObject<AEnemyCollisionPaperCharacter>();
+	const UPaperFlipbook* IdleAnimation = WalkerDefaults->IdleAnimation;
+	return IdleAnimation != nullptr ? IdleAnimation->GetSpriteAtFrame(0) : nullptr;
+}
+
+/**
+ * Puts the initial walkers back on the server and lets the crowd subsystem drop the promoted actors. Clients get the
+ * initial walkers through replication.
+ */
+void AEnemyCrowdSpawner::OnLevelReset()
+{
+	if (!this->HasAuthority()) return;
+
+	this->Walkers = this->InitialWalkers;
+	if (UEnemyCrowdSubsystem* Crowds = GetWorld()->GetSubsystem<UEnemyCrowdSubsystem>())
+	{
+		Crowds->ResetCrowd(this);
+	}
+}
+
+/**
+ * Hands the walkers the server sent to the crowd subsystem.
+ */
+void AEnemyCrowdSpawner::OnRep_Walkers()
+{
+	if (UEnemyCrowdSubsystem* Crowds = GetWorld()->GetSubsystem<UEnemyCrowdSubsystem>())
+	{
+		Crowds->RegisterCrowd(this);
+	}
+}
+
+/**
+ * @brief Get the lifetime replicated properties of the crowd spawner.
+ *
+ * @param OutLifetimeProps An array of FLifetimeProperty objects to store the replicated properties.
+ *
+ * @see DOREPLIFETIME
+ */
+void AEnemyCrowdSpawner::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AEnemyCrowdSpawner, Walkers);
+}
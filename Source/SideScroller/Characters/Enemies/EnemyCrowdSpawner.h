@@ -0,0 +1,219 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "EnemyCrowdSpawner.generated.h"
+
+class AEnemyCollisionPaperCharacter;
+class UBoxComponent;
+class UPaperGroupedSpriteComponent;
+class UPaperSprite;
+
+/**
+ * @brief What a crowd walker currently is.
+ */
+UENUM()
+enum class EEnemyCrowdWalkerState : uint8
+{
+	/** Walks its platform as crowd data and is drawn as an instanced sprite. */
+	Walking,
+	/** Has been replaced by a real enemy actor. */
+	Promoted,
+	/** Was killed, as an actor, and stays gone until the level is reset. */
+	Dead,
+};
+
+/**
+ * @struct FEnemyCrowdWalker
+ * @brief The replicated state of one crowd walker.
+ *
+ * A walker goes back and forth along a stretch of one platform at a constant speed, so together with the server world
+ * time this is all a machine needs to work out where the walker is and which way it faces.
+ */
+USTRUCT()
+struct FEnemyCrowdWalker
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The X of the left and the right end of the stretch the walker walks, where it turns around.
+	 */
+	UPROPERTY()
+	float MinX = 0.f;
+
+	UPROPERTY()
+	float MaxX = 0.f;
+
+	/**
+	 * @brief The Z of the floor at the left and the right end of the stretch.
+	 */
+	UPROPERTY()
+	float LeftZ = 0.f;
+
+	UPROPERTY()
+	float RightZ = 0.f;
+
+	/**
+	 * @brief The walking speed in units per second.
+	 */
+	UPROPERTY()
+	float Speed = 0.f;
+
+	/**
+	 * @brief How far along its there-and-back walk, starting right from MinX, the walker was at server time 0.
+	 */
+	UPROPERTY()
+	float WalkOffset = 0.f;
+
+	/**
+	 * @brief Whether the walker is crowd data, an actor or dead.
+	 */
+	UPROPERTY()
+	EEnemyCrowdWalkerState State = EEnemyCrowdWalkerState::Walking;
+};
+
+/**
+ * @class AEnemyCrowdSpawner
+ * @brief Fills a box of a level with a crowd of simple walking enemies that cost almost nothing until a player is near.
+ *
+ * A level with hundreds of full enemy characters pays for hundreds of character movement components, AI controllers
+ * and collision boxes. The walkers of a crowd are not actors: the server places WalkerCount of them on the platforms
+ * of the level's platform navigation graph inside the spawn box, and the UEnemyCrowdSubsystem walks them, turns them
+ * at the ends of their platform and draws them as instances of one grouped sprite component, in batch. Only when a
+ * player, or a player's projectile, comes within touching distance is a walker promoted to a real WalkerClass actor,
+ * so stomping, hurting, shooting and dying all go through the enemy's usual code; it goes back to being crowd data
+ * once the players have moved on.
+ *
+ * Only the walkers' stretches, speeds and states replicate, once and when they change; every machine works out the
+ * walkers' positions from the server world time. When the level is reset in place the crowd goes back to its initial
+ * walkers.
+ */
+UCLASS()
+class SIDESCROLLER_API AEnemyCrowdSpawner : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Sets up the spawn box and the grouped sprite component and makes the spawner always relevant.
+	 */
+	AEnemyCrowdSpawner();
+
+	/**
+	 * @brief Gets the walkers' replicated state.
+	 *
+	 * @return The walkers.
+	 */
+	const TArray<FEnemyCrowdWalker>& GetWalkers() const { return this->Walkers; }
+
+	/**
+	 * @brief Changes one walker's replicated state. Only called on the server, by the crowd subsystem.
+	 *
+	 * @param WalkerIndex The index of the walker in the crowd.
+	 * @param Walker The walker's new state.
+	 */
+	void SetWalker(int32 WalkerIndex, const FEnemyCrowdWalker& Walker);
+
+	/**
+	 * @brief Gets the class walkers are promoted to.
+	 *
+	 * @return The enemy class.
+	 */
+	TSubclassOf<AEnemyCollisionPaperCharacter> GetWalkerClass() const { return this->WalkerClass; }
+
+	/**
+	 * @brief Gets the sprite the walkers are drawn with: WalkerSprite, or the first frame of the walker class's idle
+	 * animation if it is not set.
+	 *
+	 * @return The sprite, or nullptr if there is none.
+	 */
+	UPaperSprite* GetWalkerSprite() const;
+
+	/**
+	 * @brief Gets the component the walkers are drawn by, one instance per walker.
+	 *
+	 * @return The grouped sprite component.
+	 */
+	UPaperGroupedSpriteComponent* GetWalkerSprites() const { return this->WalkerSprites; }
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+protected:
+	/**
+	 * @brief Places the walkers on the server and registers the crowd with the crowd subsystem.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Removes the crowd from the crowd subsystem.
+	 *
+	 * @param EndPlayReason Why the spawner is leaving play.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/**
+	 * @brief Places WalkerCount walkers on random platforms of the navigation graph inside the spawn box.
+	 */
+	void SpawnWalkers();
+
+	/**
+	 * @brief Puts the initial walkers back after the level was reset in place.
+	 */
+	void OnLevelReset();
+
+	/**
+	 * @brief Hands the walkers the server sent to the crowd subsystem.
+	 */
+	UFUNCTION()
+	void OnRep_Walkers();
+
+	/**
+	 * @brief The box the walkers are placed in. Walkers only walk the part of their platform inside it.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = Crowd)
+	UBoxComponent* SpawnBox;
+
+	/**
+	 * @brief Draws the walkers that are crowd data.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = Crowd)
+	UPaperGroupedSpriteComponent* WalkerSprites;
+
+	/**
+	 * @brief The enemy walkers are promoted to. Its capsule, collision boxes and health are used for the walkers too.
+	 */
+	UPROPERTY(EditAnywhere, Category = Crowd)
+	TSubclassOf<AEnemyCollisionPaperCharacter> WalkerClass;
+
+	/**
+	 * @brief The sprite walkers are drawn with. The first frame of the walker class's idle animation if not set.
+	 */
+	UPROPERTY(EditAnywhere, Category = Crowd)
+	UPaperSprite* WalkerSprite = nullptr;
+
+	/**
+	 * @brief How many walkers are placed.
+	 */
+	UPROPERTY(EditAnywhere, Category = Crowd, meta = (ClampMin = 0))
+	int32 WalkerCount = 100;
+
+	/**
+	 * @brief The average walking speed. Every walker walks somewhere between 80% and 120% of it.
+	 */
+	UPROPERTY(EditAnywhere, Category = Crowd)
+	float WalkSpeed = 60.f;
+
+	/**
+	 * @brief The walkers' replicated state.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_Walkers)
+	TArray<FEnemyCrowdWalker> Walkers;
+
+	/**
+	 * @brief The walkers as they were placed, restored when the level is reset. Server only.
+	 */
+	TArray<FEnemyCrowdWalker> InitialWalkers;
+};
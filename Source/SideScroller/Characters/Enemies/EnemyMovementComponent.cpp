@@ -0,0 +1,483 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyMovementComponent.h"
+
+#include "GameFramework/Character.h"
+#include "GameFramework/PhysicsVolume.h"
+#include "SideScroller/Characters/BasePaperCharacter.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/GameStates/LevelGameState.h"
+#include "SideScroller/Subsystems/PlatformNavigationSubsystem.h"
+
+/**
+ * Starts the current mode once the enemy is in play.
+ */
+void UEnemyMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	this->ResetEnemyMovement();
+}
+
+/**
+ * Runs the full character movement in Character mode. In the other modes only the pawn movement tick runs, then the
+ * server moves the enemy kinematically and simulated proxies draw it between snapshots. Both are timed by the tick
+ * census, so the modes can be compared on the same enemies.
+ *
+ * @param DeltaTime Time since the last tick.
+ * @param TickType The kind of tick.
+ * @param ThisTickFunction The tick function of this component.
+ */
+void UEnemyMovementComponent::TickComponent(
+	const float DeltaTime,
+	const ELevelTick TickType,
+	FActorComponentTickFunction* ThisTickFunction
+) {
+	TICK_CENSUS_SCOPE();
+
+	if (this->EnemyMovementMode == EEnemyMovementMode::Character || !this->HasValidData())
+	{
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+
+	// skip the character movement tick, which would look for the floor and simulate proxies again
+	UPawnMovementComponent::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	switch (this->CharacterOwner->GetLocalRole())
+	{
+	case ROLE_Authority:
+		this->TickKinematic(DeltaTime);
+		break;
+	case ROLE_SimulatedProxy:
+		this->TickSnapshots();
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * Changes how the enemy moves. Going back to Character mode hands the enemy to the full character movement in its
+ * default movement mode.
+ *
+ * @param NewMode The new enemy movement mode.
+ */
+void UEnemyMovementComponent::SetEnemyMovementMode(const EEnemyMovementMode NewMode)
+{
+	if (NewMode == this->EnemyMovementMode) return;
+
+	this->EnemyMovementMode = NewMode;
+	if (NewMode != EEnemyMovementMode::Character)
+	{
+		this->ResetEnemyMovement();
+		return;
+	}
+
+	this->Snapshots.Reset();
+	if (this->HasValidData() && this->CharacterOwner->HasAuthority())
+	{
+		this->SetDefaultMovementMode();
+	}
+}
+
+/**
+ * Sets the time between hops, and shortens the wait for the next hop if it is now longer than that.
+ *
+ * @param NewHopPeriod The time between hops.
+ */
+void UEnemyMovementComponent::SetHopPeriod(const float NewHopPeriod)
+{
+	this->HopPeriod = FMath::Max(NewHopPeriod, 0.1f);
+	this->HopCountdown = FMath::Min(this->HopCountdown, this->HopPeriod);
+}
+
+/**
+ * Starts the current mode over from where the enemy is. Walkers and hoppers start falling and land on the first tick
+ * if they stand on a floor, so nothing has to look for the floor here. Only the server sets the movement mode and
+ * draws the first hop time from the level's random stream; simulated proxies get the movement mode with the
+ * snapshots.
+ */
+void UEnemyMovementComponent::ResetEnemyMovement()
+{
+	if (this->EnemyMovementMode == EEnemyMovementMode::Character) return;
+
+	const bool bFlying = this->EnemyMovementMode == EEnemyMovementMode::FlyPatrol;
+	this->DefaultLandMovementMode = bFlying ? MOVE_Flying : MOVE_Walking;
+	if (!this->HasValidData()) return;
+
+	this->Snapshots.Reset();
+	this->MoveDirection = this->UpdatedComponent->GetForwardVector().X < 0.f ? -1.f : 1.f;
+	this->PatrolAnchorX = this->UpdatedComponent->GetComponentLocation().X;
+	if (!this->CharacterOwner->HasAuthority()) return;
+
+	this->HopCountdown = ALevelGameState::GetLevelRandomStream(this).FRandRange(0.f, this->HopPeriod);
+	this->Velocity = FVector::ZeroVector;
+	this->SetMovementMode(bFlying ? MOVE_Flying : MOVE_Falling);
+}
+
+/**
+ * Takes the movement input and any jump request, counts down to the next hop and moves the enemy for its mode. Dead
+ * enemies drop their input and only fall: on the ground they stand still, and in the air they keep falling.
+ *
+ * @param DeltaTime Time since the last tick.
+ */
+void UEnemyMovementComponent::TickKinematic(const float DeltaTime)
+{
+	FVector Input = this->ConsumeInputVector();
+	bool bWantsToHop = this->CharacterOwner->bPressedJump;
+	this->CharacterOwner->ClearJumpInput(DeltaTime);
+	if (DeltaTime <= 0.f || this->MovementMode == MOVE_None) return;
+
+	if (this->IsOwnerDead() && this->IsMovingOnGround())
+	{
+		this->Velocity = FVector::ZeroVector;
+		this->UpdateComponentVelocity();
+		return;
+	}
+
+	if (this->IsOwnerDead())
+	{
+		Input = FVector::ZeroVector;
+		bWantsToHop = false;
+	}
+	else if (this->EnemyMovementMode == EEnemyMovementMode::Hop && this->IsMovingOnGround())
+	{
+		this->HopCountdown -= DeltaTime;
+		bWantsToHop |= this->HopCountdown <= 0.f;
+	}
+
+	if (this->EnemyMovementMode == EEnemyMovementMode::FlyPatrol)
+	{
+		this->MoveFlying(DeltaTime, Input);
+	}
+	else if (this->IsFalling())
+	{
+		this->MoveInAir(DeltaTime);
+	}
+	else
+	{
+		this->MoveOnGround(DeltaTime, Input, bWantsToHop);
+	}
+
+	this->UpdateComponentVelocity();
+}
+
+/**
+ * Walks along the platform the enemy stands on in the platform navigation graph, following its floor instead of
+ * looking for it. Without input a walker turns around before it hangs over either end of the platform; with input it
+ * goes where the input says and falls off the end if the input takes it there, so the AI controller can drop it along
+ * its path. The one sweep only finds walls, which turn a walker around, and bumps the platform's straight floor line
+ * missed, which it slides over. Without a graph, or off it, the enemy walks level and then looks for the floor the
+ * way the character movement does, and falls if there is none, so it does not walk off ledges into the air.
+ *
+ * @param DeltaTime Time since the last tick.
+ * @param Input The movement input, or zero.
+ * @param bWantsToHop Whether the enemy hops this tick.
+ */
+void UEnemyMovementComponent::MoveOnGround(const float DeltaTime, const FVector& Input, const bool bWantsToHop)
+{
+	const float InputDirection = static_cast<float>(FMath::Sign(Input.X));
+	if (bWantsToHop)
+	{
+		// hoppers hop in place unless told where to go; walkers hop the way they walk
+		const float IdleDirection = this->EnemyMovementMode == EEnemyMovementMode::Walk ? this->MoveDirection : 0.f;
+		this->Hop(InputDirection != 0.f ? InputDirection : IdleDirection);
+		this->MoveInAir(DeltaTime);
+		return;
+	}
+
+	if (this->EnemyMovementMode == EEnemyMovementMode::Hop)
+	{
+		this->Velocity = FVector::ZeroVector;
+		return;
+	}
+
+	const bool bChasing = InputDirection != 0.f;
+	if (bChasing)
+	{
+		this->MoveDirection = InputDirection;
+	}
+
+	const FVector Location = this->UpdatedComponent->GetComponentLocation();
+	const float HalfHeight = this->CharacterOwner->GetSimpleCollisionHalfHeight();
+	const UPlatformNavigationSubsystem* Navigation = GetWorld()->GetSubsystem<UPlatformNavigationSubsystem>();
+	const FPlatformNavNode* Node = Navigation != nullptr
+		? Navigation->GetNode(Navigation->FindNode(Location - FVector(0.f, 0.f, HalfHeight)))
+		: nullptr;
+
+	double NewX = Location.X + this->MoveDirection * this->GetMaxSpeed() * DeltaTime;
+	double NewZ = Location.Z;
+	if (Node != nullptr)
+	{
+		const float Radius = this->CharacterOwner->GetSimpleCollisionRadius();
+		const bool bPastLeftEnd = this->MoveDirection < 0.f && NewX < Node->MinX + Radius;
+		const bool bPastRightEnd = this->MoveDirection > 0.f && NewX > Node->MaxX - Radius;
+		if (!bChasing && (bPastLeftEnd || bPastRightEnd))
+		{
+			// turn around this tick and walk back on the next
+			this->MoveDirection = -this->MoveDirection;
+			NewX = Location.X;
+		}
+		else if (NewX < Node->MinX || NewX > Node->MaxX)
+		{
+			this->Velocity = FVector(this->MoveDirection * this->GetMaxSpeed(), 0.f, 0.f);
+			this->SetMovementMode(MOVE_Falling);
+			this->MoveInAir(DeltaTime);
+			return;
+		}
+		NewZ = Node->GetFloorZ(static_cast<float>(NewX)) + HalfHeight;
+	}
+
+	const FVector Delta(NewX - Location.X, 0.f, NewZ - Location.Z);
+	this->Velocity = Delta / DeltaTime;
+
+	FHitResult Hit;
+	if (this->MoveCapsule(Delta, Hit))
+	{
+		if (this->IsWalkable(Hit))
+		{
+			this->SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+		}
+		else if (!bChasing)
+		{
+			this->MoveDirection = -this->MoveDirection;
+		}
+	}
+
+	if (Node != nullptr) return;
+
+	// off the graph nothing says where the floor is, so probe for it
+	this->FindFloor(this->UpdatedComponent->GetComponentLocation(), this->CurrentFloor, false);
+	if (this->CurrentFloor.IsWalkableFloor())
+	{
+		this->AdjustFloorHeight();
+		return;
+	}
+
+	this->SetMovementMode(MOVE_Falling);
+}
+
+/**
+ * Falls under gravity, keeping the horizontal velocity, and lands on the first walkable floor the sweep hits. Walls
+ * stop the enemy's horizontal motion and ceilings its rise. Landing sets the walking mode, which lets the character
+ * movement find the floor once so the base and the floor angle stay right.
+ *
+ * @param DeltaTime Time since the last tick.
+ */
+void UEnemyMovementComponent::MoveInAir(const float DeltaTime)
+{
+	const FVector OldVelocity = this->Velocity;
+	const float TerminalVelocity = this->GetPhysicsVolume()->TerminalVelocity;
+	this->Velocity.Z = FMath::Max<double>(this->Velocity.Z + this->GetGravityZ() * DeltaTime, -TerminalVelocity);
+
+	FHitResult Hit;
+	if (!this->MoveCapsule(0.5f * (OldVelocity + this->Velocity) * DeltaTime, Hit)) return;
+
+	if (this->IsWalkable(Hit))
+	{
+		this->Velocity.Z = 0.f;
+		if (this->EnemyMovementMode != EEnemyMovementMode::Walk)
+		{
+			this->Velocity.X = 0.f;
+		}
+		this->SetMovementMode(MOVE_Walking);
+		this->CharacterOwner->Landed(Hit);
+	}
+	else if (Hit.Normal.Z < 0.f)
+	{
+		this->Velocity.Z = FMath::Min(this->Velocity.Z, 0.0);
+	}
+	else
+	{
+		this->Velocity.X = 0.f;
+	}
+}
+
+/**
+ * Flies along the movement input at the flying speed. Without input the enemy patrols PatrolDistance either side of
+ * PatrolAnchorX, which follows the enemy while it is chasing so it patrols where the chase ended. A wall turns a
+ * patrolling enemy around and stops a chasing one against it.
+ *
+ * @param DeltaTime Time since the last tick.
+ * @param Input The movement input, or zero.
+ */
+void UEnemyMovementComponent::MoveFlying(const float DeltaTime, const FVector& Input)
+{
+	const float Speed = this->GetMaxSpeed();
+	const double X = this->UpdatedComponent->GetComponentLocation().X;
+	if (!Input.IsNearlyZero())
+	{
+		this->Velocity = Input.GetClampedToMaxSize(1.f) * Speed;
+		this->PatrolAnchorX = X;
+		if (Input.X != 0.f)
+		{
+			this->MoveDirection = static_cast<float>(FMath::Sign(Input.X));
+		}
+	}
+	else if (this->PatrolDistance <= 0.f || this->IsOwnerDead())
+	{
+		this->Velocity = FVector::ZeroVector;
+	}
+	else
+	{
+		if ((X - this->PatrolAnchorX) * this->MoveDirection >= this->PatrolDistance)
+		{
+			this->MoveDirection = -this->MoveDirection;
+		}
+		this->Velocity = FVector(this->MoveDirection * Speed, 0.f, 0.f);
+	}
+
+	this->Velocity = this->ConstrainDirectionToPlane(this->Velocity);
+	if (this->Velocity.IsZero()) return;
+
+	FHitResult Hit;
+	if (!this->MoveCapsule(this->Velocity * DeltaTime, Hit)) return;
+
+	this->MoveDirection = -this->MoveDirection;
+	this->Velocity = FVector::VectorPlaneProject(this->Velocity, Hit.Normal);
+}
+
+/**
+ * Leaves the ground with JumpZVelocity, left or right at the walking speed or straight up, and waits HopPeriod for the
+ * next timed hop.
+ *
+ * @param Direction -1 or 1 to hop left or right at the walking speed, or 0 to hop in place.
+ */
+void UEnemyMovementComponent::Hop(const float Direction)
+{
+	this->Velocity = FVector(Direction * this->MaxWalkSpeed, 0.f, this->JumpZVelocity);
+	this->HopCountdown = this->HopPeriod;
+	this->SetMovementMode(MOVE_Falling);
+	this->CharacterOwner->OnJumped();
+}
+
+/**
+ * Sweeps the capsule once. A character that orients its rotation to movement is turned to face left (yaw 180) or
+ * right (yaw 0) in the same move.
+ *
+ * @param Delta How far to move.
+ * @param OutHit The blocking hit, if any.
+ * @return True if something blocked the capsule.
+ */
+bool UEnemyMovementComponent::MoveCapsule(const FVector& Delta, FHitResult& OutHit)
+{
+	FRotator Rotation = this->UpdatedComponent->GetComponentRotation();
+	if (this->bOrientRotationToMovement && FMath::Abs(Delta.X) > KINDA_SMALL_NUMBER)
+	{
+		Rotation.Yaw = Delta.X < 0.f ? 180.f : 0.f;
+	}
+
+	this->SafeMoveUpdatedComponent(Delta, Rotation.Quaternion(), true, OutHit);
+	return OutHit.IsValidBlockingHit();
+}
+
+/**
+ * Buffers the location the server sent, with the velocity and movement mode that came with it. If the enemy was
+ * standing still, or the buffer is empty, the buffer starts over from where the enemy is drawn now so it moves
+ * smoothly to the new location over InterpolationDelay. Locations further than NetworkNoSmoothUpdateDistance away,
+ * like an enemy reset in place, are jumped to.
+ *
+ * @param OldLocation Where the enemy is drawn.
+ * @param OldRotation How the enemy is drawn rotated.
+ * @param NewLocation Where the server says the enemy is.
+ * @param NewRotation How the server says the enemy is rotated.
+ */
+void UEnemyMovementComponent::SmoothCorrection(
+	const FVector& OldLocation,
+	const FQuat& OldRotation,
+	const FVector& NewLocation,
+	const FQuat& NewRotation
+) {
+	if (this->EnemyMovementMode == EEnemyMovementMode::Character || !this->HasValidData())
+	{
+		Super::SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double DrawTime = Now - this->InterpolationDelay;
+	const uint8 PackedMovementMode = this->CharacterOwner->GetReplicatedMovementMode();
+	if (FVector::DistSquared(OldLocation, NewLocation) > FMath::Square(this->NetworkNoSmoothUpdateDistance))
+	{
+		this->Snapshots.Reset();
+		this->UpdatedComponent->SetWorldLocationAndRotation(
+			NewLocation, NewRotation, false, nullptr, ETeleportType::TeleportPhysics
+		);
+	}
+	else if (this->Snapshots.Num() == 0 || this->Snapshots.Last().Time < DrawTime)
+	{
+		this->Snapshots.Reset();
+		FEnemyMovementSnapshot& Start = this->Snapshots.AddDefaulted_GetRef();
+		Start.Location = OldLocation;
+		Start.Rotation = OldRotation;
+		Start.PackedMovementMode = this->PackNetworkMovementMode();
+		Start.Time = DrawTime;
+	}
+
+	if (this->Snapshots.Num() >= MaxSnapshots)
+	{
+		this->Snapshots.RemoveAt(0, 1, false);
+	}
+
+	FEnemyMovementSnapshot& Snapshot = this->Snapshots.AddDefaulted_GetRef();
+	Snapshot.Location = NewLocation;
+	Snapshot.Rotation = NewRotation;
+	Snapshot.Velocity = this->Velocity;
+	Snapshot.PackedMovementMode = PackedMovementMode;
+	Snapshot.Time = Now;
+}
+
+/**
+ * Drops the snapshots already drawn past and puts the enemy between the two around InterpolationDelay seconds ago,
+ * or holds it at the last one until the server sends more. The rotation is not blended, so a sprite turning around
+ * flips instead of showing its edge. The movement mode and velocity are the ones of the snapshot being left, so
+ * animations and sounds that follow them line up with what is drawn.
+ */
+void UEnemyMovementComponent::TickSnapshots()
+{
+	if (this->Snapshots.Num() == 0) return;
+
+	const double DrawTime = GetWorld()->GetTimeSeconds() - this->InterpolationDelay;
+	while (this->Snapshots.Num() > 1 && this->Snapshots[1].Time <= DrawTime)
+	{
+		this->Snapshots.RemoveAt(0, 1, false);
+	}
+
+	const FEnemyMovementSnapshot& From = this->Snapshots[0];
+	FVector Location = From.Location;
+	this->Velocity = From.Velocity;
+	if (this->Snapshots.Num() > 1 && DrawTime > From.Time)
+	{
+		const FEnemyMovementSnapshot& To = this->Snapshots[1];
+		const double Span = FMath::Max<double>(To.Time - From.Time, KINDA_SMALL_NUMBER);
+		const double Alpha = FMath::Clamp((DrawTime - From.Time) / Span, 0.0, 1.0);
+		Location = FMath::Lerp(From.Location, To.Location, Alpha);
+		this->Velocity = FMath::Lerp(From.Velocity, To.Velocity, Alpha);
+	}
+
+	if (From.PackedMovementMode != this->PackNetworkMovementMode())
+	{
+		this->ApplyNetworkMovementMode(From.PackedMovementMode);
+	}
+	this->bNetworkMovementModeChanged = false;
+
+	if (!Location.Equals(this->UpdatedComponent->GetComponentLocation())
+		|| !From.Rotation.Equals(this->UpdatedComponent->GetComponentQuat())
+	) {
+		this->UpdatedComponent->SetWorldLocationAndRotation(Location, From.Rotation);
+	}
+	this->UpdateComponentVelocity();
+}
+
+/**
+ * Checks whether the owner is a paper character that has died.
+ *
+ * @return True if the owner is dead.
+ */
+bool UEnemyMovementComponent::IsOwnerDead() const
+{
+	const ABasePaperCharacter* Enemy = Cast<ABasePaperCharacter>(this->CharacterOwner);
+	return Enemy != nullptr && Enemy->IsDead();
+}
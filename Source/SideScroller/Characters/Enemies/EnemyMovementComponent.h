@@ -0,0 +1,241 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "EnemyMovementComponent.generated.h"
+
+/**
+ * @brief How an enemy's UEnemyMovementComponent moves it.
+ */
+UENUM(BlueprintType)
+enum class EEnemyMovementMode : uint8
+{
+	/** Full character movement, for enemies that need floor finding, slopes and step-ups. */
+	Character,
+	/** Walks along its platform and turns around at walls and at the ends of the platform. */
+	Walk,
+	/** Stands still and hops every HopPeriod seconds, in place or toward the movement input. */
+	Hop,
+	/** Flies back and forth PatrolDistance either side of where it started and turns around at walls. */
+	FlyPatrol,
+};
+
+/**
+ * @class UEnemyMovementComponent
+ * @brief A cheap kinematic movement for simple enemies that walk, hop or fly in the plane of the level.
+ *
+ * Full character movement finds the floor, steps up, slides and sweeps the capsule several times every tick, and
+ * simulated proxies run a simulation of their own, which simple enemies do not need. In any mode but Character this
+ * component replaces all of that: on the server it works out the enemy's velocity for its mode and moves it with a
+ * single sweep of the capsule, following the floor of its platform in the level's platform navigation graph instead
+ * of looking for it, and it turns the enemy around when the sweep hits a wall. Movement input, from the AI controller,
+ * takes over from walking or patrolling, and a jump request starts a hop, so chasing and following paths still work.
+ *
+ * The single sweep is the rule on a platform of the graph, in the air and when flying. A walker takes more only when:
+ * - the sweep hits a walkable bump the platform's straight floor line missed, where it slides over it with a second
+ *   sweep, as the character movement would;
+ * - it is off the graph, or the level has none, where it looks for the floor the way the character movement does,
+ *   so it does not walk off ledges into the air;
+ * - it lands, where the walking mode lets the character movement find the floor once.
+ *
+ * TickComponent is timed by the tick census (see FTickCensus), so its cost can be compared with Character mode.
+ *
+ * Simulated proxies do not simulate at all: the locations the server sends are buffered and the enemy is drawn
+ * InterpolationDelay seconds in the past, between the two snapshots around that time.
+ *
+ * The movement modes are still set (walking, falling or flying) so everything that asks a character whether it is
+ * falling keeps working, and the walk, fly and jump speeds are the usual character movement settings.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class SIDESCROLLER_API UEnemyMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Moves the enemy kinematically on the server and between snapshots on simulated proxies, or runs the full
+	 * character movement in Character mode.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 * @param TickType The kind of tick.
+	 * @param ThisTickFunction The tick function of this component.
+	 */
+	virtual void TickComponent(
+		float DeltaTime,
+		ELevelTick TickType,
+		FActorComponentTickFunction* ThisTickFunction
+	) override;
+
+	/**
+	 * @brief Buffers the location the server sent instead of correcting toward it, unless in Character mode.
+	 *
+	 * @param OldLocation Where the enemy is drawn.
+	 * @param OldRotation How the enemy is drawn rotated.
+	 * @param NewLocation Where the server says the enemy is.
+	 * @param NewRotation How the server says the enemy is rotated.
+	 */
+	virtual void SmoothCorrection(
+		const FVector& OldLocation,
+		const FQuat& OldRotation,
+		const FVector& NewLocation,
+		const FQuat& NewRotation
+	) override;
+
+	/**
+	 * @brief Gets how the enemy moves.
+	 *
+	 * @return The enemy movement mode.
+	 */
+	EEnemyMovementMode GetEnemyMovementMode() const { return this->EnemyMovementMode; }
+
+	/**
+	 * @brief Changes how the enemy moves and starts the new mode from where the enemy is.
+	 *
+	 * @param NewMode The new enemy movement mode.
+	 */
+	void SetEnemyMovementMode(EEnemyMovementMode NewMode);
+
+	/**
+	 * @brief Sets how many seconds the enemy waits between hops in Hop mode.
+	 *
+	 * @param NewHopPeriod The time between hops.
+	 */
+	void SetHopPeriod(float NewHopPeriod);
+
+	/**
+	 * @brief Starts the current mode over from where the enemy is: patrols around its location, walks the way it
+	 * faces, waits a random part of HopPeriod for its first hop and drops the buffered snapshots. Called when the enemy
+	 * begins play and when it is reset in place.
+	 */
+	void ResetEnemyMovement();
+
+protected:
+	/**
+	 * @brief Starts the current mode.
+	 */
+	virtual void BeginPlay() override;
+
+private:
+	/**
+	 * @struct FEnemyMovementSnapshot
+	 * @brief A location the server sent, with the velocity and movement mode sent with it and when it arrived.
+	 */
+	struct FEnemyMovementSnapshot
+	{
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		FVector Velocity = FVector::ZeroVector;
+		uint8 PackedMovementMode = 0;
+		double Time = 0.0;
+	};
+
+	/**
+	 * @brief Works out the velocity for the mode, the movement input and jump requests, and moves the enemy.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 */
+	void TickKinematic(float DeltaTime);
+
+	/**
+	 * @brief Walks along the floor of the enemy's platform, or stands still in Hop mode, and starts a hop when asked.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 * @param Input The movement input, or zero.
+	 * @param bWantsToHop Whether the enemy hops this tick.
+	 */
+	void MoveOnGround(float DeltaTime, const FVector& Input, bool bWantsToHop);
+
+	/**
+	 * @brief Falls under gravity and lands on the first walkable floor the sweep hits.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 */
+	void MoveInAir(float DeltaTime);
+
+	/**
+	 * @brief Flies along the movement input, or patrols around PatrolAnchorX without it.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 * @param Input The movement input, or zero.
+	 */
+	void MoveFlying(float DeltaTime, const FVector& Input);
+
+	/**
+	 * @brief Leaves the ground with JumpZVelocity.
+	 *
+	 * @param Direction -1 or 1 to hop left or right at the walking speed, or 0 to hop in place.
+	 */
+	void Hop(float Direction);
+
+	/**
+	 * @brief Sweeps the capsule once and faces the way it moves if the character orients rotation to movement.
+	 *
+	 * @param Delta How far to move.
+	 * @param OutHit The blocking hit, if any.
+	 * @return True if something blocked the capsule.
+	 */
+	bool MoveCapsule(const FVector& Delta, FHitResult& OutHit);
+
+	/**
+	 * @brief Draws a simulated proxy between the two snapshots around InterpolationDelay seconds ago.
+	 */
+	void TickSnapshots();
+
+	/**
+	 * @brief Whether the owner is a dead enemy, which no longer walks, hops or flies.
+	 *
+	 * @return True if the owner is dead.
+	 */
+	bool IsOwnerDead() const;
+
+	/**
+	 * @brief How the enemy moves.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Enemy Movement")
+	EEnemyMovementMode EnemyMovementMode = EEnemyMovementMode::Character;
+
+	/**
+	 * @brief How many seconds the enemy waits on the ground between hops in Hop mode.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Enemy Movement", meta = (ClampMin = 0.1))
+	float HopPeriod = 5.f;
+
+	/**
+	 * @brief How far either side of where it started the enemy flies in FlyPatrol mode. Zero hovers in place.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Enemy Movement", meta = (ClampMin = 0))
+	float PatrolDistance = 128.f;
+
+	/**
+	 * @brief How far in the past simulated proxies are drawn, so there is nearly always a newer snapshot to move to.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Enemy Movement", meta = (ClampMin = 0))
+	float InterpolationDelay = 0.1f;
+
+	/**
+	 * @brief The most snapshots a simulated proxy keeps.
+	 */
+	static constexpr int32 MaxSnapshots = 8;
+
+	/**
+	 * @brief The snapshots a simulated proxy has not drawn past yet, oldest first.
+	 */
+	TArray<FEnemyMovementSnapshot, TInlineAllocator<MaxSnapshots>> Snapshots;
+
+	/**
+	 * @brief The way the enemy walks or patrols: -1 for left, 1 for right.
+	 */
+	float MoveDirection = 1.f;
+
+	/**
+	 * @brief The X the enemy patrols around in FlyPatrol mode.
+	 */
+	double PatrolAnchorX = 0.0;
+
+	/**
+	 * @brief How long until the next hop in Hop mode.
+	 */
+	float HopCountdown = 0.f;
+};
@@ -3,9 +3,11 @@
 
 #include "PC_EnemyFrog.h"
 
+#include "EnemyMovementComponent.h"
 #include "Components/BoxComponent.h"
 #include "GameFramework/PawnMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
 
 APC_EnemyFrog::APC_EnemyFrog()
 {
@@ -19,27 +21,20 @@ APC_EnemyFrog::APC_EnemyFrog()
 	this->GetRightHurtBox()->SetRelativeScale3D(FVector(0.125698,0.161768,0.179930));
 	this->GetRightHurtBox()->SetRelativeLocation(FVector(7.000000,0.000000,-1.000000));
 
+	// the frog hops kinematically instead of jumping on a timer with the full character movement
+	this->GetEnemyMovement()->SetEnemyMovementMode(EEnemyMovementMode::Hop);
 }
 
 void APC_EnemyFrog::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	srand(static_cast<unsigned>(time(nullptr)));
-	// Get a random number less than JumpPeriod
-	const int RandomAmountOfTime = rand() % JumpPeriod;
-	
-	GetWorld()->GetTimerManager().SetTimer(
-		this->JumpTimerHandle,
-		this,
-		&APC_EnemyFrog::Jump,
-		RandomAmountOfTime,
-		false
-	);
+
+	this->GetEnemyMovement()->SetHopPeriod(static_cast<float>(JumpPeriod));
 }
 
 void APC_EnemyFrog::Tick(const float DeltaTime)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaTime);
 
 	UpdateAnimation();
@@ -74,28 +69,27 @@ void APC_EnemyFrog::UpdateAnimation()
 	}
 }
 
-void APC_EnemyFrog::Jump()
+/**
+ * Shows the jump animation and plays the jump sound when the frog leaves the ground upward, which it only does when
+ * it hops. Simulated proxies change movement mode as they draw the hop, so every machine hears it when it is seen.
+ *
+ * @param PrevMovementMode The movement mode the frog was in.
+ * @param PreviousCustomMode The custom movement mode the frog was in.
+ */
+void APC_EnemyFrog::OnMovementModeChanged(const EMovementMode PrevMovementMode, const uint8 PreviousCustomMode)
 {
-	// dont jump if already dead. this action is on a timer so it was started
-	// right after the previous jump. this check is necessary
-	if (this->IsDead()) return; 
-	
-	Super::Jump();
+	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
+
+	if (PrevMovementMode != MOVE_Walking || !this->GetMovementComponent()->IsFalling()) return;
+	if (this->GetVelocity().Z <= 0.f || this->IsDead()) return;
 
 	this->GetSprite()->SetFlipbook(JumpAnimation);
-	
-	GetWorld()->GetTimerManager().SetTimer(
-		this->JumpTimerHandle,
-		this,
-		&APC_EnemyFrog::Jump,
-		JumpPeriod,
-		false
-	);
 
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->FrogJumpSound,
 		this->GetSprite(),
-		TEXT("FrogJumpSound")
+		EAudioEventCategory::Character
 	);
 }
 
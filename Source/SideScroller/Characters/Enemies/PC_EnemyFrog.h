@@ -41,15 +41,21 @@ public:
 	
 	virtual void Tick(float DeltaSeconds) override;
 
+	/**
+	 * @brief Shows the jump animation and plays the jump sound when the frog hops, on every machine.
+	 *
+	 * @param PrevMovementMode The movement mode the frog was in.
+	 * @param PreviousCustomMode The custom movement mode the frog was in.
+	 */
+	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
+
 private:
+	/**
+	 * @brief How many seconds the frog waits between hops. Handed to its enemy movement component.
+	 */
 	UPROPERTY(EditAnywhere)
 	int JumpPeriod = 5;
 
 	UFUNCTION(BlueprintCallable)
 	void UpdateAnimation();
-
-protected:
-	virtual void Jump() override;
-	
-	FTimerHandle JumpTimerHandle;
 };
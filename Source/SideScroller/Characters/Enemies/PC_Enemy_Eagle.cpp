@@ -3,8 +3,8 @@
 
 #include "PC_Enemy_Eagle.h"
 
+#include "EnemyMovementComponent.h"
 #include "Components/BoxComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
 
 /**
  * Constructor for APC_Enemy_Eagle.
@@ -22,25 +22,11 @@ APC_Enemy_Eagle::APC_Enemy_Eagle()
 	this->GetRightHurtBox()->SetRelativeLocation(FVector(7.632283,-0.000000,2.335176));
 	this->GetRightHurtBox()->SetRelativeScale3D(FVector(0.125698,0.161768,0.242430));
 
+	// the eagle patrols in the air kinematically instead of flying with the full character movement
 	this->GetCharacterMovement()->GetNavAgentPropertiesRef().bCanFly = true;
-	this->SetDamage(20.0);
-}
-
-/**
- * @brief Function called when the enemy eagle starts playing.
- *
- * This function is called when the enemy eagle character starts playing. It sets the movement
- * mode to flying and adjusts the maximum fly speed to 50.0 units per second.
- *
- * @param None
- * @return None
- */
-void APC_Enemy_Eagle::BeginPlay()
-{
-	Super::BeginPlay();
-	
-	this->GetCharacterMovement()->SetMovementMode(MOVE_Flying);
 	this->GetCharacterMovement()->MaxFlySpeed = 50.f;
+	this->GetEnemyMovement()->SetEnemyMovementMode(EEnemyMovementMode::FlyPatrol);
+	this->SetDamage(20.0);
 }
 
 /**
@@ -31,7 +31,7 @@ public:
 	 * Initializes the initial values for the APC_Enemy_Eagle object.
 	 * Sets the tick option to false for the primary actor.
 	 * Sets the relative location and scale for the damage box, left hurt box, and right hurt box.
-	 * Enables flying for the character movement.
+	 * Makes the eagle fly-patrol with its enemy movement component at 50 units per second.
 	 * Sets the damage value to 20.0.
 	 *
 	 * @param None
@@ -39,20 +39,6 @@ public:
 	 */
 	APC_Enemy_Eagle();
 
-	/**
-	 * Begins playing the game.
-	 *
-	 * This method is called when the game starts and is used to initialize the game state or perform any necessary
-	 * setup. It is often used to set initial parameters and behaviors for the character or actor.
-	 *
-	 * It is important to call the parent class's `BeginPlay` method using `Super::BeginPlay()` to ensure any
-	 * necessary parent initialization is performed.
-	 *
-	 * After calling the parent class's `BeginPlay` method, this method sets the movement mode of the character to
-	 * `MOVE_Flying` and sets the maximum fly speed to 50 units per second.
-	 */
-	virtual void BeginPlay() override;
-
 	/**
 	 * Sets the transform of a projectile based on the given parameters.
 	 *
@@ -3,6 +3,7 @@
 
 #include "PC_Enemy_Opossum.h"
 
+#include "EnemyMovementComponent.h"
 #include "Components/BoxComponent.h"
 
 APC_Enemy_Opossum::APC_Enemy_Opossum()
@@ -20,6 +21,9 @@ APC_Enemy_Opossum::APC_Enemy_Opossum()
 	this->GetRightHurtBox()->SetRelativeScale3D(FVector(0.188198,0.161768,0.055));
 
 	this->SetDamage(30.f);
+
+	// the opossum walks its platform kinematically instead of with the full character movement
+	this->GetEnemyMovement()->SetEnemyMovementMode(EEnemyMovementMode::Walk);
 }
 
 void APC_Enemy_Opossum::BeginPlay()
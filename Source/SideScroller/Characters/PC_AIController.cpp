@@ -4,9 +4,12 @@
 #include "PC_AIController.h"
 
 #include "BasePaperCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/Subsystems/PlatformNavigationSubsystem.h"
 
 /**
  * @brief Constructor for APC_AIController.
@@ -39,16 +42,131 @@ void APC_AIController::BeginPlay()
  */
 void APC_AIController::Tick(const float DeltaSeconds)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaSeconds);
 
 	if (!UpdateFocusPawn()) return;
 	
 	if (PlayerPawn == nullptr) return;
-	this->MoveToActor(PlayerPawn, 200.f);
+	this->MoveTowardPlayer();
 
 	FocusOnPawn();
 }
 
+/**
+ * Moves the pawn toward the player pawn. Flying pawns steer straight at it. Walking pawns follow a path of
+ * platforms from the level's platform navigation graph, searched again only when the player reaches another platform
+ * or the pawn leaves the path; each link is taken by walking to its take-off point and then on toward its landing
+ * point, jumping at the take-off point of jump links. Without a graph, walking pawns walk straight toward the player.
+ */
+void APC_AIController::MoveTowardPlayer()
+{
+	APawn* AIPawn = this->GetPawn();
+	if (AIPawn == nullptr || this->PlayerPawn == nullptr) return;
+
+	const FVector Location = AIPawn->GetActorLocation();
+	const FVector TargetLocation = this->PlayerPawn->GetActorLocation();
+	ACharacter* AICharacter = Cast<ACharacter>(AIPawn);
+	const UCharacterMovementComponent* Movement = AICharacter ? AICharacter->GetCharacterMovement() : nullptr;
+	if (Movement == nullptr || Movement->MovementMode == MOVE_Flying)
+	{
+		if (FVector::Dist(Location, TargetLocation) > this->AcceptanceRadius)
+		{
+			AIPawn->AddMovementInput((TargetLocation - Location).GetSafeNormal());
+		}
+		return;
+	}
+
+	UPlatformNavigationSubsystem* Navigation = GetWorld()->GetSubsystem<UPlatformNavigationSubsystem>();
+	if (Navigation == nullptr || !Navigation->HasGraph())
+	{
+		if (FVector::Dist(Location, TargetLocation) > this->AcceptanceRadius)
+		{
+			AIPawn->AddMovementInput(FVector(FMath::Sign(TargetLocation.X - Location.X), 0.f, 0.f));
+		}
+		return;
+	}
+
+	const FVector FeetOffset(0.f, 0.f, AIPawn->GetSimpleCollisionHalfHeight());
+	const FVector TargetFeetOffset(0.f, 0.f, this->PlayerPawn->GetSimpleCollisionHalfHeight());
+	const int32 SelfNode = Navigation->FindNode(Location - FeetOffset);
+	const int32 GoalNode = Navigation->FindNode(TargetLocation - TargetFeetOffset);
+
+	// drop the links already taken, then search again if the player changed platform or the pawn left the path
+	const FPlatformNavLink* Link = Navigation->GetLink(this->PathLinks.IsValidIndex(this->PathIndex)
+		? this->PathLinks[this->PathIndex] : INDEX_NONE);
+	while (Link != nullptr && Link->ToNode == SelfNode && Link->FromNode != SelfNode)
+	{
+		++this->PathIndex;
+		Link = Navigation->GetLink(this->PathLinks.IsValidIndex(this->PathIndex)
+			? this->PathLinks[this->PathIndex] : INDEX_NONE);
+	}
+
+	if (!Movement->IsFalling() && SelfNode != INDEX_NONE && GoalNode != INDEX_NONE)
+	{
+		const bool bOnPath = Link != nullptr ? Link->FromNode == SelfNode : SelfNode == this->PathGoalNode;
+		if (GoalNode != this->PathGoalNode || !bOnPath)
+		{
+			const bool bFound = Navigation->FindPath(
+				SelfNode, Location.X, GoalNode, TargetLocation.X, this->GetPlatformNavAgent(), this->PathLinks
+			);
+			this->PathIndex = 0;
+			this->PathGoalNode = bFound ? GoalNode : INDEX_NONE;
+			if (!bFound) this->PathLinks.Reset();
+			Link = Navigation->GetLink(this->PathLinks.IsValidIndex(0) ? this->PathLinks[0] : INDEX_NONE);
+		}
+	}
+
+	float MoveToX;
+	if (Link != nullptr)
+	{
+		// keep steering toward the landing point while in the air
+		const bool bAtTakeOff = FMath::Abs(Link->FromX - Location.X) <= this->LinkTakeOffTolerance;
+		MoveToX = bAtTakeOff || Movement->IsFalling() ? Link->ToX : Link->FromX;
+		if (bAtTakeOff && Link->Type == EPlatformNavLinkType::Jump && !Movement->IsFalling())
+		{
+			AICharacter->Jump();
+		}
+	}
+	else if (SelfNode != INDEX_NONE && SelfNode == GoalNode)
+	{
+		if (FMath::Abs(TargetLocation.X - Location.X) <= this->AcceptanceRadius) return;
+		MoveToX = TargetLocation.X;
+	}
+	else
+	{
+		// the player cannot be reached; get as close as the pawn's own platform allows
+		const FPlatformNavNode* Node = Navigation->GetNode(SelfNode);
+		MoveToX = Node ? FMath::Clamp(TargetLocation.X, Node->MinX, Node->MaxX) : TargetLocation.X;
+	}
+
+	if (FMath::Abs(MoveToX - Location.X) > 1.f)
+	{
+		AIPawn->AddMovementInput(FVector(FMath::Sign(MoveToX - Location.X), 0.f, 0.f));
+	}
+}
+
+/**
+ * Works out what the pawn can do from its character movement: the height of a jump is v^2 / 2g, and its reach is the
+ * walk speed over the time in the air, 2v / g.
+ *
+ * @return What the pawn can do. Jumps nothing if the pawn is not a character.
+ */
+FPlatformNavAgent APC_AIController::GetPlatformNavAgent() const
+{
+	FPlatformNavAgent Agent;
+	const ACharacter* AICharacter = Cast<ACharacter>(this->GetPawn());
+	const UCharacterMovementComponent* Movement = AICharacter ? AICharacter->GetCharacterMovement() : nullptr;
+	if (Movement == nullptr || !Movement->CanEverJump()) return Agent;
+
+	const float Gravity = FMath::Max(FMath::Abs(Movement->GetGravityZ()), KINDA_SMALL_NUMBER);
+	const float JumpVelocity = Movement->JumpZVelocity;
+	Agent.MaxJumpHeight = JumpVelocity * JumpVelocity / (2.f * Gravity);
+	Agent.MaxJumpDistance = Movement->MaxWalkSpeed * 2.f * JumpVelocity / Gravity;
+	Agent.bCanClimbLadders = false;
+	return Agent;
+}
+
 /**
  * Updates the focus pawn for the AI controller.
  *
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "SideScroller/Navigation/PlatformNavGraph.h"
 #include "PC_AIController.generated.h"
 
 /**
@@ -95,6 +96,27 @@ private:
 	 */
 	bool CanShoot = true;
 
+	/**
+	 * @brief How close to the player pawn the pawn stops.
+	 */
+	float AcceptanceRadius = 200.f;
+
+	/**
+	 * @brief How close to a link's take-off point the pawn has to be to take the link.
+	 */
+	float LinkTakeOffTolerance = 16.f;
+
+	/**
+	 * @brief The links of the platform path being followed, in order, and the index of the next one to take.
+	 */
+	TArray<int32> PathLinks;
+	int32 PathIndex = 0;
+
+	/**
+	 * @brief The platform the player pawn stood on when the path was found, or INDEX_NONE for no path.
+	 */
+	int32 PathGoalNode = INDEX_NONE;
+
 protected:
 	/**
 	 * \brief Called when the game starts or when spawned.
@@ -119,4 +141,16 @@ protected:
 	 */
 	UFUNCTION(BlueprintCallable)
 	void FocusOnPawn();
+
+	/**
+	 * @brief Moves the pawn toward the player pawn, along the level's platform navigation graph unless it flies.
+	 */
+	void MoveTowardPlayer();
+
+	/**
+	 * @brief Works out how high and far the pawn can jump from its character movement.
+	 *
+	 * @return What the pawn can do on the platform navigation graph.
+	 */
+	FPlatformNavAgent GetPlatformNavAgent() const;
 };
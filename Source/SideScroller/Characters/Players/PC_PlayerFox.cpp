@@ -1,5 +1,6 @@
 #include "PC_PlayerFox.h"
 
+#include "EngineUtils.h"
 #include "PaperFlipbookComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/InputComponent.h"
@@ -8,13 +9,38 @@
 #include "Camera/CameraComponent.h"
 #include "Components/TextBlock.h"
 #include "GameFramework/SpringArmComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "SideScroller/SideScrollerGameInstance.h"
+#include "SideScroller/Controllers/GameModePlayerController.h"
 #include "SideScroller/GameModes/SideScrollerGameModeBase.h"
 #include "SideScroller/GameStates/LevelGameState.h"
 #include "SideScroller/GameStates/LobbyGameState.h"
+#include "SideScroller/MenuSystem/PlayerHUDViewModel.h"
+#include "SideScroller/MenuSystem/PlayerHUDWidget.h"
+#include "SideScroller/Replay/InputRecording.h"
 #include "SideScroller/SaveGames/SideScrollerSaveGame.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Triggers/CheckpointTrigger.h"
+
+namespace PlayerFox
+{
+	/**
+	 * Checks whether one of the level's checkpoints is at the given location.
+	 *
+	 * @param World The world of the level.
+	 * @param Location The location to check.
+	 * @return True if an ACheckpointTrigger's checkpoint location is within a unit of Location.
+	 */
+	static bool IsCheckpointLocation(const UWorld* World, const FVector& Location)
+	{
+		for (TActorIterator<ACheckpointTrigger> It(World); It; ++It)
+		{
+			if (It->GetCheckpointLocation().Equals(Location, 1.f)) return true;
+		}
+		return false;
+	}
+}
 
 /**
  * APC_PlayerFox Constructor.
@@ -58,6 +84,9 @@ APC_PlayerFox::APC_PlayerFox()
 	this->GetSprite()->SetIsReplicated(true);
 	this->GetCharacterMovement()->SetIsReplicated(true);
 	this->SetReplicates(true);
+	this->NetUpdateFrequency = 60.f;
+	this->MinNetUpdateFrequency = 15.f;
+	this->NetPriority = 3.f;
 	this->CurrentRotation = MovingLeftRotation;
 	this->LastRotation = this->CurrentRotation;
 }
@@ -88,7 +117,6 @@ void APC_PlayerFox::BeginPlay()
 	GameInstance = dynamic_cast<USideScrollerGameInstance*>(GetGameInstance());
 	AddToPlayersArray();
 	LoadProfilePlayerName();
-	PlayerHUDSetup();
 	PlayerGameMessageSetup();
 
 	this->NameBanner->SetText(GetPlayerName());
@@ -105,8 +133,30 @@ void APC_PlayerFox::BeginPlay()
 	);
 }
 
+/**
+ * @brief Sets up the HUD once the pawn is possessed by the local player controller and applies the saved progression.
+ */
+void APC_PlayerFox::PawnClientRestart()
+{
+	Super::PawnClientRestart();
+	this->PlayerHUDSetup();
+	this->ApplySavedProgression();
+}
+
+/**
+ * @brief Unbinds the HUD view model before the pawn leaves play.
+ *
+ * @param EndPlayReason Why the pawn is leaving play.
+ */
+void APC_PlayerFox::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	this->UnbindHUDViewModel();
+	Super::EndPlay(EndPlayReason);
+}
+
 void APC_PlayerFox::Tick(const float DeltaTime)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaTime);
 
 	// CumulativeTime += DeltaTime;
@@ -147,6 +197,24 @@ void APC_PlayerFox::SetupPlayerInputComponent(UInputComponent* PlayerInputCompon
 	PlayerInputComponent->BindAction("SpectatePrevPlayer", IE_Pressed, this, &APC_PlayerFox::SpectatePrevPlayer);
 }
 
+/**
+ * Calls the handlers of the recorded axes every frame, and those of the recorded buttons, in the order the input
+ * component would.
+ *
+ * @param Frame The recorded input of one frame.
+ */
+void APC_PlayerFox::ApplyRecordedInput(const FRecordedInputFrame& Frame)
+{
+	this->MoveRight(Frame.MoveRight);
+	this->ClimbUpAxisInputCallback(Frame.ClimbUp);
+
+	if (Frame.Buttons & ERecordedInputButton::Jump) this->Jump();
+	if (Frame.Buttons & ERecordedInputButton::Shoot) this->Shoot();
+	if (Frame.Buttons & ERecordedInputButton::Use) this->UseAction();
+	if (Frame.Buttons & ERecordedInputButton::RunPressed) this->SetRunVelocity();
+	if (Frame.Buttons & ERecordedInputButton::RunReleased) this->SetWalkVelocity();
+}
+
 /**
  * @brief Displays a level welcome message.
  *
@@ -180,10 +248,11 @@ void APC_PlayerFox::DoLevelWelcome()
 		const FString GameMessage = FString::Printf( TEXT("Level %i Begin!"), GameState->GetCurrentLevel());
 		DisplayGameMessage(FText::FromString(GameMessage));
 		
-		UGameplayStatics::SpawnSoundAttached(
+		UAudioPoolSubsystem::PlayAttached(
+			this,
 			this->LevelStartSound,
 			this->GetSprite(),
-			TEXT("StartLevelSound")
+			EAudioEventCategory::Level
 		);
 
 		GetWorld()->GetTimerManager().SetTimer(
@@ -239,9 +308,17 @@ void APC_PlayerFox::LoadProfilePlayerName()
 	{
 		if (!bPlayerNameSet)
 		{
-			if (CurrentRole == ROLE_Authority || CurrentRole == ROLE_AutonomousProxy)
+			// the profile is loaded asynchronously; if it is not ready yet, UpdateNameBanner tries again next tick
+			const USideScrollerSaveGame* PlayerProfile = GameInstance->GetPlayerProfile();
+			if (PlayerProfile == nullptr)
 			{
-				this->PlayerName = GameInstance->GetPlayerProfile()->PlayerName;
+				UE_LOG(LogTemp, Verbose,
+					TEXT("APC_PlayerFox::LoadProfilePlayerName - PlayerProfile not loaded yet. Trying again later.")
+				);
+			}
+			else if (CurrentRole == ROLE_Authority || CurrentRole == ROLE_AutonomousProxy)
+			{
+				this->PlayerName = PlayerProfile->PlayerName;
 				this->bPlayerNameSet = true;
 			}
 		}
@@ -274,9 +351,10 @@ void APC_PlayerFox::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & Ou
 	DOREPLIFETIME(APC_PlayerFox, bOnLadder);
 	DOREPLIFETIME(APC_PlayerFox, CurrentRotation);
 	DOREPLIFETIME(APC_PlayerFox, PlayerName);
-	DOREPLIFETIME(APC_PlayerFox, WalkSound);
 	DOREPLIFETIME(APC_PlayerFox, AccumulatedPoints);
 	DOREPLIFETIME(APC_PlayerFox, NumberOfLives);
+	DOREPLIFETIME_CONDITION(APC_PlayerFox, CherryStash, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(APC_PlayerFox, MoneyStash, COND_OwnerOnly);
 	DOREPLIFETIME(APC_PlayerFox, bIsOutOfLives);
 }
 
@@ -288,6 +366,7 @@ int APC_PlayerFox::GetAccumulatedPoints() const
 void APC_PlayerFox::SetAccumulatedPoints(const int Points)
 {
 	this->AccumulatedPoints = Points;
+	this->NotifyHUDStatsChanged();
 }
 
 int APC_PlayerFox::GetNumberOfLives() const
@@ -298,6 +377,7 @@ int APC_PlayerFox::GetNumberOfLives() const
 void APC_PlayerFox::SetNumberOfLives(const int NumLives)
 {
 	this->NumberOfLives = NumLives;
+	this->NotifyHUDStatsChanged();
 }
 
 int APC_PlayerFox::GetCherryCount() const
@@ -308,6 +388,7 @@ int APC_PlayerFox::GetCherryCount() const
 void APC_PlayerFox::SetCherryStash(int NumCherries)
 {
 	this->CherryStash = NumCherries;
+	this->NotifyHUDStatsChanged();
 }
 
 int APC_PlayerFox::GetMoneyCount() const
@@ -318,6 +399,7 @@ int APC_PlayerFox::GetMoneyCount() const
 void APC_PlayerFox::SetMoneyStash(const int MoneyAmount)
 {
 	this->MoneyStash = MoneyAmount;
+	this->NotifyHUDStatsChanged();
 }
 
 void APC_PlayerFox::SetLastCheckpointLocation(const FVector& Location)
@@ -325,6 +407,94 @@ void APC_PlayerFox::SetLastCheckpointLocation(const FVector& Location)
 	this->LastCheckpointLocation = Location;
 }
 
+/**
+ * @brief Autosaves the locally controlled player's progression.
+ *
+ * @param Level The level to record as the player's current level.
+ * @param bAtCheckpoint Whether the player should resume at Checkpoint rather than at the level start.
+ * @param Checkpoint The location of the checkpoint the player reached.
+ */
+void APC_PlayerFox::AutosaveProgression(int Level, bool bAtCheckpoint, const FVector& Checkpoint) const
+{
+	if (!IsLocallyControlled()) return;
+
+	USideScrollerGameInstance* SideScrollerGameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (SideScrollerGameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("APC_PlayerFox::AutosaveProgression - No GameInstance. Not autosaving progression.")
+		);
+		return;
+	}
+
+	FProgressionRecord Record;
+	Record.Points = this->AccumulatedPoints;
+	Record.Lives = this->NumberOfLives;
+	Record.Cherries = this->CherryStash;
+	Record.Money = this->MoneyStash;
+	Record.Level = Level;
+	Record.bHasCheckpoint = bAtCheckpoint;
+	Record.Checkpoint = bAtCheckpoint ? Checkpoint : FVector::ZeroVector;
+	SideScrollerGameInstance->SaveProgression(Record);
+}
+
+/**
+ * @brief Resumes the host profile's saved progression for the current level on the server.
+ */
+void APC_PlayerFox::ApplySavedProgression()
+{
+	if (!HasAuthority() || !IsLocallyControlled()) return;
+
+	USideScrollerGameInstance* SideScrollerGameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	const ASideScrollerGameState* GameState = GetWorld()->GetGameState<ASideScrollerGameState>();
+	if (SideScrollerGameInstance == nullptr || GameState == nullptr) return;
+
+	FProgressionRecord Record;
+	if (!SideScrollerGameInstance->ConsumeSavedProgression(GetWorld(), GameState->GetCurrentLevel(), Record)) return;
+
+	UE_LOG(LogTemp, Display,
+		TEXT("APC_PlayerFox::ApplySavedProgression - Resuming level %i with %i lives and %i points%s."),
+		Record.Level, Record.Lives, Record.Points, Record.bHasCheckpoint ? TEXT(" at the last checkpoint") : TEXT("")
+	);
+	ApplyProgression(Record);
+}
+
+/**
+ * @brief Restores a saved progression.
+ *
+ * The counters go through their setters so the HUD stats replicate, and a checkpoint becomes the player's
+ * LastCheckpointLocation and is where the player is put, just like a revive.
+ *
+ * @param Record The saved progression.
+ */
+void APC_PlayerFox::ApplyProgression(const FProgressionRecord& Record)
+{
+	// a saved game over is not worth resuming; keep the lives the player starts the level with
+	if (Record.Lives > 0)
+	{
+		this->SetNumberOfLives(Record.Lives);
+	}
+	this->SetAccumulatedPoints(FMath::Max(Record.Points, 0));
+	this->SetCherryStash(FMath::Max(Record.Cherries, 0));
+	this->SetMoneyStash(FMath::Max(Record.Money, 0));
+
+	if (Record.bHasCheckpoint && !PlayerFox::IsCheckpointLocation(GetWorld(), Record.Checkpoint))
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("APC_PlayerFox::ApplyProgression - No checkpoint at %s. Starting at the level start."),
+			*Record.Checkpoint.ToString()
+		);
+	}
+	else if (Record.bHasCheckpoint)
+	{
+		this->SetLastCheckpointLocation(Record.Checkpoint);
+		this->SetActorLocation(
+			Record.Checkpoint + RespawnLocationOffset, false, nullptr, ETeleportType::ResetPhysics
+		);
+		this->GetMovementComponent()->StopMovementImmediately();
+	}
+}
+
 /**
  * @brief Prints the list of players.
  *
@@ -393,11 +563,25 @@ void APC_PlayerFox::DoLevelCompleteMulticastRPC_Implementation()
 	
 	const FString GameMessage = FString::Printf( TEXT("Level %i Complete!"), GameState->GetCurrentLevel());
 	DisplayGameMessage(FText::FromString(GameMessage));
+
+	// every machine saves its own local players, not just the one who reached the end; the next level starts from
+	// its beginning
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr || !PlayerController->IsLocalController()) continue;
+
+		if (const APC_PlayerFox* LocalPlayer = Cast<APC_PlayerFox>(PlayerController->GetPawn()))
+		{
+			LocalPlayer->AutosaveProgression(GameState->GetCurrentLevel() + 1, false, FVector::ZeroVector);
+		}
+	}
 		
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->LevelCompleteSound,
 		this->GetSprite(),
-		TEXT("CompleteLevelSound")
+		EAudioEventCategory::Level
 	);
 
 	GetWorld()->GetTimerManager().SetTimer(
@@ -796,6 +980,7 @@ void APC_PlayerFox::PlayerDeath_Implementation()
 	{
 		// take a life away
 		this->NumberOfLives -= 1;
+		this->NotifyHUDStatsChanged();
 		OpenRespawnMenuRPC();
 	} else {
 		this->RemoveFromPlayersArray();
@@ -821,6 +1006,7 @@ void APC_PlayerFox::HandleFallOffLevel()
  *
  * This method is responsible for updating the character's sprite flipbook to the run animation
  * if it is different from the current flipbook, and playing a walking sound every `FramesPerStep` frames.
+ * The sound only plays when the flipbook reaches a step frame, not on every tick it stays on it.
  *
  * @note This method assumes that `RunAnimation` is a valid flipbook and `WalkSound` is a valid sound.
  *
@@ -828,20 +1014,26 @@ void APC_PlayerFox::HandleFallOffLevel()
  *
  * @return None.
  *
- * @see GetSprite, SetFlipbook, GetPlaybackPositionInFrames, FramesPerStep, UGameplayStatics::SpawnSoundAttached
+ * @see GetSprite, SetFlipbook, GetPlaybackPositionInFrames, FramesPerStep, UAudioPoolSubsystem::PlayAttached
  */
 void APC_PlayerFox::DoWalkAnimAndSound()
 {
 	if (this->GetSprite()->GetFlipbook() != RunAnimation) {
 		this->GetSprite()->SetFlipbook(RunAnimation);
+		this->LastStepSoundFrame = INDEX_NONE;
 	}
-			
-	if (this->GetSprite()->GetPlaybackPositionInFrames() % this->FramesPerStep == 0) {
+
+	const int32 Frame = this->GetSprite()->GetPlaybackPositionInFrames();
+	if (Frame == this->LastStepSoundFrame) return;
+	this->LastStepSoundFrame = Frame;
+
+	if (Frame % this->FramesPerStep == 0) {
 		// UE_LOG(LogTemp, VeryVerbose, TEXT("Playing %s's walking sound!"), *this->GetName());
-		UGameplayStatics::SpawnSoundAttached(
+		UAudioPoolSubsystem::PlayAttached(
+			this,
 			this->WalkSound,
 			this->GetSprite(),
-			TEXT("PaperCharacterSpriteWalk")
+			EAudioEventCategory::Footstep
 		);
 	}
 }
@@ -858,13 +1050,22 @@ void APC_PlayerFox::DoClimbAnimAndSound()
 			this->GetSprite()->SetFlipbook(StopOnLadderAnimation);
 		}
 	} else {
-		if (this->GetSprite()->GetFlipbook() != ClimbAnimation) this->GetSprite()->SetFlipbook(ClimbAnimation);
-		if (this->GetSprite()->GetPlaybackPositionInFrames() == 0) {
+		if (this->GetSprite()->GetFlipbook() != ClimbAnimation) {
+			this->GetSprite()->SetFlipbook(ClimbAnimation);
+			this->LastClimbSoundFrame = INDEX_NONE;
+		}
+
+		const int32 Frame = this->GetSprite()->GetPlaybackPositionInFrames();
+		if (Frame == this->LastClimbSoundFrame) return;
+		this->LastClimbSoundFrame = Frame;
+
+		if (Frame == 0) {
 			// UE_LOG(LogTemp, VeryVerbose, TEXT("Playing %s's climbing sound!"), *this->GetName());
-			UGameplayStatics::SpawnSoundAttached(
+			UAudioPoolSubsystem::PlayAttached(
+				this,
 				this->NearbyClimbableSound,
 				this->GetSprite(),
-				TEXT("ClimbingSound")
+				EAudioEventCategory::Footstep
 			);
 		}
 	}
@@ -888,10 +1089,34 @@ void APC_PlayerFox::RemoveFromPlayersArray()
 	}
 }
 
+/**
+ * @brief Sets up the HUD of the locally controlled pawn.
+ *
+ * Binds the local controller's HUD view model to this pawn, creates the HUD widget once and hands it the view
+ * model every time. Pawns controlled by other players, or by nobody, get no HUD.
+ */
 void APC_PlayerFox::PlayerHUDSetup()
 {
-	if (WidgetPlayerHUD) {
-		this->WidgetPlayerHUDInstance = CreateWidget<UUserWidget>(GetWorld(), WidgetPlayerHUD);
+	if (!this->IsLocallyControlled()) return;
+
+	AGameModePlayerController* PlayerController = Cast<AGameModePlayerController>(this->GetController());
+	UPlayerHUDViewModel* ViewModel = PlayerController != nullptr ? PlayerController->GetHUDViewModel() : nullptr;
+	if (ViewModel != nullptr)
+	{
+		ViewModel->BindToPlayer(this);
+	}
+
+	if (this->WidgetPlayerHUDInstance == nullptr && WidgetPlayerHUD)
+	{
+		this->WidgetPlayerHUDInstance = CreateWidget<UUserWidget>(PlayerController, WidgetPlayerHUD);
+	}
+	// on every setup, not only when the widget is created, in case the controller's view model changed meanwhile
+	if (UPlayerHUDWidget* PlayerHUDWidget = Cast<UPlayerHUDWidget>(this->WidgetPlayerHUDInstance))
+	{
+		PlayerHUDWidget->SetViewModel(ViewModel);
+	}
+	if (this->WidgetPlayerHUDInstance != nullptr && !this->WidgetPlayerHUDInstance->IsInViewport())
+	{
 		this->WidgetPlayerHUDInstance->AddToViewport();
 	}
 }
@@ -914,8 +1139,9 @@ void APC_PlayerFox::PlayerHUDTeardown()
 			TEXT("APC_PlayerFox::PlayerHUDTeardown - Tearing down WidgetPlayerHUDInstance")
 		)
 		this->WidgetPlayerHUDInstance->RemoveFromParent();
+		this->UnbindHUDViewModel();
 	}
-	else
+	else if (this->IsLocallyControlled())
 	{
 		UE_LOG(LogTemp, Warning,
 			TEXT("APC_PlayerFox::PlayerHUDTeardown - WidgetPlayerHUDInstance is null")
@@ -923,6 +1149,44 @@ void APC_PlayerFox::PlayerHUDTeardown()
 	}
 }
 
+/**
+ * @brief Stops the local controller's HUD view model from showing this pawn.
+ *
+ * Does nothing once the pawn lost its controller; the view model only holds a weak pointer to the pawn then.
+ */
+void APC_PlayerFox::UnbindHUDViewModel()
+{
+	if (!this->IsLocallyControlled()) return;
+
+	if (AGameModePlayerController* PlayerController = Cast<AGameModePlayerController>(this->GetController()))
+	{
+		PlayerController->GetHUDViewModel()->UnbindFromPlayer(this);
+	}
+}
+
+/**
+ * @brief Broadcasts OnHUDStatsChanged, so the HUD view model can push the new values to the HUD.
+ *
+ * On the server the stats are replicated, so it also forces a net update: a player standing still has been backed off
+ * to its MinNetUpdateFrequency by the replication graph and would otherwise send the new values late.
+ */
+void APC_PlayerFox::NotifyHUDStatsChanged()
+{
+	if (this->HasAuthority()) this->ForceNetUpdate();
+	this->OnHUDStatsChanged.Broadcast(this);
+}
+
+void APC_PlayerFox::OnRep_HUDStats()
+{
+	this->NotifyHUDStatsChanged();
+}
+
+void APC_PlayerFox::OnHealthChanged()
+{
+	Super::OnHealthChanged();
+	this->NotifyHUDStatsChanged();
+}
+
 /**
  * @brief Tears down the PlayerMessageWidget.
  *
@@ -1057,6 +1321,7 @@ bool APC_PlayerFox::SendRotationToServer_Validate(const float Value)
 void APC_PlayerFox::SendPlayerNameToServer_Implementation(const FString& ClientPlayerName)
 {
 	this->PlayerName = ClientPlayerName;
+	this->ForceNetUpdate();
 }
 
 bool APC_PlayerFox::SendPlayerNameToServer_Validate(const FString& ClientPlayerName)
@@ -1427,6 +1692,16 @@ TArray<APC_PlayerFox*> APC_PlayerFox::GetSpectators() const
 	return this->Spectators;
 }
 
+/**
+ * Returns the player this player is spectating.
+ *
+ * @return The spectated player, or nullptr if this player is not spectating anyone.
+ */
+APC_PlayerFox* APC_PlayerFox::GetPlayerBeingSpectated() const
+{
+	return this->PlayerBeingSpectated;
+}
+
 /**
  * SetSpectatorsStr method sets the SpectatorsStr member variable of the APC_PlayerFox class.
  * The SpectatorsStr is a string that represents all the spectators of the APC_PlayerFox instance.
@@ -1641,10 +1916,11 @@ void APC_PlayerFox::Jump()
 	
 	// dont allow another jump unless not currently jumping
 	if (!this->bIsFalling && !this->bOnLadder) {
-		UGameplayStatics::SpawnSoundAttached(
+		UAudioPoolSubsystem::PlayAttached(
+			this,
 			this->JumpSound,
 			this->GetSprite(),
-			TEXT("PaperCharacterSpriteJump")
+			EAudioEventCategory::Character
 		);
 		Super::Jump();
 	}
@@ -1658,6 +1934,7 @@ void APC_PlayerFox::Jump()
 void APC_PlayerFox::TakeMoney(int MonetaryValue)
 {
 	this->MoneyStash += MonetaryValue;
+	this->NotifyHUDStatsChanged();
 	UE_LOG(LogTemp, Verbose,
 		TEXT("%s's money stash is now %i!"), *this->GetName(), this->MoneyStash
 	);
@@ -1699,6 +1976,7 @@ void APC_PlayerFox::TakeHealing(const float HealingValue)
 void APC_PlayerFox::TakeCherries(int NumCherries)
 {
 	this->CherryStash += NumCherries;
+	this->NotifyHUDStatsChanged();
 	UE_LOG(LogTemp, Verbose,
 		TEXT("%s's cherry stash has increased to %d!"),
 		*this->GetName(),
@@ -7,6 +7,7 @@
 #include "Components/TextRenderComponent.h"
 #include "SideScroller/Interfaces/InteractInterface.h"
 #include "SideScroller/Interfaces/ProjectileInterface.h"
+#include "SideScroller/SaveGames/ProgressionRecord.h"
 #include "PC_PlayerFox.generated.h"
 
 
@@ -20,6 +21,16 @@ class ASideScrollerGameModeBase;
  *
  */
 class USideScrollerGameInstance;
+struct FRecordedInputFrame;
+
+class APC_PlayerFox;
+
+/**
+ * @brief Broadcast when any of the stats shown on the player's HUD changed.
+ *
+ * @param Player The player whose stats changed.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerHUDStatsChanged, APC_PlayerFox*);
 
 /**
  * @class APC_PlayerFox
@@ -175,6 +186,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Spectators")
 	TArray<APC_PlayerFox*> GetSpectators() const;
 
+	/**
+	 * @brief Get the player this player is spectating.
+	 *
+	 * @return The spectated player, or nullptr if this player is not spectating anyone.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Spectators")
+	APC_PlayerFox* GetPlayerBeingSpectated() const;
+
 	/**
 	 * \brief Add a player to the list of spectators.
 	 *
@@ -548,6 +567,15 @@ public:
 	 */
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 
+	/**
+	 * @brief Feeds one frame of recorded input through the handlers the input bindings call.
+	 *
+	 * Used by UInputReplaySubsystem to play an input recording back in place of the player.
+	 *
+	 * @param Frame The recorded input of one frame.
+	 */
+	void ApplyRecordedInput(const FRecordedInputFrame& Frame);
+
 	/**
 	 * Loads the player name from the player profile and sets it to the PlayerName variable.
 	 * If the game instance is null, it sets the default PlayerName as the name of the current instance.
@@ -576,6 +604,30 @@ public:
 	 */
 	virtual void BeginPlay() override;
 
+	/**
+	 * @brief Sets up the HUD once the pawn is possessed by a local player controller and applies the saved
+	 * progression of the local player profile.
+	 *
+	 * Runs on the owning client (and on a listen server for its own pawn) after possession, so the HUD and its view
+	 * model only ever exist for the locally controlled pawn.
+	 */
+	virtual void PawnClientRestart() override;
+
+	/**
+	 * @brief Unbinds the HUD view model from the pawn before it goes away.
+	 *
+	 * @param EndPlayReason Why the pawn is leaving play.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * @brief Broadcast when the points, lives, cherries, money or health of the player changed.
+	 *
+	 * Fired from the setters on the server and from the OnReps on clients. The HUD view model listens to it instead
+	 * of the HUD polling the getters every frame.
+	 */
+	FOnPlayerHUDStatsChanged OnHUDStatsChanged;
+
 	/**
 	 * @brief Makes the player character jump.
 	 *
@@ -685,6 +737,38 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetLastCheckpointLocation(const FVector& Location);
 
+	/**
+	 * @brief Autosaves this player's progression to the local player profile.
+	 *
+	 * Only does something for the locally controlled player, since the progression record belongs to the profile of
+	 * the machine it is saved on. The points, lives, cherries and money are taken from this player and the write
+	 * happens in the background (see USideScrollerGameInstance::SaveProgression).
+	 *
+	 * @param Level The level to record as the player's current level.
+	 * @param bAtCheckpoint Whether the player should resume at Checkpoint rather than at the level start.
+	 * @param Checkpoint The location of the checkpoint the player reached.
+	 */
+	void AutosaveProgression(int Level, bool bAtCheckpoint, const FVector& Checkpoint) const;
+
+	/**
+	 * @brief Resumes the saved progression of the host's profile, if the host chose to continue this level.
+	 *
+	 * Only does something on the server, for the player it controls locally: the record is read from the server's
+	 * own profile, so no client can send one. See USideScrollerGameInstance::ConsumeSavedProgression.
+	 */
+	void ApplySavedProgression();
+
+	/**
+	 * @brief Restores the lives, points, cherries and money of a saved progression, and puts the player at its
+	 * checkpoint if one of the level's checkpoints is there.
+	 *
+	 * Negative counters are ignored, and so is a checkpoint that no ACheckpointTrigger of the level matches, for
+	 * instance after the level was edited.
+	 *
+	 * @param Record The saved progression.
+	 */
+	void ApplyProgression(const FProgressionRecord& Record);
+
 	/**
 	 * Begins spectating the next player in the given game mode.
 	 *
@@ -945,10 +1029,10 @@ private:
 	int32 FramesPerStep = 12;
 
 	/**
-	 * WidgetPlayerHUDInstance is a replicated editable property that represents an instance of a user widget used for
-	 * player HUD.
+	 * WidgetPlayerHUDInstance is the instance of the user widget used for the player HUD. Only created for the
+	 * locally controlled pawn.
 	 */
-	UPROPERTY(EditAnywhere, replicated)
+	UPROPERTY()
 	UUserWidget* WidgetPlayerHUDInstance;
 
 	/**
@@ -992,7 +1076,7 @@ private:
 	 * of lives a player has. It is editable anywhere and can be replicated across
 	 * multiple instances of the game.
 	 */
-	UPROPERTY(EditAnywhere, replicated)
+	UPROPERTY(EditAnywhere, ReplicatedUsing=OnRep_HUDStats)
 	int NumberOfLives = 5;
 
 	/**
@@ -1000,7 +1084,7 @@ private:
 	 *
 	 * This variable is used to store the total accumulated points.
 	 */
-	UPROPERTY(EditAnywhere, replicated)
+	UPROPERTY(EditAnywhere, ReplicatedUsing=OnRep_HUDStats)
 	int AccumulatedPoints = 0;
 
 	/**
@@ -1098,9 +1182,9 @@ private:
 	 *
 	 * The CherryStash variable is an integer that stores the number of cherries in a stash.
 	 * It is defined as a UPROPERTY(EditAnywhere) which means it can be edited in the Unreal Engine editor.
-	 * The initial value of CherryStash is 0.
+	 * The initial value of CherryStash is 0. Only replicated to the owning client, whose HUD shows it.
 	 */
-	UPROPERTY(EditAnywhere)
+	UPROPERTY(EditAnywhere, ReplicatedUsing=OnRep_HUDStats)
 	int CherryStash = 0;
 
 	/**
@@ -1112,9 +1196,11 @@ private:
 	 * Example usage:
 	 *     MoneyStash = 1000;
 	 *
+	 * Only replicated to the owning client, whose HUD shows it.
+	 *
 	 * @see IncreaseMoney(), DecreaseMoney()
 	 */
-	UPROPERTY(EditAnywhere)
+	UPROPERTY(EditAnywhere, ReplicatedUsing=OnRep_HUDStats)
 	int MoneyStash = 0;
 
 	/**
@@ -1132,14 +1218,15 @@ private:
 	 *
 	 * This variable represents the sound that will be played when the character is walking.
 	 * It is an instance of the USoundBase class and can be modified in the editor.
-	 * The sound is also replicated to all clients in a networked game environment.
+	 * The sound is not replicated: every machine plays the footsteps of the walk animation it shows from its own
+	 * copy of the asset.
 	 *
 	 * @see USoundBase
 	 *
 	 * @note This variable should be set to a valid sound asset in order for the character's walking sound to be played
 	 * correctly.
 	 */
-	UPROPERTY(EditAnywhere, replicated)
+	UPROPERTY(EditAnywhere)
 	USoundBase* WalkSound;
 
 	/**
@@ -1904,4 +1991,36 @@ protected:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UpdateAnimationProperties")
 	void UpdateNameBanner();
+
+	/**
+	 * @brief Tells the HUD that the player's health changed.
+	 */
+	virtual void OnHealthChanged() override;
+
+private:
+	/**
+	 * @brief Called on clients when one of the replicated HUD stats arrived.
+	 */
+	UFUNCTION()
+	void OnRep_HUDStats();
+
+	/**
+	 * @brief Broadcasts OnHUDStatsChanged, and forces a net update on the server so the new stats go out right away.
+	 */
+	void NotifyHUDStatsChanged();
+
+	/**
+	 * @brief Stops the local controller's HUD view model from showing this pawn.
+	 */
+	void UnbindHUDViewModel();
+
+	/**
+	 * @brief The run animation frame the last footstep check ran on, so a step plays once per frame change.
+	 */
+	int32 LastStepSoundFrame = INDEX_NONE;
+
+	/**
+	 * @brief The climb animation frame the last climbing sound check ran on.
+	 */
+	int32 LastClimbSoundFrame = INDEX_NONE;
 };
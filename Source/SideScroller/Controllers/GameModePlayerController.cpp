@@ -5,8 +5,11 @@
 
 #include "SideScroller/SideScrollerGameInstance.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/DataAssets/CharacterRoster.h"
 #include "SideScroller/GameModes/LevelGameMode.h"
 #include "SideScroller/GameModes/LobbyGameMode.h"
+#include "SideScroller/GameStates/LobbyGameState.h"
+#include "SideScroller/MenuSystem/PlayerHUDViewModel.h"
 #include "SideScroller/PlayerStates/PlayerFoxState.h"
 
 /**
@@ -28,56 +31,72 @@ void AGameModePlayerController::BeginPlay()
 }
 
 /**
- * Triggers the travel to the next level.
+ * Gets the view model behind the local player's HUD, creating it on first use.
  *
- * @param None.
- *
- * @return None.
+ * @return The HUD view model of this controller.
  */
-void AGameModePlayerController::TravelToLevel_Implementation()
+UPlayerHUDViewModel* AGameModePlayerController::GetHUDViewModel()
 {
-	USideScrollerGameInstance* GameInstance = dynamic_cast<USideScrollerGameInstance*>(GetGameInstance());
-	if (GameInstance == nullptr)
-	{
-		UE_LOG(LogTemp, Error,
-			TEXT("AGameModePlayerController::TravelToLevel_Implementation - No GameInstance.")
-		);
-		return;  // no game instance - early return
-	}
-	
-	if (GameInstance->IsReadyToStartGame())
+	if (this->HUDViewModel == nullptr)
 	{
-		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::TravelToLevel_Implementation - Starting game! All players ready.")
-		);
-		this->StartLevel();
+		this->HUDViewModel = NewObject<UPlayerHUDViewModel>(this);
 	}
-	else
+	return this->HUDViewModel;
+}
+
+/**
+ * Plays the cosmetic cues the server batched for this player.
+ *
+ * @param Cues The cues, in the order they happened on the server.
+ */
+void AGameModePlayerController::ClientReceiveCosmeticCues_Implementation(const TArray<FCosmeticCue>& Cues)
+{
+	if (const UCosmeticCueSubsystem* CosmeticCues = GetWorld()->GetSubsystem<UCosmeticCueSubsystem>())
 	{
-		UE_LOG(LogTemp, Display,
-			TEXT("USelectCharacterMenu::SelectPlayer - Not starting game! All players not ready.")
-		);
+		CosmeticCues->ReceiveCues(Cues);
 	}
 }
 
 /**
- * @brief Validate if the player can travel to the level.
+ * Streams in the roster character of the given color and spawns it for the player controller once it is loaded.
  *
- * @return true if the validation is successful, false otherwise.
+ * @param PlayerColorStr The color of the picked character in the character roster.
+ * @param PlayerController The player controller associated with the player character.
  */
-bool AGameModePlayerController::TravelToLevel_Validate()
-{
-	return true;  // This will allow the RPC to be called
+void AGameModePlayerController::SpawnPlayer_Implementation(
+	const FString& PlayerColorStr,
+	APlayerController* PlayerController
+) {
+	USideScrollerGameInstance* SideScrollerGameInstance = GetGameInstance<USideScrollerGameInstance>();
+	if (SideScrollerGameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Error,
+			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - Not spawning %s char. No GameInstance."),
+			*PlayerColorStr
+		);
+		return;
+	}
+
+	const TWeakObjectPtr<APlayerController> WeakPlayerController = PlayerController;
+	SideScrollerGameInstance->LoadCharacterClass(
+		PlayerColorStr,
+		[WeakThis = TWeakObjectPtr<AGameModePlayerController>(this), WeakPlayerController, PlayerColorStr](
+			const TSubclassOf<APC_PlayerFox> PlayerBP
+		) {
+			if (!WeakThis.IsValid() || !WeakPlayerController.IsValid()) return;  // left while the class was loading
+			WeakThis->SpawnChosenCharacter(PlayerBP, PlayerColorStr, WeakPlayerController.Get());
+		}
+	);
 }
 
 /**
  * Spawns a player character with the given PlayerBP, PlayerColorStr, and PlayerController.
  *
- * @param PlayerBP The blueprint class of the player character to spawn.
+ * @param PlayerBP The loaded blueprint class of the player character to spawn.
  * @param PlayerColorStr The color string used for logging.
  * @param PlayerController The player controller associated with the player character.
  */
-void AGameModePlayerController::SpawnPlayer_Implementation(
+void AGameModePlayerController::SpawnChosenCharacter(
 	TSubclassOf<APC_PlayerFox> PlayerBP,
 	const FString& PlayerColorStr,
 	APlayerController* PlayerController
@@ -87,7 +106,7 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 	if (PlayerBP == nullptr)
 	{
 		UE_LOG(LogTemp, Error,
-			   TEXT("AGameModePlayerController::SpawnPlayer_Implementation - Not spawning %s char. No %sPlayerBP."),
+			   TEXT("AGameModePlayerController::SpawnChosenCharacter - Not spawning %s char. No PlayerBP loaded."),
 			   *PlayerColorStr
 		);
 		return;
@@ -97,7 +116,7 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 	if (World == nullptr)
 	{
 		UE_LOG(LogTemp, Error,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - Not spawning %s character. Cant find World."),
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - Not spawning %s character. Cant find World."),
 			*PlayerController->GetName()
 		)
 		return;  // dont go any further, cant find world
@@ -111,7 +130,7 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 	else
 	{
 		UE_LOG(LogTemp, Error,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - Cant save chosen char. No GameInstance")
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - Cant save chosen char. No GameInstance")
 		);
 	}
 	
@@ -119,7 +138,7 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 	if (PlayerControllerPawn == nullptr)
 	{
 		UE_LOG(LogTemp, Error,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - Cant spawn new pawn. %s's pawn not found."),
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - Cant spawn new pawn. %s's pawn not found."),
 			*PlayerController->GetName()
 		);
 		return;
@@ -137,13 +156,13 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 		APawn* PawnToBeReplaced = PlayerControllerPawn;
 
 		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - PlayerController, %s, unpossessing old pawn"),
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - PlayerController, %s, unpossessing old pawn"),
 			*PlayerController->GetName()
 		);
 		PlayerController->UnPossess();
 
 		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - PlayerController, %s, possessing new pawn"),
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - PlayerController, %s, possessing new pawn"),
 			*PlayerController->GetName()
 		);
 		PlayerController->Possess(NewCharacter);
@@ -153,9 +172,33 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
 		{
 			PlayerFoxState->SetHasChosenCharacter(true);	
 		}
+
+		if (PlayerFoxState != nullptr && !PlayerColorStr.IsEmpty())
+		{
+			PlayerFoxState->SetChosenCharacterColor(PlayerColorStr);
+		}
+
+		// mark the character as taken, so every lobby menu greys it out
+		ALobbyGameState* LobbyGameState = World->GetGameState<ALobbyGameState>();
+		const UCharacterRoster* CharacterRoster = SideScrollerGameInstance
+			? SideScrollerGameInstance->GetCharacterRoster()
+			: nullptr;
+		if (LobbyGameState != nullptr && CharacterRoster != nullptr)
+		{
+			LobbyGameState->ClaimCharacter(
+				PlayerController->PlayerState,
+				CharacterRoster->FindCharacterIndex(PlayerColorStr)
+			);
+		}
+
+		// the player is ready now, which may have been the last one the lobby was waiting for
+		if (ALobbyGameMode* LobbyGameMode = World->GetAuthGameMode<ALobbyGameMode>())
+		{
+			LobbyGameMode->CheckReadyToStart();
+		}
 		
 		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::SpawnPlayer_Implementation - PlayerController, %s, destroying old Pawn"),
+			TEXT("AGameModePlayerController::SpawnChosenCharacter - PlayerController, %s, destroying old Pawn"),
 			*PlayerController->GetName()
 		);
 		if (PawnToBeReplaced)
@@ -176,14 +219,12 @@ void AGameModePlayerController::SpawnPlayer_Implementation(
  *
  * This method is invoked to validate the parameters before spawning a player in the game mode of a player controller.
  *
- * @param PlayerBP The subclass of APC_PlayerFox representing the player blueprint.
  * @param PlayerColorStr The string representing the player color.
  * @param PlayerController The pointer to the player controller instance.
  *
  * @return True if the parameters are valid; false otherwise.
  */
 bool AGameModePlayerController::SpawnPlayer_Validate(
-	TSubclassOf<APC_PlayerFox> PlayerBP,
 	const FString& PlayerColorStr,
 	APlayerController* PlayerController
 ) {
@@ -191,148 +232,68 @@ bool AGameModePlayerController::SpawnPlayer_Validate(
 }
 
 /**
- * Checks if the game can start based on certain requirements.
- * If the game mode is not LobbyGameMode, then a warning is logged and the method returns.
- * If the number of players requirement is not fulfilled, then a message is displayed and the method returns.
- * If the game instance cannot be found, then an error is logged and the method returns.
- * If not all players have chosen their characters, then a message is displayed and the method returns.
- * If all prerequisites are met, a message is displayed and the game instance is set to ready to start the game.
+ * @brief Starts the next level in the game.
+ *
+ * This method is an implementation of the StartNextLevel_Implementation function in the AGameModePlayerController
+ * class. It gets the instance of the LevelGameMode and calls the StartNextLevel method on it to start the next
+ * level in the game. If the game mode is not a LevelGameMode, a warning log is printed and the method returns.
  *
  * @param None
  * @return None
  */
-void AGameModePlayerController::CheckGameStartReqs_Implementation()
+void AGameModePlayerController::StartNextLevel_Implementation()
 {
-	ALobbyGameMode* LobbyGameMode = Cast<ALobbyGameMode>(GetWorld()->GetAuthGameMode());
-	if (LobbyGameMode == nullptr)
+	ALevelGameMode* LevelGameMode = Cast<ALevelGameMode>(GetWorld()->GetAuthGameMode());
+	if (LevelGameMode == nullptr)
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("AGameModePlayerController::CheckGameStartReqs_Implementation - Game mode is not LobbyGameMode.")
-		)
-		return;  // need more players to start - early return - dont start game
-	}
-	
-	if (!LobbyGameMode->IsNumPlayersRequirementFulfilled())
-	{
-		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::CheckGameStartReqs_Implementation - Not enough players to start game.")
-		)
-		return;
-	}
-	
-	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
-	if (GameInstance == nullptr)
-	{
-		UE_LOG(LogTemp, Error,
-			TEXT("AGameModePlayerController::CheckGameStartReqs_Implementation - Cant find GameInstance.")
-		)
-		return;
-	}
-	
-	if (!GameInstance->IsEveryPlayersCharacterChosen())
-	{
-		UE_LOG(LogTemp, Display,
-			TEXT("AGameModePlayerController::CheckGameStartReqs_Implementation "
-				"- Not starting game, not all players have chosen theiir characters."
-			)
+			TEXT("AGameModePlayerController::StartNextLevel_Implementation - Game mode is not LevelGameMode.")
 		)
-		return;
+		return; 
 	}
 
-	UE_LOG(LogTemp, Display,
-		TEXT("AGameModePlayerController::CheckGameStartReqs_Implementation - Player Prereqs met, game can start.")
-	)
-	GameInstance->SetReadyToStartGame(true);
-}
-
-/**
- * @brief Validates the game start requirements.
- *
- * This method verifies if the game start requirements are met. It should
- * be called before starting the game to ensure that all necessary conditions
- * are satisfied.
- *
- * @return Returns a boolean value indicating whether the game start
- *         requirements are valid or not. True if the requirements are valid,
- *         false otherwise.
- *
- * @see AGameModePlayerController
- */
-bool AGameModePlayerController::CheckGameStartReqs_Validate()
-{
-	return true;  // This will allow the RPC to be called
+	LevelGameMode->StartNextLevel();
 }
 
 /**
- * @brief Starts the level in the game.
- *
- * This method is the implementation of starting the level in the game for the current player controller. It checks if
- * the game mode is a LobbyGameMode and if not, it logs a warning message and returns without starting the game.
- * If the game mode is a LobbyGameMode, it calls the StartGame() method of the LobbyGameMode to start the game.
- *
- * @param None.
- *
- * @return None.
+ * @brief Validates whether the method can be called to start the next level.
  *
- * @note This method assumes that the current player controller has a valid reference to the game mode.
- */
-void AGameModePlayerController::StartLevel_Implementation()
-{
-	ALobbyGameMode* LobbyGameMode = Cast<ALobbyGameMode>(GetWorld()->GetAuthGameMode());
-	if (LobbyGameMode == nullptr)
-	{
-		UE_LOG(LogTemp, Warning,
-			TEXT("AGameModePlayerController::StartLevel_Implementation - Game mode is not LobbyGameMode.")
-		)
-		return;  
-	}
-
-	LobbyGameMode->StartGame();
-}
-
-/**
- * @brief Validates if the start level operation can be performed.
+ * This method is used to determine if the RPC can be called to initiate the
+ * start of the next level. It always returns true, allowing the RPC to be called.
  *
- * @return True if start level operation can be performed, false otherwise.
+ * @return true if the method can be called to start the next level.
  */
-bool AGameModePlayerController::StartLevel_Validate()
+bool AGameModePlayerController::StartNextLevel_Validate()
 {
 	return true;  // This will allow the RPC to be called
 }
 
 /**
- * @brief Starts the next level in the game.
+ * @brief Restarts the current level in place on the server.
  *
- * This method is an implementation of the StartNextLevel_Implementation function in the AGameModePlayerController
- * class. It gets the instance of the LevelGameMode and calls the StartNextLevel method on it to start the next
- * level in the game. If the game mode is not a LevelGameMode, a warning log is printed and the method returns.
- *
- * @param None
- * @return None
+ * Gets the LevelGameMode and calls RestartLevel on it. If the game mode is not a LevelGameMode, a warning log is
+ * printed and the method returns.
  */
-void AGameModePlayerController::StartNextLevel_Implementation()
+void AGameModePlayerController::RestartLevel_Implementation()
 {
 	ALevelGameMode* LevelGameMode = Cast<ALevelGameMode>(GetWorld()->GetAuthGameMode());
 	if (LevelGameMode == nullptr)
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("AGameModePlayerController::StartNextLevel_Implementation - Game mode is not LevelGameMode.")
+			TEXT("AGameModePlayerController::RestartLevel_Implementation - Game mode is not LevelGameMode.")
 		)
-		return; 
+		return;
 	}
 
-	LevelGameMode->StartNextLevel();
+	LevelGameMode->RestartLevel();
 }
 
 /**
- * @brief Validates whether the method can be called to start the next level.
+ * @brief Validates whether the method can be called to restart the level.
  *
- * This method is used to determine if the RPC can be called to initiate the
- * start of the next level. It always returns true, allowing the RPC to be called.
- *
- * @return true if the method can be called to start the next level.
+ * @return true, allowing the RPC to be called.
  */
-bool AGameModePlayerController::StartNextLevel_Validate()
+bool AGameModePlayerController::RestartLevel_Validate()
 {
 	return true;  // This will allow the RPC to be called
 }
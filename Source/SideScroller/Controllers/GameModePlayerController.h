@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "SideScroller/Subsystems/CosmeticCueSubsystem.h"
 #include "GameModePlayerController.generated.h"
 
 /**
@@ -16,6 +17,7 @@
  * and collectibles, managing spectators, and handling player death and level completion.
  */
 class APC_PlayerFox;
+class UPlayerHUDViewModel;
 /**
  * @class AGameModePlayerController
  *
@@ -23,8 +25,8 @@ class APC_PlayerFox;
  * and is responsible for managing player related operations and interactions
  * within the game mode.
  *
- * It provides functionalities related to player spawning, checking game start requirements,
- * starting levels, and traveling to different levels.
+ * It provides functionalities related to player spawning and starting and restarting levels. Starting the game
+ * from the lobby is up to the lobby game mode, which counts down once every player is ready.
  */
 UCLASS()
 class SIDESCROLLER_API AGameModePlayerController : public APlayerController
@@ -33,40 +35,34 @@ class SIDESCROLLER_API AGameModePlayerController : public APlayerController
 
 public:
 	/**
-	 * Spawns a player with the given player blueprint, player color string, and player controller.
+	 * Spawns the roster character of the given color for the player controller.
 	 *
-	 * @param PlayerBP The player blueprint to spawn.
-	 * @param PlayerColorStr The color string for the player.
-	 * @param PlayerController The player controller to assign to the spawned player.
-	 */
-	UFUNCTION(BlueprintCallable, Server, Reliable, WithValidation)
-	void SpawnPlayer(
-		TSubclassOf<class APC_PlayerFox> PlayerBP,
-		const FString& PlayerColorStr,
-		APlayerController* PlayerController
-	);
-
-	/**
-	 * \brief Checks whether the game meet the requirements to start.
+	 * The server streams in the character's blueprint class through the game instance first, so only characters
+	 * that were actually picked are ever loaded, and spawns it once it arrived.
 	 *
-	 * This method is annotated with Unreal Engine macros to make it callable from Blueprint,
-	 * executed on the server, reliably replicated, and validated.
-	 *
-	 * \param None.
+	 * @param PlayerColorStr The color of the picked character in the character roster.
+	 * @param PlayerController The player controller to assign to the spawned player.
 	 *
-	 * \return None.
+	 * @see USideScrollerGameInstance::LoadCharacterClass
 	 */
 	UFUNCTION(BlueprintCallable, Server, Reliable, WithValidation)
-	void CheckGameStartReqs();
+	void SpawnPlayer(const FString& PlayerColorStr, APlayerController* PlayerController);
 
 	/**
-	 * @brief Starts a new level.
+	 * @brief Spawns the loaded character class for the player controller and swaps it in for its current pawn.
 	 *
-	 * This method is used to start a new level in the game.
-	 * It is a server-side function that is reliable and requires validation.
+	 * Must be called on the server. The level game mode calls it directly with the characters chosen in the lobby,
+	 * whose classes the game instance still holds loaded.
+	 *
+	 * @param PlayerBP The loaded blueprint class of the picked character.
+	 * @param PlayerColorStr The color of the picked character, used for logging.
+	 * @param PlayerController The player controller to assign to the spawned player.
 	 */
-	UFUNCTION(BlueprintCallable, Server, Reliable, WithValidation)
-	void StartLevel();
+	void SpawnChosenCharacter(
+		TSubclassOf<APC_PlayerFox> PlayerBP,
+		const FString& PlayerColorStr,
+		APlayerController* PlayerController
+	);
 
 	/**
 	 * @brief Starts the next level.
@@ -87,16 +83,46 @@ public:
 	void StartNextLevel();
 
 	/**
-	 * @brief Travel to a different level.
+	 * @brief Restarts the current level after a game over.
 	 *
-	 * This method allows the player to travel to a different level within the game.
-	 * It is a BlueprintCallable function that should be called on the server.
-	 * It is reliable and has validation, ensuring that the travel request is properly handled.
+	 * Asks the server's level game mode to reset the level in place and respawn every player, instead of
+	 * travelling to a freshly loaded map. Ignored by the game mode unless the game is over.
+	 *
+	 * @see ALevelGameMode::RestartLevel
 	 */
 	UFUNCTION(BlueprintCallable, Server, Reliable, WithValidation)
-	void TravelToLevel();
+	void RestartLevel();
+
+	/**
+	 * @brief Gets the view model behind the HUD of the pawn this controller possesses, creating it on first use.
+	 *
+	 * Only meaningful on the local controller. The view model outlives the pawns it is bound to, so respawning
+	 * or spectating rebinds the same object instead of creating a new one.
+	 *
+	 * @return The HUD view model of this controller.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "HUD")
+	UPlayerHUDViewModel* GetHUDViewModel();
+
+	/**
+	 * @brief Receives the cosmetic cues of one frame that are relevant to this player.
+	 *
+	 * Unreliable: a dropped batch only costs a few sounds, and never holds up gameplay RPCs.
+	 *
+	 * @param Cues The cues, in the order they happened on the server.
+	 *
+	 * @see UCosmeticCueSubsystem
+	 */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveCosmeticCues(const TArray<FCosmeticCue>& Cues);
 
 private:
+	/**
+	 * @brief The view model behind the local player's HUD. Created by GetHUDViewModel.
+	 */
+	UPROPERTY()
+	UPlayerHUDViewModel* HUDViewModel = nullptr;
+
 	/**
 	 * @brief PlayerSpawnDropInHeight represents the drop-in height for the player spawn location.
 	 *
@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CharacterRoster.h"
+
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+
+const FPrimaryAssetType UCharacterRoster::PrimaryAssetType = TEXT("CharacterRoster");
+
+/**
+ * Identifies the roster by the roster type and the asset's name.
+ *
+ * @return The primary asset ID of the roster.
+ */
+FPrimaryAssetId UCharacterRoster::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
+
+/**
+ * Finds the roster entry for a color, ignoring case.
+ *
+ * @param Color The color the character is picked by.
+ * @return The entry, or nullptr if the roster has no character of that color.
+ */
+const FCharacterRosterEntry* UCharacterRoster::FindCharacter(const FString& Color) const
+{
+	return Characters.FindByPredicate([&Color](const FCharacterRosterEntry& Entry)
+	{
+		return Entry.Color.Equals(Color, ESearchCase::IgnoreCase);
+	});
+}
+
+/**
+ * Finds the position of a color in the roster, ignoring case.
+ *
+ * @param Color The color the character is picked by.
+ * @return The index of the entry, or INDEX_NONE if the roster has no character of that color.
+ */
+int32 UCharacterRoster::FindCharacterIndex(const FString& Color) const
+{
+	return Characters.IndexOfByPredicate([&Color](const FCharacterRosterEntry& Entry)
+	{
+		return Entry.Color.Equals(Color, ESearchCase::IgnoreCase);
+	});
+}
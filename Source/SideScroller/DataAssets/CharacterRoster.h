@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CharacterRoster.generated.h"
+
+class APC_PlayerFox;
+
+/**
+ * @struct FCharacterRosterEntry
+ * @brief One playable character of the roster: the color it is picked by and a soft reference to its blueprint.
+ */
+USTRUCT(BlueprintType)
+struct FCharacterRosterEntry
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The color the character is picked by in the select character menu, e.g. "Pink" or "Orange".
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roster")
+	FString Color;
+
+	/**
+	 * @brief The blueprint class of the character. Only loaded once a player picks the character.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roster")
+	TSoftClassPtr<APC_PlayerFox> CharacterClass;
+};
+
+/**
+ * @class UCharacterRoster
+ * @brief The primary data asset listing every playable character.
+ *
+ * The roster only holds soft references, so loading it costs the same no matter how many characters (or skins) it
+ * lists. A character's blueprint, with its flipbooks and sounds, is streamed in through the asset manager when a
+ * player picks it and stays loaded for as long as the game instance holds on to it.
+ *
+ * @see USideScrollerGameInstance::LoadCharacterClass
+ */
+UCLASS(BlueprintType)
+class SIDESCROLLER_API UCharacterRoster : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief The primary asset type the asset manager scans rosters under.
+	 */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/**
+	 * @brief Identifies the roster to the asset manager by the roster type and the asset's name.
+	 *
+	 * @return The primary asset ID of the roster.
+	 */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/**
+	 * @brief Finds the roster entry for a color.
+	 *
+	 * @param Color The color the character is picked by.
+	 * @return The entry, or nullptr if the roster has no character of that color.
+	 */
+	const FCharacterRosterEntry* FindCharacter(const FString& Color) const;
+
+	/**
+	 * @brief Finds the position of a color in the roster, which is also its bit in the lobby's claimed characters.
+	 *
+	 * @param Color The color the character is picked by.
+	 * @return The index of the entry, or INDEX_NONE if the roster has no character of that color.
+	 *
+	 * @see ALobbyGameState::GetClaimedCharacters
+	 */
+	int32 FindCharacterIndex(const FString& Color) const;
+
+	/**
+	 * @brief The playable characters.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roster")
+	TArray<FCharacterRosterEntry> Characters;
+};
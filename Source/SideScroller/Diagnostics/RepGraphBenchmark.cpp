@@ -0,0 +1,239 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RepGraphBenchmark.h"
+
+#include "EngineUtils.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "SideScroller/Replication/SideScrollerReplicationGraph.h"
+
+namespace RepGraphBenchmark
+{
+	/**
+	 * @struct FRow
+	 * @brief The measurements for one number of simulated connections.
+	 */
+	struct FRow
+	{
+		int32 Connections = 0;
+		double DefaultUs = 0.0;
+		double DefaultActorsPerConnection = 0.0;
+		double GridUs = 0.0;
+		double GridActorsPerConnection = 0.0;
+	};
+
+	/**
+	 * Times AActor::IsNetRelevantFor of every replicated actor for every simulated connection.
+	 *
+	 * @param Actors The replicated actors.
+	 * @param ViewLocations The view location of each simulated connection.
+	 * @param Viewer The player controller the relevancy checks are made for.
+	 * @param Iterations The number of replication frames to average over.
+	 * @param OutRelevantActors The number of relevant actors summed over the connections of one frame.
+	 * @return Microseconds per replication frame.
+	 */
+	static double TimeDefaultRelevancy(
+		const TArray<AActor*>& Actors,
+		const TArray<FVector>& ViewLocations,
+		const APlayerController* Viewer,
+		const int32 Iterations,
+		int32& OutRelevantActors
+	)
+	{
+		const AActor* ViewTarget = Viewer->GetViewTarget();
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			OutRelevantActors = 0;
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				for (const AActor* Actor : Actors)
+				{
+					OutRelevantActors += Actor->IsNetRelevantFor(Viewer, ViewTarget, ViewLocation) ? 1 : 0;
+				}
+			}
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000000.0 / Iterations;
+	}
+
+	/**
+	 * Times the X-axis grid gather, and a walk over the gathered actors, for every simulated connection.
+	 *
+	 * @param GridNode The replication graph's X-axis grid.
+	 * @param ViewLocations The view location of each simulated connection.
+	 * @param Iterations The number of replication frames to average over.
+	 * @param OutGatheredActors The number of gathered actors summed over the connections of one frame.
+	 * @return Microseconds per replication frame.
+	 */
+	static double TimeGridGather(
+		const UReplicationGraphNode_XAxisGrid* GridNode,
+		const TArray<FVector>& ViewLocations,
+		const int32 Iterations,
+		int32& OutGatheredActors
+	)
+	{
+		TArray<const FActorRepListRefView*> GatheredLists;
+		TArray<int32, TInlineAllocator<16>> GatheredCells;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			OutGatheredActors = 0;
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				GatheredLists.Reset();
+				GatheredCells.Reset();
+				GridNode->GatherCellsAround(ViewLocation.X, GridNode->ViewHalfWidth, GatheredLists, GatheredCells);
+
+				for (const FActorRepListRefView* GatheredList : GatheredLists)
+				{
+					for (int32 Index = 0; Index < GatheredList->Num(); ++Index)
+					{
+						OutGatheredActors += (*GatheredList)[Index] != nullptr ? 1 : 0;
+					}
+				}
+			}
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000000.0 / Iterations;
+	}
+
+	/**
+	 * Handles the "SideScroller.RepGraphBenchmark [MaxConnections] [Iterations]" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleRepGraphBenchmarkCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 MaxConnections = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 64;
+		const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 50;
+		FRepGraphBenchmark::Run(World, MaxConnections > 0 ? MaxConnections : 64, Iterations > 0 ? Iterations : 50);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RepGraphBenchmarkCommand(
+		TEXT("SideScroller.RepGraphBenchmark"),
+		TEXT("Times the server's relevancy work with and without the X-axis replication graph for 1 up to "
+			"MaxConnections (default 64) simulated connections, averaged over Iterations (default 50) frames, then "
+			"logs the result and writes a CSV to the profiling directory."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleRepGraphBenchmarkCommand)
+	);
+}
+
+/**
+ * Simulates growing numbers of connections spread along the level and times both ways of finding their relevant
+ * actors, then logs the rows and writes them to a CSV file.
+ *
+ * @param World The server world.
+ * @param MaxConnections The largest number of simulated connections.
+ * @param Iterations The number of replication frames each measurement is averaged over.
+ */
+void FRepGraphBenchmark::Run(UWorld* World, const int32 MaxConnections, const int32 Iterations)
+{
+	if (World == nullptr) return;
+
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	const USideScrollerReplicationGraph* ReplicationGraph = NetDriver
+		? Cast<USideScrollerReplicationGraph>(NetDriver->GetReplicationDriver())
+		: nullptr;
+	const UReplicationGraphNode_XAxisGrid* GridNode = ReplicationGraph ? ReplicationGraph->GetXAxisGridNode() : nullptr;
+	if (World->GetNetMode() == NM_Client || GridNode == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("FRepGraphBenchmark::Run - Run this on a hosted game that uses the replication graph.")
+		);
+		return;
+	}
+
+	const FConstPlayerControllerIterator PlayerControllerIt = World->GetPlayerControllerIterator();
+	const APlayerController* Viewer = PlayerControllerIt ? PlayerControllerIt->Get() : nullptr;
+	if (Viewer == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FRepGraphBenchmark::Run - No player controller to check relevancy for."));
+		return;
+	}
+
+	TArray<AActor*> Actors;
+	double MinX = TNumericLimits<double>::Max();
+	double MaxX = TNumericLimits<double>::Lowest();
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!Actor->GetIsReplicated() || Actor->IsActorBeingDestroyed()) continue;
+
+		Actors.Add(Actor);
+		MinX = FMath::Min(MinX, Actor->GetActorLocation().X);
+		MaxX = FMath::Max(MaxX, Actor->GetActorLocation().X);
+	}
+	if (Actors.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FRepGraphBenchmark::Run - The world has no replicated actors."));
+		return;
+	}
+
+	FVector ViewerLocation;
+	FRotator ViewerRotation;
+	Viewer->GetPlayerViewPoint(ViewerLocation, ViewerRotation);
+
+	TArray<RepGraphBenchmark::FRow> Rows;
+	TArray<FVector> ViewLocations;
+	for (int32 Connections = 1; ; Connections = FMath::Min(Connections * 2, MaxConnections))
+	{
+		ViewLocations.Reset(Connections);
+		for (int32 Index = 0; Index < Connections; ++Index)
+		{
+			const double X = FMath::Lerp(MinX, MaxX, (Index + 0.5) / Connections);
+			ViewLocations.Add(FVector(X, ViewerLocation.Y, ViewerLocation.Z));
+		}
+
+		int32 RelevantActors = 0;
+		int32 GatheredActors = 0;
+		RepGraphBenchmark::FRow& Row = Rows.AddDefaulted_GetRef();
+		Row.Connections = Connections;
+		Row.DefaultUs = RepGraphBenchmark::TimeDefaultRelevancy(
+			Actors, ViewLocations, Viewer, Iterations, RelevantActors
+		);
+		Row.DefaultActorsPerConnection = static_cast<double>(RelevantActors) / Connections;
+		Row.GridUs = RepGraphBenchmark::TimeGridGather(GridNode, ViewLocations, Iterations, GatheredActors);
+		Row.GridActorsPerConnection = static_cast<double>(GatheredActors) / Connections;
+
+		if (Connections >= MaxConnections) break;
+	}
+
+	const FString MapName = World->GetMapName();
+	FString Csv = TEXT("Connections,ReplicatedActors,DefaultUs,DefaultActorsPerConnection,GridUs,"
+		"GridActorsPerConnection\n");
+	UE_LOG(LogTemp, Display,
+		TEXT("FRepGraphBenchmark::Run - %s, %i replicated actors, %i frames per measurement:"),
+		*MapName, Actors.Num(), Iterations
+	);
+	for (const RepGraphBenchmark::FRow& Row : Rows)
+	{
+		Csv += FString::Printf(TEXT("%i,%i,%.2f,%.1f,%.2f,%.1f\n"),
+			Row.Connections, Actors.Num(), Row.DefaultUs, Row.DefaultActorsPerConnection,
+			Row.GridUs, Row.GridActorsPerConnection
+		);
+		UE_LOG(LogTemp, Display,
+			TEXT("  connections %4i  default %10.2f us (%6.1f actors each)  grid %10.2f us (%6.1f actors each)"),
+			Row.Connections, Row.DefaultUs, Row.DefaultActorsPerConnection,
+			Row.GridUs, Row.GridActorsPerConnection
+		);
+	}
+
+	const FString CsvPath = FPaths::Combine(
+		FPaths::ProfilingDir(),
+		TEXT("RepGraphBenchmark"),
+		FString::Printf(TEXT("RepGraphBenchmark-%s-%s.csv"), *MapName, *FDateTime::Now().ToString())
+	);
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("FRepGraphBenchmark::Run - Wrote %s."), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FRepGraphBenchmark::Run - Could not write %s."), *CsvPath);
+	}
+}
@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FRepGraphBenchmark
+ * @brief Measures what the server spends finding the relevant actors of its connections, against connection count.
+ *
+ * Started from the console of a listen or dedicated server with "SideScroller.RepGraphBenchmark [MaxConnections]
+ * [Iterations]" (defaults 64 and 50), while a level is loaded. For 1, 2, 4, ... up to MaxConnections simulated
+ * connections, spread evenly along the level's X extent, it times two ways of finding their relevant actors:
+ * - Default: what the net driver does without a replication graph, AActor::IsNetRelevantFor of every replicated
+ *   actor for every connection.
+ * - Grid: what USideScrollerReplicationGraph does, gathering the X-axis grid cells around every connection and
+ *   walking their actor lists.
+ * It logs the results and writes them to <ProfilingDir>/RepGraphBenchmark/RepGraphBenchmark-<Map>-<Time>.csv with
+ * these columns:
+ * - Connections: the number of simulated connections.
+ * - ReplicatedActors: the replicated actors in the world.
+ * - DefaultUs: microseconds per replication frame for the default relevancy checks.
+ * - DefaultActorsPerConnection: the average number of actors found relevant per connection.
+ * - GridUs: microseconds per replication frame for the grid gather.
+ * - GridActorsPerConnection: the average number of actors gathered per connection.
+ *
+ * Both are timed on the same world state, and only the relevancy part of a replication frame is timed; the cost of
+ * serializing the relevant actors is the same either way. The actors the graph replicates to all connections are
+ * left out of the grid numbers, as they are a fixed list that costs the same for any connection count.
+ */
+class SIDESCROLLER_API FRepGraphBenchmark
+{
+public:
+	/**
+	 * Runs the benchmark on the given server world, logs the results and writes the CSV report.
+	 *
+	 * @param World The server world. Its game net driver must use USideScrollerReplicationGraph.
+	 * @param MaxConnections The largest number of simulated connections.
+	 * @param Iterations The number of replication frames each measurement is averaged over.
+	 */
+	static void Run(UWorld* World, int32 MaxConnections, int32 Iterations);
+};
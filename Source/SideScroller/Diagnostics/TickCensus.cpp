@@ -0,0 +1,290 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TickCensus.h"
+
+#include "EngineUtils.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace TickCensus
+{
+	/**
+	 * @struct FRow
+	 * @brief The census numbers of one actor or component class.
+	 */
+	struct FRow
+	{
+		FString Kind;
+		FString ClassName;
+		int32 MaxCount = 0;
+		double IntervalSum = 0.0;
+		int64 IntervalSamples = 0;
+		int64 ScheduledTicks = 0;
+		int64 TimedTicks = 0;
+		uint64 Cycles = 0;
+
+		double GetTotalMs() const { return FPlatformTime::ToMilliseconds64(Cycles); }
+	};
+
+	/** Whether a capture is running. Checked by every FTickCensusScope, so kept as a plain bool. */
+	static bool bIsCapturing = false;
+
+	/** The world being captured. */
+	static TWeakObjectPtr<UWorld> CaptureWorld;
+
+	/** Real time, in seconds, at which the running capture started and ends. */
+	static double CaptureStartTime = 0.0;
+	static double CaptureEndTime = 0.0;
+
+	/** The per-frame sampler registered with the core ticker while capturing. */
+	static FTSTicker::FDelegateHandle SamplerHandle;
+
+	/** The census rows, keyed by "Kind:Class". */
+	static TMap<FString, FRow> Rows;
+
+	/** World time at which each sampled object with a tick interval is next due to tick. */
+	static TMap<TWeakObjectPtr<const UObject>, double> NextTickTimes;
+
+	/**
+	 * Finds or adds the row of the given object's class.
+	 *
+	 * @param Object The actor or component.
+	 * @param OutKey Receives the key of the row in Rows.
+	 * @return The row of the object's class. Only valid until the next row is added.
+	 */
+	static FRow& GetRow(const UObject* Object, FString& OutKey)
+	{
+		const FString Kind = Object->IsA<UActorComponent>() ? TEXT("Component") : TEXT("Actor");
+		const FString ClassName = Object->GetClass()->GetName();
+		OutKey = Kind + TEXT(":") + ClassName;
+		FRow& Row = Rows.FindOrAdd(OutKey);
+		if (Row.ClassName.IsEmpty())
+		{
+			Row.Kind = Kind;
+			Row.ClassName = ClassName;
+		}
+		return Row;
+	}
+
+	/**
+	 * Samples one tick function for the current frame.
+	 *
+	 * @param Object The actor or component owning the tick function.
+	 * @param TickFunction The tick function.
+	 * @param WorldTime The world time of the current frame.
+	 * @param FrameCounts Ticking instances per row key seen so far this frame.
+	 */
+	static void SampleTickFunction(
+		const UObject* Object,
+		const FTickFunction& TickFunction,
+		const double WorldTime,
+		TMap<FString, int32>& FrameCounts
+	)
+	{
+		if (!TickFunction.IsTickFunctionRegistered() || !TickFunction.IsTickFunctionEnabled()) return;
+
+		// keyed by string, not by row pointer: adding a row can reallocate Rows and move the others
+		FString RowKey;
+		FRow& Row = GetRow(Object, RowKey);
+		++FrameCounts.FindOrAdd(RowKey);
+		Row.IntervalSum += TickFunction.TickInterval;
+		++Row.IntervalSamples;
+
+		if (TickFunction.TickInterval <= 0.f)
+		{
+			++Row.ScheduledTicks;
+			return;
+		}
+
+		double& NextTickTime = NextTickTimes.FindOrAdd(Object, WorldTime);
+		if (WorldTime >= NextTickTime)
+		{
+			++Row.ScheduledTicks;
+			NextTickTime = WorldTime + TickFunction.TickInterval;
+		}
+	}
+
+	/**
+	 * Samples every ticking actor and component of the captured world. Registered with the core ticker.
+	 *
+	 * @param DeltaTime Time since the last sample.
+	 * @return True to keep sampling.
+	 */
+	static bool SampleFrame(float DeltaTime)
+	{
+		UWorld* World = CaptureWorld.Get();
+		if (World == nullptr || FPlatformTime::Seconds() >= CaptureEndTime)
+		{
+			FTickCensus::EndCapture();
+			return false;
+		}
+
+		TMap<FString, int32> FrameCounts;
+		const double WorldTime = World->GetTimeSeconds();
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			const AActor* Actor = *It;
+			SampleTickFunction(Actor, Actor->PrimaryActorTick, WorldTime, FrameCounts);
+
+			for (const UActorComponent* Component : Actor->GetComponents())
+			{
+				if (Component == nullptr) continue;
+				SampleTickFunction(Component, Component->PrimaryComponentTick, WorldTime, FrameCounts);
+			}
+		}
+
+		for (const TPair<FString, int32>& FrameCount : FrameCounts)
+		{
+			FRow& Row = Rows.FindChecked(FrameCount.Key);
+			Row.MaxCount = FMath::Max(Row.MaxCount, FrameCount.Value);
+		}
+		return true;
+	}
+
+	/**
+	 * Handles the "SideScroller.TickCensus [Seconds|stop]" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleTickCensusCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+		{
+			FTickCensus::EndCapture();
+			return;
+		}
+
+		const float Seconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 5.f;
+		FTickCensus::BeginCapture(World, Seconds > 0.f ? Seconds : 5.f);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs TickCensusCommand(
+		TEXT("SideScroller.TickCensus"),
+		TEXT("Captures every ticking actor and component by class for a number of seconds (default 5), then logs "
+			"the result and writes a CSV to the profiling directory. 'SideScroller.TickCensus stop' ends early."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleTickCensusCommand)
+	);
+}
+
+/**
+ * Starts sampling the world's ticking actors and components every frame for the given number of seconds.
+ *
+ * @param World The world to capture.
+ * @param Seconds The length of the capture window in seconds.
+ */
+void FTickCensus::BeginCapture(UWorld* World, const float Seconds)
+{
+	if (World == nullptr) return;
+
+	if (TickCensus::bIsCapturing)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FTickCensus::BeginCapture - A tick census is already running."));
+		return;
+	}
+
+	TickCensus::Rows.Reset();
+	TickCensus::NextTickTimes.Reset();
+	TickCensus::CaptureWorld = World;
+	TickCensus::CaptureStartTime = FPlatformTime::Seconds();
+	TickCensus::CaptureEndTime = TickCensus::CaptureStartTime + Seconds;
+	TickCensus::bIsCapturing = true;
+	TickCensus::SamplerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateStatic(&TickCensus::SampleFrame)
+	);
+
+	UE_LOG(LogTemp, Display,
+		TEXT("FTickCensus::BeginCapture - Capturing ticks of %s for %.1f seconds."), *World->GetMapName(), Seconds
+	);
+}
+
+/**
+ * Stops the running capture, logs the rows sorted by cost and count, and writes them to a CSV file.
+ */
+void FTickCensus::EndCapture()
+{
+	if (!TickCensus::bIsCapturing) return;
+
+	TickCensus::bIsCapturing = false;
+	FTSTicker::GetCoreTicker().RemoveTicker(TickCensus::SamplerHandle);
+	TickCensus::SamplerHandle.Reset();
+
+	const double CaptureSeconds = FPlatformTime::Seconds() - TickCensus::CaptureStartTime;
+	const FString MapName = TickCensus::CaptureWorld.IsValid()
+		? TickCensus::CaptureWorld->GetMapName()
+		: TEXT("Unknown");
+
+	TArray<TickCensus::FRow> SortedRows;
+	TickCensus::Rows.GenerateValueArray(SortedRows);
+	SortedRows.Sort([](const TickCensus::FRow& A, const TickCensus::FRow& B)
+	{
+		if (A.Cycles != B.Cycles) return A.Cycles > B.Cycles;
+		return A.ScheduledTicks > B.ScheduledTicks;
+	});
+
+	FString Csv = TEXT("Kind,Class,MaxCount,AvgTickInterval,ScheduledTicks,TimedTicks,TotalMs,AvgUsPerTick\n");
+	UE_LOG(LogTemp, Display,
+		TEXT("FTickCensus::EndCapture - %s, %.2f seconds, %i ticking classes:"),
+		*MapName, CaptureSeconds, SortedRows.Num()
+	);
+	for (const TickCensus::FRow& Row : SortedRows)
+	{
+		const double AvgInterval = Row.IntervalSamples > 0 ? Row.IntervalSum / Row.IntervalSamples : 0.0;
+		const double AvgUsPerTick = Row.TimedTicks > 0 ? Row.GetTotalMs() * 1000.0 / Row.TimedTicks : 0.0;
+
+		Csv += FString::Printf(TEXT("%s,%s,%i,%.3f,%lld,%lld,%.3f,%.2f\n"),
+			*Row.Kind, *Row.ClassName, Row.MaxCount, AvgInterval,
+			Row.ScheduledTicks, Row.TimedTicks, Row.GetTotalMs(), AvgUsPerTick
+		);
+		UE_LOG(LogTemp, Display,
+			TEXT("  %-9s %-40s count %4i  interval %6.3f  ticks %7lld  timed %7lld  total %9.3f ms  avg %8.2f us"),
+			*Row.Kind, *Row.ClassName, Row.MaxCount, AvgInterval,
+			Row.ScheduledTicks, Row.TimedTicks, Row.GetTotalMs(), AvgUsPerTick
+		);
+	}
+
+	const FString CsvPath = FPaths::Combine(
+		FPaths::ProfilingDir(),
+		TEXT("TickCensus"),
+		FString::Printf(TEXT("TickCensus-%s-%s.csv"), *MapName, *FDateTime::Now().ToString())
+	);
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("FTickCensus::EndCapture - Wrote %s."), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FTickCensus::EndCapture - Could not write %s."), *CsvPath);
+	}
+
+	TickCensus::Rows.Reset();
+	TickCensus::NextTickTimes.Reset();
+	TickCensus::CaptureWorld.Reset();
+}
+
+/**
+ * @return True while a capture is running.
+ */
+bool FTickCensus::IsCapturing()
+{
+	return TickCensus::bIsCapturing;
+}
+
+/**
+ * Adds one instrumented tick of the object's class to the census.
+ *
+ * @param Object The actor or component that ticked.
+ * @param Cycles The time the tick took, in CPU cycles.
+ */
+void FTickCensus::RecordTick(const UObject* Object, const uint64 Cycles)
+{
+	if (!TickCensus::bIsCapturing || Object == nullptr) return;
+
+	FString RowKey;
+	TickCensus::FRow& Row = TickCensus::GetRow(Object, RowKey);
+	++Row.TimedTicks;
+	Row.Cycles += Cycles;
+}
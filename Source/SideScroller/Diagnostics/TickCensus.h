@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FTickCensus
+ * @brief Captures which actors and components tick, and what their ticks cost, over a time window.
+ *
+ * Started from the console with "SideScroller.TickCensus [Seconds]" (default 5 seconds, "stop" ends a capture
+ * early). While capturing, every frame the census samples all actors and components of the world whose tick
+ * function is registered and enabled. At the end it logs the results per class and writes them to
+ * <ProfilingDir>/TickCensus/TickCensus-<Map>-<Time>.csv with these columns:
+ * - Kind: Actor or Component.
+ * - Class: the class name.
+ * - MaxCount: the most ticking instances seen in one frame.
+ * - AvgTickInterval: the average configured tick interval (0 = every frame).
+ * - ScheduledTicks: ticks due over the window, based on each instance's tick interval.
+ * - TimedTicks: ticks actually timed, for classes whose Tick is instrumented with TICK_CENSUS_SCOPE.
+ * - TotalMs: accumulated time in those timed ticks.
+ * - AvgUsPerTick: average time per timed tick.
+ *
+ * Engine classes are not instrumented, so their rows only have the counts and intervals; their cost shows up in
+ * "stat game" / Unreal Insights.
+ */
+class SIDESCROLLER_API FTickCensus
+{
+public:
+	/**
+	 * Starts a census capture of the given world.
+	 *
+	 * @param World The world whose actors and components are sampled.
+	 * @param Seconds The length of the capture window in seconds.
+	 */
+	static void BeginCapture(UWorld* World, float Seconds);
+
+	/**
+	 * Ends the running capture, logs the results and writes the CSV report.
+	 */
+	static void EndCapture();
+
+	/**
+	 * @return True while a capture is running.
+	 */
+	static bool IsCapturing();
+
+	/**
+	 * Adds the time of one instrumented tick to the census.
+	 *
+	 * @param Object The actor or component that ticked.
+	 * @param Cycles The time the tick took, in CPU cycles.
+	 */
+	static void RecordTick(const UObject* Object, uint64 Cycles);
+};
+
+/**
+ * @struct FTickCensusScope
+ * @brief Times the enclosing scope and reports it to the tick census while a capture is running.
+ *
+ * Costs a single bool check when no capture is running.
+ */
+struct SIDESCROLLER_API FTickCensusScope
+{
+	explicit FTickCensusScope(const UObject* InObject)
+		: Object(FTickCensus::IsCapturing() ? InObject : nullptr)
+		, StartCycles(Object != nullptr ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FTickCensusScope()
+	{
+		if (Object != nullptr)
+		{
+			FTickCensus::RecordTick(Object, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	const UObject* Object;
+	uint64 StartCycles;
+};
+
+/**
+ * Put at the top of a Tick override to include its cost in the tick census.
+ */
+#define TICK_CENSUS_SCOPE() const FTickCensusScope TickCensusScope(this)
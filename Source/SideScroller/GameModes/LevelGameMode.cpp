@@ -10,6 +10,7 @@
 #include "SideScroller/SideScrollerGameInstance.h"
 #include "SideScroller/Controllers/GameModePlayerController.h"
 #include "SideScroller/GameStates/LevelGameState.h"
+#include "SideScroller/Replay/MatchReplaySubsystem.h"
 
 /**
  * @brief Begins play for the game mode.
@@ -21,7 +22,10 @@
  * Within this method, the superclass's "BeginPlay()" method is called first to ensure proper
  * initialization of the game mode.
  *
- * After calling the superclass method, a timer is set to delay the spawning of player chosen
+ * After calling the superclass method, the match recording of this level is started. The level preloaded for this
+ * level is released by the level game state, on the server and on every client.
+ *
+ * Then a timer is set to delay the spawning of player chosen
  * characters. The "SpawnPlayerChosenCharacters()" method is bound to this timer and will be
  * called after a specified delay. The timer will not repeat.
  */
@@ -29,6 +33,12 @@ void ALevelGameMode::BeginPlay()
 {
 	Super::BeginPlay();
 
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (GameInstance != nullptr)
+	{
+		GameInstance->GetSubsystem<UMatchReplaySubsystem>()->StartMatchRecording();
+	}
+
 	GetWorld()->GetTimerManager().SetTimer(
 		this->SpawnPlayerChosenCharDelayTimerHandle,
 		this,
@@ -38,6 +48,21 @@ void ALevelGameMode::BeginPlay()
 	);
 }
 
+/**
+ * Finishes the level's match recording before the level goes away.
+ *
+ * @param EndPlayReason Why the level stopped playing.
+ */
+void ALevelGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetSubsystem<UMatchReplaySubsystem>()->StopMatchRecording();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 /**
  * Locates the chosen character for the given player controller and spawns it in the game.
  *
@@ -81,7 +106,7 @@ bool ALevelGameMode::LocateChosenCharacter(FConstPlayerControllerIterator Iter)
 	const TSubclassOf<APC_PlayerFox> ChosenCharacterBP = GameInstance->GetChosenCharacter(PlayerController);
 	if (ChosenCharacterBP != nullptr)
 	{
-		GameModePlayerController->SpawnPlayer(ChosenCharacterBP, "", PlayerController);
+		GameModePlayerController->SpawnChosenCharacter(ChosenCharacterBP, "", PlayerController);
 		UE_LOG(LogTemp, Display,
 		       TEXT("ALevelGameMode::SpawnPlayerChosenCharacters - Spawning saved chosen player character.")
 		)
@@ -90,7 +115,7 @@ bool ALevelGameMode::LocateChosenCharacter(FConstPlayerControllerIterator Iter)
 	{
 		if (DefaultCharacterBP != nullptr)
 		{
-			GameModePlayerController->SpawnPlayer(DefaultCharacterBP, "", PlayerController);
+			GameModePlayerController->SpawnChosenCharacter(DefaultCharacterBP, "", PlayerController);
 			UE_LOG(LogTemp, Display,
 			       TEXT("ALevelGameMode::SpawnPlayerChosenCharacters - Spawning default player character.")
 			)
@@ -141,7 +166,7 @@ void ALevelGameMode::StartNextLevel()
 		return;
 	}
 
-	const ALevelGameState* CurrentGameState = Cast<ALevelGameState>(GetWorld()->GetGameState());
+	ALevelGameState* CurrentGameState = Cast<ALevelGameState>(GetWorld()->GetGameState());
 	if (CurrentGameState == nullptr)
 	{
 		UE_LOG(LogTemp, Warning,
@@ -176,3 +201,122 @@ void ALevelGameMode::StartNextLevel()
 		GameInstance->LoadGameCompleteCredits();
 	}
 }
+
+/**
+ * Preloads the map of the level after the current one so the upcoming travel only has to swap worlds.
+ */
+void ALevelGameMode::PreloadNextLevel()
+{
+	if (!HasAuthority()) return;
+
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (GameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameMode::PreloadNextLevel - Can't preload next level. GameInstance is null!")
+		);
+		return;
+	}
+
+	const ALevelGameState* CurrentGameState = Cast<ALevelGameState>(GetWorld()->GetGameState());
+	if (CurrentGameState == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameMode::PreloadNextLevel - Can't preload next level. GameState is null!")
+		);
+		return;
+	}
+
+	const int NextLevel = CurrentGameState->GetCurrentLevel() + 1;
+	if (NextLevel <= 3 && NextLevel > 0)
+	{
+		CurrentGameState->MulticastPreloadLevel(NextLevel);
+	}
+}
+
+/**
+ * Shows the game over menu on every machine, once per game over.
+ */
+void ALevelGameMode::ShowGameOverMenu()
+{
+	if (bIsGameOver) return;
+
+	ALevelGameState* CurrentGameState = Cast<ALevelGameState>(GetWorld()->GetGameState());
+	if (CurrentGameState == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameMode::ShowGameOverMenu - Can't show game over menu. GameState is null!")
+		);
+		return;
+	}
+
+	bIsGameOver = true;
+	CurrentGameState->MulticastShowGameOverMenu();
+}
+
+/**
+ * Resets level 1 in place and gives every player a fresh pawn, or travels back to level 1 from any other level.
+ */
+void ALevelGameMode::RestartLevel()
+{
+	if (!bIsGameOver) return;
+
+	ALevelGameState* CurrentGameState = Cast<ALevelGameState>(GetWorld()->GetGameState());
+	if (CurrentGameState == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameMode::RestartLevel - Can't restart level. GameState is null!")
+		);
+		return;
+	}
+
+	// restarting the game means starting over from level 1, which only the level 1 map can do in place
+	if (CurrentGameState->GetCurrentLevel() != 1)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("ALevelGameMode::RestartLevel - Game over on Level %i. Travelling back to Level 1."),
+			CurrentGameState->GetCurrentLevel()
+		);
+		bIsGameOver = false;
+		bUseSeamlessTravel = true;
+		GetWorld()->ServerTravel("/Game/Maps/Map_Level1?listen");
+		return;
+	}
+
+	UE_LOG(LogTemp, Display,
+		TEXT("ALevelGameMode::RestartLevel - Resetting Level %i in place."),
+		CurrentGameState->GetCurrentLevel()
+	);
+	bIsGameOver = false;
+	CurrentGameState->MulticastResetLevel();
+
+	for (FConstPlayerControllerIterator Iter = GetWorld()->GetPlayerControllerIterator(); Iter; ++Iter)
+	{
+		APlayerController* PlayerController = Iter->Get();
+		if (PlayerController == nullptr) continue;
+
+		if (APawn* OldPawn = PlayerController->GetPawn())
+		{
+			PlayerController->UnPossess();
+			if (APC_PlayerFox* OldPlayer = Cast<APC_PlayerFox>(OldPawn))
+			{
+				if (GetPlayers().Contains(OldPlayer))
+				{
+					RemovePlayer(OldPlayer);
+				}
+			}
+			OldPawn->Destroy();
+		}
+
+		// a default pawn at a player start, swapped for the chosen character below like at the start of the level
+		RestartPlayer(PlayerController);
+	}
+
+	GetWorld()->GetTimerManager().SetTimer(
+		this->SpawnPlayerChosenCharDelayTimerHandle,
+		this,
+		&ALevelGameMode::SpawnPlayerChosenCharacters,
+		SpawnPlayerChosenCharDelayTimer,
+		false
+	);
+}
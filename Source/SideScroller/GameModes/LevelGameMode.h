@@ -49,6 +49,43 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void StartNextLevel();
 
+	/**
+	 * @brief Starts loading the next level's map in the background.
+	 *
+	 * Works out the next level from the current game state and has the game instance of the server and of every
+	 * client preload its map package, so that StartNextLevel's ServerTravel does not stall on a cold load anywhere.
+	 * Does nothing if this is the last level (the credits come next) or if it is not called on the server.
+	 *
+	 * @see USideScrollerGameInstance::PreloadLevel
+	 * @see ALevelPreloadTrigger
+	 */
+	UFUNCTION(BlueprintCallable)
+	void PreloadNextLevel();
+
+	/**
+	 * @brief Shows the game over menu over the level on every machine.
+	 *
+	 * Called once every player is out of lives. Only the first call after the level started (or was restarted) does
+	 * anything, since the game mode keeps asking while there are no players.
+	 *
+	 * @see ALevelGameState::MulticastShowGameOverMenu
+	 */
+	UFUNCTION(BlueprintCallable)
+	void ShowGameOverMenu();
+
+	/**
+	 * @brief Restarts the game from level 1 after a game over.
+	 *
+	 * A game over always sends the players back to level 1. On level 1 the level's actors are reset on every machine
+	 * through the ULevelResetSubsystem instead of reloading the map, then every player's pawn is replaced with a fresh
+	 * one at a player start and their chosen characters are swapped in after the usual spawn delay. On any other
+	 * level the server travels to Map_Level1 as before. Does nothing unless the game is over.
+	 *
+	 * @see ALevelGameState::MulticastResetLevel
+	 */
+	UFUNCTION(BlueprintCallable)
+	void RestartLevel();
+
 private:
 	/**
 	 * Locates the chosen character for the given player controller and spawns it in the game world.
@@ -99,6 +136,11 @@ private:
 	 */
 	FTimerHandle SpawnPlayerChosenCharDelayTimerHandle;
 
+	/**
+	 * @brief Whether every player is out of lives and the game over menu is showing.
+	 */
+	bool bIsGameOver = false;
+
 protected:
 	/**
 	 * @brief Called when the level begins playing.
@@ -119,4 +161,13 @@ protected:
 	 * functionality specific to the game mode.
 	 */
 	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Called when the level stops playing, on travel or when the game ends.
+	 *
+	 * Finishes the level's match recording so its file is complete before the next level starts its own.
+	 *
+	 * @param EndPlayReason Why the level stopped playing.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
@@ -4,42 +4,97 @@
 #include "LobbyGameMode.h"
 
 #include "SideScroller/SideScrollerGameInstance.h"
+#include "SideScroller/GameStates/LobbyGameState.h"
+#include "SideScroller/PlayerStates/PlayerFoxState.h"
 
 /**
  * @brief Initiates the start of the game.
  *
  * This method is responsible for starting the game by:
- * 1. Retrieving the game instance from the current world.
- * 2. Setting the 'ReadyToStartGame' flag in the game instance to false.
- * 3. Logging a warning if the game instance is null and returning.
- * 4. Logging a message indicating that the lobby is being left to start the game.
- * 5. Enabling seamless travel in the current world.
- * 6. Constructing a travel URL based on the current level obtained from the game instance.
- * 7. Initiating a server travel to the constructed travel URL.
+ * 1. Logging a message indicating that the lobby is being left to start the game.
+ * 2. Enabling seamless travel in the current world.
+ * 3. Constructing a travel URL for the start level obtained from the game instance: level 1, or the level of the
+ * saved progression when the host chose to continue it.
+ * 4. Initiating a server travel to the constructed travel URL.
  *
  * @param None.
  * @return None.
  */
 void ALobbyGameMode::StartGame()
 {
-	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetWorld()->GetGameInstance());
-	if (GameInstance == nullptr)
-	{
-		UE_LOG(LogTemp, Warning,
-			TEXT("ALobbyGameMode::StartGame - Can't set SetReadyToStartGame back to false. GameInstance is null!")
-		);
-		return;
-	}
-	GameInstance->SetReadyToStartGame(false);
+	GetWorldTimerManager().ClearTimer(GameStartCountdownTimerHandle);
 
 	UE_LOG(LogTemp, Display, TEXT("Leaving lobby to start game..."));
 	UWorld* World = GetWorld();
 	if (!World) return;
 	bUseSeamlessTravel = true;
-	const FString TravelURL = FString::Printf(TEXT("/Game/Maps/Map_Level1?listen"));
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	const int StartLevel = GameInstance != nullptr ? GameInstance->ConsumeStartLevel() : 1;
+	const FString TravelURL = FString::Printf(TEXT("/Game/Maps/Map_Level%i?listen"), StartLevel);
 	World->ServerTravel(TravelURL);
 }
 
+/**
+ * Starts the game start countdown once every player is ready, and cancels it as soon as that is no longer true.
+ *
+ * @param ExitingController A controller that is leaving and should not be counted, if any.
+ */
+void ALobbyGameMode::CheckReadyToStart(const AController* ExitingController)
+{
+	ALobbyGameState* LobbyGameState = GetGameState<ALobbyGameState>();
+	const bool bIsReadyToStart = bNumPlayersRequirementFulfilled
+		&& AreAllPlayersReady(ExitingController ? ExitingController->PlayerState : nullptr);
+	const bool bIsCountingDown = GetWorldTimerManager().IsTimerActive(GameStartCountdownTimerHandle);
+	if (bIsReadyToStart == bIsCountingDown) return;
+
+	if (bIsReadyToStart)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("ALobbyGameMode::CheckReadyToStart - All players ready, starting game in %.1f seconds."),
+			GameStartCountdown
+		);
+		GetWorldTimerManager().SetTimer(
+			GameStartCountdownTimerHandle,
+			this,
+			&ALobbyGameMode::StartGame,
+			GameStartCountdown,
+			false
+		);
+		if (LobbyGameState)
+		{
+			LobbyGameState->SetGameStartCountdownEndTime(GetWorld()->GetTimeSeconds() + GameStartCountdown);
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Display, TEXT("ALobbyGameMode::CheckReadyToStart - Not all players ready, cancelling start."));
+		GetWorldTimerManager().ClearTimer(GameStartCountdownTimerHandle);
+		if (LobbyGameState) LobbyGameState->SetGameStartCountdownEndTime(0.0);
+	}
+}
+
+/**
+ * Checks whether every player in the lobby has picked a character, from their replicated player states.
+ *
+ * @param IgnoredPlayerState The player state of a player that is leaving, or nullptr.
+ * @return True if there is at least one player and all of them have chosen a character.
+ */
+bool ALobbyGameMode::AreAllPlayersReady(const APlayerState* IgnoredPlayerState) const
+{
+	if (GameState == nullptr) return false;
+
+	int32 ReadyPlayers = 0;
+	for (const APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		if (PlayerState == nullptr || PlayerState == IgnoredPlayerState) continue;
+
+		const APlayerFoxState* PlayerFoxState = Cast<APlayerFoxState>(PlayerState);
+		if (PlayerFoxState == nullptr || !PlayerFoxState->GetHasChosenCharacter()) return false;
+		++ReadyPlayers;
+	}
+	return ReadyPlayers > 0;
+}
+
 /**
  * @brief Handles the logic after a player has successfully logged in.
  *
@@ -52,6 +107,7 @@ void ALobbyGameMode::StartGame()
  * 5. Enables player input for the newly logged in player.
  * 6. Checks if the number of players is equal to or exceeds the minimum number of players required to start the game.
  *    If so, it sets the bNumPlayersRequirementFulfilled flag to true.
+ * 7. Re-checks readiness, since the new player has not picked a character yet.
  *
  * @param NewPlayer A pointer to the APlayerController instance representing the newly logged in player.
  */
@@ -67,6 +123,7 @@ void ALobbyGameMode::PostLogin(APlayerController* NewPlayer)
 	{
 		bNumPlayersRequirementFulfilled = true;
 	}
+	CheckReadyToStart();
 }
 
 /**
@@ -101,14 +158,16 @@ bool ALobbyGameMode::IsNumPlayersRequirementFulfilled() const
  * \brief Logout the player.
  * \param Exiting The controller that is logging out.
  *
- * This method is called when a player logs out of the game. It decreases the number of players and l
- * ogs the player count.
+ * This method is called when a player logs out of the game. It decreases the number of players, logs the player
+ * count and re-checks readiness without the leaving player.
  */
 void ALobbyGameMode::Logout(AController* Exiting)
 {
 	Super::Logout(Exiting);
 	--NumberOfPlayers;
+	bNumPlayersRequirementFulfilled = NumberOfPlayers >= MinPlayersToStartGame;
 	LogPlayerCount("Logout");
+	CheckReadyToStart(Exiting);
 }
 
 /**
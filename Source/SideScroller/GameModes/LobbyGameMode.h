@@ -8,6 +8,10 @@
 
 /**
  * ALobbyGameMode is a subclass of ASideScrollerGameModeBase that manages the lobby logic for the game.
+ *
+ * Readiness is event driven: whenever a player picks a character, joins or leaves, CheckReadyToStart looks at the
+ * replicated selection of every APlayerFoxState. Once enough players are in and all of them have picked, a
+ * countdown starts on the server and the game starts when it ends; it is cancelled if that stops being true.
  */
 UCLASS()
 class SIDESCROLLER_API ALobbyGameMode : public ASideScrollerGameModeBase
@@ -28,9 +32,9 @@ public:
 	/**
 	 * @brief Starts the game by transitioning from the lobby to the game level.
 	 *
-	 * This function sets the "SetReadyToStartGame" flag to false in the current game instance and logs a leaving
-	 * lobby message. It then retrieves the current world and enables seamless travel. Finally, it constructs the
-	 * travel URL to the desired game level and initiates the server travel to that level.
+	 * This function is called when the game start countdown ends. It logs a leaving lobby message, retrieves the
+	 * current world and enables seamless travel. Finally, it constructs the travel URL to the desired game level
+	 * and initiates the server travel to that level.
 	 */
 	UFUNCTION(BlueprintCallable)
 	void StartGame();
@@ -49,6 +53,15 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetNumPlayersToStart();
 
+	/**
+	 * @brief Starts the game start countdown if every player is ready, or cancels it if not.
+	 *
+	 * Called by the server whenever readiness may have changed: a player picked a character, joined or left.
+	 *
+	 * @param ExitingController A controller that is leaving and should not be counted, if any.
+	 */
+	void CheckReadyToStart(const AController* ExitingController = nullptr);
+
 	/**
 	 * Called when a new player logs in.
 	 *
@@ -108,4 +121,23 @@ private:
 	 * @see IsNumPlayersRequirementFulfilled()
 	 */
 	bool bNumPlayersRequirementFulfilled = false;
+
+	/**
+	 * @brief The seconds between the last player becoming ready and the game starting.
+	 */
+	UPROPERTY(EditAnywhere)
+	float GameStartCountdown = 3.f;
+
+	/**
+	 * @brief The timer that calls StartGame when the countdown ends.
+	 */
+	FTimerHandle GameStartCountdownTimerHandle;
+
+	/**
+	 * @brief Checks whether every player in the lobby has picked a character.
+	 *
+	 * @param IgnoredPlayerState The player state of a player that is leaving, or nullptr.
+	 * @return True if there is at least one player and all of them have chosen a character.
+	 */
+	bool AreAllPlayersReady(const APlayerState* IgnoredPlayerState) const;
 };
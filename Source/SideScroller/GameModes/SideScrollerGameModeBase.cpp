@@ -8,6 +8,9 @@
 #include "SideScroller/Controllers/GameModePlayerController.h"
 #include "SideScroller/MenuSystem/MainMenu.h"
 #include "UObject/ConstructorHelpers.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "OnlineBeaconHost.h"
+#include "SideScroller/Beacons/ServerInfoBeaconHostObject.h"
 
 /**
  * @brief Default constructor for ASideScrollerGameModeBase.
@@ -32,7 +35,7 @@ ASideScrollerGameModeBase::ASideScrollerGameModeBase()
  * @brief BeginPlay method
  *
  * This method is called when the game starts or when the level is loaded. It plays the background music at the
- * beginning of the game.
+ * beginning of the game and, on listen and dedicated servers, opens the server info beacon.
  *
  * @param None
  *
@@ -46,6 +49,64 @@ void ASideScrollerGameModeBase::BeginPlay()
 	Super::BeginPlay();
 
 	UGameplayStatics::PlaySound2D(AActor::GetWorld(), BackgroundMusic);
+
+	StartServerInfoBeacon();
+}
+
+/**
+ * Closes the server info beacon, if one was opened.
+ *
+ * @param EndPlayReason Why the game mode is leaving play.
+ */
+void ASideScrollerGameModeBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ServerInfoBeaconHost != nullptr)
+	{
+		ServerInfoBeaconHost->DestroyBeacon();
+		ServerInfoBeaconHost = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/**
+ * Opens the server info beacon host and advertises its port, on listen and dedicated servers only.
+ */
+void ASideScrollerGameModeBase::StartServerInfoBeacon()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return;
+
+	const ENetMode NetMode = World->GetNetMode();
+	if (NetMode != NM_ListenServer && NetMode != NM_DedicatedServer) return;
+
+	ServerInfoBeaconHost = World->SpawnActor<AOnlineBeaconHost>();
+	if (ServerInfoBeaconHost == nullptr || !ServerInfoBeaconHost->InitHost())
+	{
+		UE_LOG(LogGameMode, Warning,
+			TEXT("ASideScrollerGameModeBase::StartServerInfoBeacon - Could not open the server info beacon.")
+		);
+		if (ServerInfoBeaconHost != nullptr)
+		{
+			ServerInfoBeaconHost->Destroy();
+			ServerInfoBeaconHost = nullptr;
+		}
+		return;
+	}
+
+	AServerInfoBeaconHostObject* HostObject = World->SpawnActor<AServerInfoBeaconHostObject>();
+	if (HostObject == nullptr) return;
+	ServerInfoBeaconHost->RegisterHost(HostObject);
+	ServerInfoBeaconHost->PauseBeaconRequests(false);
+
+	UE_LOG(LogGameMode, Display,
+		TEXT("ASideScrollerGameModeBase::StartServerInfoBeacon - Server info beacon listening on port %i."),
+		ServerInfoBeaconHost->GetListenPort()
+	);
+	if (USideScrollerGameInstance* SideScrollerGameInstance = Cast<USideScrollerGameInstance>(GetGameInstance()))
+	{
+		SideScrollerGameInstance->AdvertiseBeaconPort(ServerInfoBeaconHost->GetListenPort());
+	}
 }
 
 /**
@@ -72,6 +133,7 @@ void ASideScrollerGameModeBase::QuitGameHard() const
  */
 void ASideScrollerGameModeBase::Tick(float DeltaTime)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaTime);
 
 	if (const AGameModeBase* CurrentGameMode = Cast<AGameModeBase>(UGameplayStatics::GetGameMode(GetWorld()));
@@ -41,6 +41,13 @@ public:
 	 */
 	virtual void BeginPlay() override;
 
+	/**
+	 * @brief Closes the server info beacon opened in BeginPlay.
+	 *
+	 * @param EndPlayReason Why the game mode is leaving play.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * @brief Quits the game forcefully.
 	 *
@@ -175,6 +182,21 @@ private:
 	UFUNCTION(BlueprintCallable, Category = Players)
 	void PrintPlayersList();
 
+	/**
+	 * @brief The beacon host listening for server info beacons, while this game mode runs a listen or dedicated
+	 * server.
+	 */
+	UPROPERTY()
+	class AOnlineBeaconHost* ServerInfoBeaconHost = nullptr;
+
+	/**
+	 * @brief Opens a beacon host with an AServerInfoBeaconHostObject on it and advertises its port in the session.
+	 *
+	 * Lets the server browser query player counts, the current level and the ping of this server without a session
+	 * search. Does nothing when the world is not a listen or dedicated server.
+	 */
+	void StartServerInfoBeacon();
+
 protected:
 	/**
 	 * Enables game mode input for a given player.
@@ -1,6 +1,9 @@
 #include "LevelGameState.h"
 
+#include "Misc/CommandLine.h"
+#include "Net/UnrealNetwork.h"
 #include "SideScroller/SideScrollerGameInstance.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
 /**
  * Opens the respawn menu.
@@ -46,4 +49,172 @@ void ALevelGameState::OpenInGameMenu()
 			TEXT("ASideScrollerGameState::OpenInGameMenu - Cant find GameInstance!")
 		);
 	}
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Shows the game over menu on this machine.
+ *
+ * Runs on the server and on every client, so each player sees the menu over the level they just lost.
+ */
+void ALevelGameState::MulticastShowGameOverMenu_Implementation()
+{
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (GameInstance != nullptr) {
+		GameInstance->GameOverLoadMenu();
+	} else {
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameState::MulticastShowGameOverMenu - Cant find GameInstance!")
+		);
+	}
+}
+
+/**
+ * @brief Resets the level in place on this machine.
+ *
+ * Takes down the game over menu, then lets the ULevelResetSubsystem restore every registered actor. Actors that do
+ * not replicate (pickups) are only ever restored this way, so the reset has to run on every machine. The random
+ * stream starts over first, so the restarted level draws the same numbers as the first try.
+ */
+void ALevelGameState::MulticastResetLevel_Implementation()
+{
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (GameInstance != nullptr) {
+		GameInstance->GameOverUnloadMenu();
+	} else {
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameState::MulticastResetLevel - Cant find GameInstance!")
+		);
+	}
+
+	this->RandomStream.Reset();
+
+	ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>();
+	if (LevelReset == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameState::MulticastResetLevel - Cant find LevelResetSubsystem!")
+		);
+		return;
+	}
+	LevelReset->ResetLevel();
+}
+
+/**
+ * Asks the game instance to preload the level's map.
+ *
+ * @param Level The number of the level to preload.
+ */
+void ALevelGameState::MulticastPreloadLevel_Implementation(const int Level)
+{
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	if (GameInstance != nullptr) {
+		GameInstance->PreloadLevel(Level);
+	} else {
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelGameState::MulticastPreloadLevel - Cant find GameInstance!")
+		);
+	}
+}
+
+/**
+ * This level is up now, built from the map preloaded for it if there was one, so the game instance can let go of it.
+ */
+void ALevelGameState::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance()))
+	{
+		GameInstance->ReleasePreloadedLevel();
+	}
+}
+
+/**
+ * Picks the random seed on the server: the one given with -RandomSeed=<Seed>, or else a new one.
+ *
+ * Runs before the level's actors begin play, so their first draws already come from the seeded stream.
+ */
+void ALevelGameState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	if (!this->HasAuthority()) return;
+
+	int32 Seed = 0;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("RandomSeed="), Seed))
+	{
+		Seed = FMath::Rand();
+	}
+	this->SetRandomSeed(Seed);
+}
+
+/**
+ * Registers the random seed for replication.
+ *
+ * @param OutLifetimeProps The replicated properties of the game state.
+ */
+void ALevelGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(ALevelGameState, RandomSeed);
+}
+
+/**
+ * Returns the seed the level's random stream started from.
+ *
+ * @return The random seed.
+ */
+int32 ALevelGameState::GetRandomSeed() const
+{
+	return this->RandomSeed;
+}
+
+/**
+ * Restarts the level's random stream from the given seed, on the server.
+ *
+ * @param NewSeed The seed to start from.
+ */
+void ALevelGameState::SetRandomSeed(const int32 NewSeed)
+{
+	if (!this->HasAuthority()) return;
+
+	this->RandomSeed = NewSeed;
+	this->RandomStream.Initialize(NewSeed);
+	UE_LOG(LogTemp, Display, TEXT("ALevelGameState::SetRandomSeed - Random seed is %i."), NewSeed);
+}
+
+/**
+ * Returns the level's random stream.
+ *
+ * @return The random stream.
+ */
+FRandomStream& ALevelGameState::GetRandomStream()
+{
+	return this->RandomStream;
+}
+
+/**
+ * Returns the random stream of the object's level, or a shared fallback stream if the level has no level game state.
+ *
+ * @param WorldContextObject Any object in the level.
+ * @return The random stream to draw from.
+ */
+FRandomStream& ALevelGameState::GetLevelRandomStream(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (ALevelGameState* LevelGameState = World ? World->GetGameState<ALevelGameState>() : nullptr)
+	{
+		return LevelGameState->GetRandomStream();
+	}
+
+	static FRandomStream FallbackStream(0);
+	return FallbackStream;
+}
+
+/**
+ * Restarts the random stream on a client once the server's seed arrived.
+ */
+void ALevelGameState::OnRep_RandomSeed()
+{
+	this->RandomStream.Initialize(this->RandomSeed);
+}
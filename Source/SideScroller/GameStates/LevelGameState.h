@@ -9,6 +9,10 @@
 /**
  * ALevelGameState is a subclass of ASideScrollerGameState.
  * It represents the game state for a level in a side-scrolling game.
+ *
+ * It owns the level's random stream. Every random draw gameplay makes goes through GetLevelRandomStream, so a level
+ * played with the same seed and the same input plays out the same; the seed is picked by the server (or given with
+ * -RandomSeed=<Seed>) and replicated, and the stream starts over whenever the level is reset.
  */
 UCLASS()
 class SIDESCROLLER_API ALevelGameState : public ASideScrollerGameState
@@ -35,4 +39,102 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable) 
 	void OpenInGameMenu();
+
+	/**
+	 * @brief Shows the game over menu over the level on the server and on every client.
+	 *
+	 * Called by ALevelGameMode::ShowGameOverMenu once every player is out of lives. The level itself stays loaded so
+	 * restarting can reset it in place.
+	 */
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastShowGameOverMenu();
+
+	/**
+	 * @brief Resets the level in place on the server and on every client.
+	 *
+	 * Takes down the game over menu and asks the ULevelResetSubsystem to put every enemy, pickup, interactable,
+	 * platform and checkpoint back into the state it began play in. Called by ALevelGameMode::RestartLevel, which
+	 * respawns the players afterwards.
+	 */
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastResetLevel();
+
+	/**
+	 * @brief Preloads the given level's map on the server and on every client.
+	 *
+	 * Called by ALevelGameMode::PreloadNextLevel, so clients have the next map in memory when the server travels
+	 * too, instead of loading it cold once the travel reaches them.
+	 *
+	 * @param Level The number of the level to preload.
+	 */
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastPreloadLevel(int Level);
+
+	/**
+	 * @brief Releases the level the game instance preloaded for this one, on the server and on every client.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Picks the level's random seed on the server, before any level actor begins play.
+	 */
+	virtual void PostInitializeComponents() override;
+
+	/**
+	 * @brief Registers RandomSeed for replication.
+	 *
+	 * @param OutLifetimeProps The replicated properties of the game state.
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * @brief Gets the seed the level's random stream started from.
+	 *
+	 * @return The random seed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Random")
+	int32 GetRandomSeed() const;
+
+	/**
+	 * @brief Restarts the level's random stream from the given seed. Only has an effect on the server.
+	 *
+	 * @param NewSeed The seed to start from.
+	 */
+	void SetRandomSeed(int32 NewSeed);
+
+	/**
+	 * @brief Gets the level's random stream.
+	 *
+	 * @return The random stream every gameplay random draw goes through.
+	 */
+	FRandomStream& GetRandomStream();
+
+	/**
+	 * @brief Gets the random stream of the level the given object is in.
+	 *
+	 * Falls back to a shared stream with a fixed seed while there is no level game state, like on a client whose game
+	 * state has not replicated yet, so callers never have to check.
+	 *
+	 * @param WorldContextObject Any object in the level.
+	 * @return The level's random stream, or the fallback stream.
+	 */
+	static FRandomStream& GetLevelRandomStream(const UObject* WorldContextObject);
+
+private:
+	/**
+	 * @brief Restarts the random stream from the seed the server picked.
+	 */
+	UFUNCTION()
+	void OnRep_RandomSeed();
+
+	/**
+	 * @brief The seed the level's random stream started from.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_RandomSeed)
+	int32 RandomSeed = 0;
+
+	/**
+	 * @brief The level's random stream.
+	 */
+	FRandomStream RandomStream;
 };
@@ -3,6 +3,8 @@
 
 #include "LobbyGameState.h"
 
+#include "GameFramework/PlayerState.h"
+#include "Net/UnrealNetwork.h"
 #include "SideScroller/SideScrollerGameInstance.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 
@@ -101,3 +103,177 @@ void ALobbyGameState::OpenSelectCharacterMenu()
 		);
 	}
 }
+
+/**
+ * Gets the claimed roster characters.
+ *
+ * @return A bitmask with bit N set if the character at index N of the roster is taken.
+ */
+uint32 ALobbyGameState::GetClaimedCharacters() const
+{
+	return ClaimedCharacters;
+}
+
+/**
+ * Checks whether the roster character at the given index is taken.
+ *
+ * @param RosterIndex The index of the character in the roster.
+ * @return True if a player has claimed the character.
+ */
+bool ALobbyGameState::IsCharacterClaimed(const int32 RosterIndex) const
+{
+	if (RosterIndex < 0 || RosterIndex >= MaxClaimableCharacters) return false;
+	return (ClaimedCharacters & (1u << RosterIndex)) != 0;
+}
+
+/**
+ * Claims a roster character for a player and releases the character they claimed before, if any.
+ *
+ * @param PlayerState The player that spawned as the character.
+ * @param RosterIndex The index of the character in the roster.
+ */
+void ALobbyGameState::ClaimCharacter(APlayerState* PlayerState, const int32 RosterIndex)
+{
+	if (!HasAuthority() || PlayerState == nullptr) return;
+	if (RosterIndex < 0 || RosterIndex >= MaxClaimableCharacters)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALobbyGameState::ClaimCharacter - Roster index %i does not fit the claimed characters mask."),
+			RosterIndex
+		);
+		return;
+	}
+
+	uint32 NewClaimedCharacters = ClaimedCharacters;
+	if (const int32* PreviousRosterIndex = PlayerClaimedCharacters.Find(PlayerState))
+	{
+		NewClaimedCharacters &= ~(1u << *PreviousRosterIndex);
+	}
+	NewClaimedCharacters |= 1u << RosterIndex;
+	PlayerClaimedCharacters.Add(PlayerState, RosterIndex);
+
+	UE_LOG(LogTemp, Display,
+		TEXT("ALobbyGameState::ClaimCharacter - %s claimed roster character %i."),
+		*PlayerState->GetPlayerName(),
+		RosterIndex
+	);
+	SetClaimedCharacters(NewClaimedCharacters);
+}
+
+/**
+ * Releases the character of a player leaving the lobby.
+ *
+ * @param PlayerState The player state being removed.
+ */
+void ALobbyGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	if (HasAuthority())
+	{
+		int32 ReleasedRosterIndex;
+		if (PlayerClaimedCharacters.RemoveAndCopyValue(PlayerState, ReleasedRosterIndex))
+		{
+			SetClaimedCharacters(ClaimedCharacters & ~(1u << ReleasedRosterIndex));
+		}
+	}
+	Super::RemovePlayerState(PlayerState);
+}
+
+/**
+ * Notifies listeners on clients that the claimed characters changed.
+ */
+void ALobbyGameState::OnRep_ClaimedCharacters()
+{
+	OnClaimedCharactersChanged.Broadcast();
+}
+
+/**
+ * Replaces the claimed characters and broadcasts the change, since OnRep does not run on the server.
+ *
+ * @param NewClaimedCharacters The new bitmask.
+ */
+void ALobbyGameState::SetClaimedCharacters(const uint32 NewClaimedCharacters)
+{
+	if (ClaimedCharacters == NewClaimedCharacters) return;
+
+	ClaimedCharacters = NewClaimedCharacters;
+	OnClaimedCharactersChanged.Broadcast();
+}
+
+/**
+ * Checks whether the game start countdown is running.
+ *
+ * @return True if the game will start once the countdown ends.
+ */
+bool ALobbyGameState::IsGameStartCountdownActive() const
+{
+	return GameStartCountdownEndTime > 0.0;
+}
+
+/**
+ * Gets the time left until the game starts, measured against the replicated server world time.
+ *
+ * @return The seconds left in the countdown, or 0 if there is no countdown.
+ */
+float ALobbyGameState::GetGameStartCountdownRemaining() const
+{
+	if (!IsGameStartCountdownActive()) return 0.f;
+	return FMath::Max(0.f, static_cast<float>(GameStartCountdownEndTime - GetServerWorldTimeSeconds()));
+}
+
+/**
+ * Starts or cancels the replicated game start countdown.
+ *
+ * @param EndTime The server world time the countdown ends at, or 0 to cancel it.
+ */
+void ALobbyGameState::SetGameStartCountdownEndTime(const double EndTime)
+{
+	if (!HasAuthority() || GameStartCountdownEndTime == EndTime) return;
+
+	GameStartCountdownEndTime = EndTime;
+	NotifyGameStartCountdownChanged();
+}
+
+/**
+ * Notifies listeners on clients that the game start countdown started or was cancelled.
+ */
+void ALobbyGameState::OnRep_GameStartCountdownEndTime()
+{
+	NotifyGameStartCountdownChanged();
+}
+
+/**
+ * Tells the local player how long until the game starts, or that the start was cancelled, and notifies listeners.
+ */
+void ALobbyGameState::NotifyGameStartCountdownChanged()
+{
+	const bool bIsCountingDown = IsGameStartCountdownActive();
+	UE_LOG(LogTemp, Display,
+		TEXT("ALobbyGameState::NotifyGameStartCountdownChanged - %s"),
+		bIsCountingDown ? TEXT("All players ready, game starting soon.") : TEXT("Game start cancelled.")
+	);
+
+	if (GEngine != nullptr && GetNetMode() != NM_DedicatedServer)
+	{
+		const float Remaining = GetGameStartCountdownRemaining();
+		GEngine->AddOnScreenDebugMessage(0,
+			bIsCountingDown ? Remaining : 2.f,
+			bIsCountingDown ? FColor::Green : FColor::Yellow,
+			bIsCountingDown
+				? FString::Printf(TEXT("All players are ready, the game is launching in %.0f seconds."), Remaining)
+				: FString(TEXT("A player is not ready anymore, the game launch was cancelled."))
+		);
+	}
+	OnGameStartCountdownChanged.Broadcast();
+}
+
+/**
+ * Registers the claimed characters and the game start countdown for replication.
+ *
+ * @param OutLifetimeProps The replicated properties of the game state.
+ */
+void ALobbyGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(ALobbyGameState, ClaimedCharacters);
+	DOREPLIFETIME(ALobbyGameState, GameStartCountdownEndTime);
+}
@@ -6,12 +6,29 @@
 #include "SideScrollerGameState.h"
 #include "LobbyGameState.generated.h"
 
+/**
+ * @brief Broadcast on the server and on every client when the set of claimed characters changed.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnClaimedCharactersChanged);
+
+/**
+ * @brief Broadcast on the server and on every client when the game start countdown started or was cancelled.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnGameStartCountdownChanged);
+
 /**
  * @class ALobbyGameState
  * @brief A class representing the lobby game state in a side scroller game.
  *
  * The ALobbyGameState class is derived from the ASideScrollerGameState class and extends its functionality
  * to include player character selection and opening the character selection menu.
+ *
+ * It also replicates which roster characters are taken, as a bitmask indexed by the characters' positions in the
+ * UCharacterRoster. The server sets a player's bit when their character is spawned and clears it when they pick
+ * another one or leave; the select character menu only refreshes its buttons when OnClaimedCharactersChanged fires.
+ *
+ * While the lobby game mode counts down to the start of the game, the server time the countdown ends at is
+ * replicated as well, so every machine can show the time left without asking the server.
  */
 UCLASS()
 class SIDESCROLLER_API ALobbyGameState : public ASideScrollerGameState
@@ -44,8 +61,123 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable)
 	void OpenSelectCharacterMenu();
+
+	/**
+	 * @brief Gets the roster characters that players have claimed.
+	 *
+	 * @return A bitmask with bit N set if the character at index N of the roster is taken.
+	 */
+	uint32 GetClaimedCharacters() const;
+
+	/**
+	 * @brief Checks whether a roster character is taken.
+	 *
+	 * @param RosterIndex The index of the character in the roster.
+	 * @return True if a player has claimed the character.
+	 */
+	bool IsCharacterClaimed(int32 RosterIndex) const;
+
+	/**
+	 * @brief Claims a roster character for a player, releasing the one they had before. Server only.
+	 *
+	 * @param PlayerState The player that spawned as the character.
+	 * @param RosterIndex The index of the character in the roster.
+	 */
+	void ClaimCharacter(APlayerState* PlayerState, int32 RosterIndex);
+
+	/**
+	 * @brief Releases the character of a player that left the lobby, on the server.
+	 *
+	 * @param PlayerState The player state being removed.
+	 */
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
+	/**
+	 * @brief Broadcast whenever ClaimedCharacters changed, on the server and on every client.
+	 */
+	FOnClaimedCharactersChanged OnClaimedCharactersChanged;
+
+	/**
+	 * @brief Checks whether the game start countdown is running.
+	 *
+	 * @return True if the game will start once the countdown ends.
+	 */
+	bool IsGameStartCountdownActive() const;
+
+	/**
+	 * @brief Gets the time left until the game starts.
+	 *
+	 * @return The seconds left in the countdown, or 0 if there is no countdown.
+	 */
+	float GetGameStartCountdownRemaining() const;
+
+	/**
+	 * @brief Starts or cancels the replicated game start countdown. Server only.
+	 *
+	 * @param EndTime The server world time the countdown ends at, or 0 to cancel it.
+	 */
+	void SetGameStartCountdownEndTime(double EndTime);
+
+	/**
+	 * @brief Broadcast whenever the game start countdown started or was cancelled, on the server and every client.
+	 */
+	FOnGameStartCountdownChanged OnGameStartCountdownChanged;
+
+	/**
+	 * @brief Registers ClaimedCharacters and GameStartCountdownEndTime for replication.
+	 *
+	 * @param OutLifetimeProps The replicated properties of the game state.
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	
 private:
+	/**
+	 * @brief How many roster characters fit in ClaimedCharacters, one per bit.
+	 */
+	static constexpr int32 MaxClaimableCharacters = 32;
+
+	/**
+	 * @brief The claimed roster characters, one bit per roster index, so the roster can hold up to
+	 * MaxClaimableCharacters characters. Unsigned, so the bit of index 31 is not the sign bit.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_ClaimedCharacters)
+	uint32 ClaimedCharacters = 0;
+
+	/**
+	 * @brief Called on clients when ClaimedCharacters is replicated. Broadcasts OnClaimedCharactersChanged.
+	 */
+	UFUNCTION()
+	void OnRep_ClaimedCharacters();
+
+	/**
+	 * @brief Replaces the claimed characters and broadcasts the change, if there is one. Server only.
+	 *
+	 * @param NewClaimedCharacters The new bitmask.
+	 */
+	void SetClaimedCharacters(uint32 NewClaimedCharacters);
+
+	/**
+	 * @brief The server world time the game start countdown ends at, or 0 while there is no countdown.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_GameStartCountdownEndTime)
+	double GameStartCountdownEndTime = 0.0;
+
+	/**
+	 * @brief Called on clients when GameStartCountdownEndTime is replicated.
+	 */
+	UFUNCTION()
+	void OnRep_GameStartCountdownEndTime();
+
+	/**
+	 * @brief Tells the local player the game is about to start and broadcasts OnGameStartCountdownChanged.
+	 */
+	void NotifyGameStartCountdownChanged();
+
+	/**
+	 * @brief The roster index each player has claimed, so it can be released again. Only kept on the server.
+	 */
+	TMap<TWeakObjectPtr<APlayerState>, int32> PlayerClaimedCharacters;
+
 	/**
 	 * @brief Timer handle for character select delay.
 	 *
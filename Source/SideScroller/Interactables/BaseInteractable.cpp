@@ -6,9 +6,13 @@
 #include "Components/BoxComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
 /**
  * Initialize the ABaseInteractable object.
+ *
+ * The actor replicates but starts out net dormant; it is woken up whenever its state changes. Doors and levers change
+ * rarely, so they replicate at a low rate, with a little priority over scenery while they are awake.
  */
 ABaseInteractable::ABaseInteractable()
 {
@@ -40,7 +44,10 @@ ABaseInteractable::ABaseInteractable()
 	}
 	
 	this->SetReplicates(true);
-	this->InteractableFlipbook->SetIsReplicated(true);
+	this->NetDormancy = DORM_DormantAll;
+	this->NetUpdateFrequency = 10.f;
+	this->MinNetUpdateFrequency = 1.f;
+	this->NetPriority = 1.5f;
 }
 
 /**
@@ -53,9 +60,11 @@ ABaseInteractable::ABaseInteractable()
  * - Sets the InteractableBox to generate overlap events.
  * - Adds a dynamic delegate to the InteractableBox's OnComponentBeginOverlap event, which will call the
  * OnBeginOverlapDelegate method.
- * - Sets the InteractableFlipbook to display the FalsePosition flipbook.
+ * - Sets the InteractableFlipbook to display the flipbook matching bIsTrue (FalsePosition unless already replicated
+ * as true).
  * - Checks if the InteractPrompt widget is not null. If it is not null, it hides the widget and sets its relative
  * location to (0.000000, 0.000000, 10.000000).
+ * - Remembers the initial state and registers the interactable with the ULevelResetSubsystem.
  *
  * @param None.
  * @return None.
@@ -67,13 +76,19 @@ void ABaseInteractable::BeginPlay()
 	this->InteractableBox->SetGenerateOverlapEvents(true);
 	this->InteractableBox->OnComponentBeginOverlap.AddDynamic(this, &ABaseInteractable::OnBeginOverlapDelegate);
 
-	InteractableFlipbook->SetFlipbook(FalsePosition);
+	InteractableFlipbook->SetFlipbook(bIsTrue ? TruePosition : FalsePosition);
 
 	if (this->InteractPrompt->GetWidget() != nullptr)
 	{
 		this->InteractPrompt->GetWidget()->SetVisibility(ESlateVisibility::Hidden);
 		this->InteractPrompt->SetRelativeLocation(FVector {0.000000,0.000000,10.000000});
 	}
+
+	this->bInitialIsTrue = bIsTrue;
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->RegisterActor(this);
+	}
 }
 
 /**
@@ -92,13 +107,60 @@ bool ABaseInteractable::GetCanInteract() const
  * \param CanInteract   The new value indicating if interaction is allowed or not.
  *
  * This method updates the value of the 'bCanInteract' member variable, which determines
- * whether the interactable object can be interacted with or not.
+ * whether the interactable object can be interacted with or not. The actor's net dormancy is flushed first so the
+ * change replicates.
  */
 void ABaseInteractable::SetCanInteract(const bool CanInteract)
 {
+	this->FlushNetDormancy();
 	this->bCanInteract = CanInteract;
 }
 
+/**
+ * Makes the interactable interactable again and restores its initial true/false state. Replicated state is only
+ * changed on the server.
+ */
+void ABaseInteractable::ResetToInitialState()
+{
+	if (!HasAuthority()) return;
+
+	SetCanInteract(true);
+	SetIsTrue(this->bInitialIsTrue);
+}
+
+/**
+ * Sets the flipbook to match the replicated state of the interactable and notifies listeners.
+ */
+void ABaseInteractable::OnRep_IsTrue()
+{
+	InteractableFlipbook->SetFlipbook(bIsTrue ? TruePosition : FalsePosition);
+	NotifyStateChanged();
+}
+
+/**
+ * Sets the true/false state of the interactable, updates its flipbook and notifies listeners. The actor's net
+ * dormancy is flushed first so the change replicates even when no SetCanInteract call comes with it.
+ *
+ * @param bNewIsTrue The new state.
+ */
+void ABaseInteractable::SetIsTrue(const bool bNewIsTrue)
+{
+	if (bIsTrue == bNewIsTrue) return;
+
+	this->FlushNetDormancy();
+	bIsTrue = bNewIsTrue;
+	InteractableFlipbook->SetFlipbook(bIsTrue ? TruePosition : FalsePosition);
+	NotifyStateChanged();
+}
+
+/**
+ * Broadcasts OnStateChanged with the current state.
+ */
+void ABaseInteractable::NotifyStateChanged()
+{
+	OnStateChanged.Broadcast(this, bIsTrue);
+}
+
 /**
  * Called when this interactable object begins overlapping with another actor.
  *
@@ -194,6 +256,5 @@ void ABaseInteractable::GetLifetimeReplicatedProps( TArray< FLifetimeProperty >
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(ABaseInteractable, bIsTrue);
-	DOREPLIFETIME(ABaseInteractable, InteractableFlipbook);
 	DOREPLIFETIME(ABaseInteractable, bCanInteract);
 }
\ No newline at end of file
@@ -8,8 +8,19 @@
 #include "PaperSpriteActor.h"
 #include "Components/BoxComponent.h"
 #include "Components/WidgetComponent.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
 #include "BaseInteractable.generated.h"
 
+class ABaseInteractable;
+
+/**
+ * @brief Broadcast when an interactable's true/false state changes.
+ *
+ * @param Interactable The interactable whose state changed.
+ * @param bIsTrue The new state.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInteractableStateChanged, ABaseInteractable* /*Interactable*/, bool /*bIsTrue*/);
+
 /**
  * @class ABaseInteractable
  *
@@ -19,10 +30,17 @@
  * in a side-scrolling game. It contains methods to get and set the ability to interact, as well as properties for
  * interact prompt and flipbook components.
  *
+ * Interactables sit idle most of the time, so they are net dormant (DORM_DormantAll) and do not tick. Changing their
+ * state through SetCanInteract or SetIsTrue flushes the dormancy so the change replicates, after which they go dormant
+ * again.
+ *
+ * Interactables register with the ULevelResetSubsystem and go back to the state they began play in when the level
+ * is reset.
+ *
  * @see APaperSpriteActor
  */
 UCLASS()
-class SIDESCROLLER_API ABaseInteractable : public APaperSpriteActor
+class SIDESCROLLER_API ABaseInteractable : public APaperSpriteActor, public IResettableInterface
 {
 	GENERATED_BODY()
 
@@ -45,10 +63,29 @@ public:
 	/**
 	 * Sets the value of the CanInteract property.
 	 *
+	 * Every interaction starts (false) and finishes (true) by calling this, so it also flushes the actor's net
+	 * dormancy to get the new state (and any state changed alongside it) out to clients.
+	 *
 	 * @param CanInteract The new value for the CanInteract property.
 	 */
 	UFUNCTION()
 	void SetCanInteract(const bool CanInteract);
+
+	/**
+	 * @brief Broadcast on the server and on clients whenever bIsTrue changes.
+	 *
+	 * Lets other actors react to the interactable instead of polling it every frame.
+	 */
+	FOnInteractableStateChanged OnStateChanged;
+
+	/**
+	 * @brief Puts the interactable back into the state it began play in.
+	 *
+	 * On the server the interactable is made interactable again and bIsTrue is set back to its initial value, which
+	 * swaps the flipbook and notifies listeners (doors and levers fire their own events from there). Pending
+	 * open/close/move timers have already been cleared by the ULevelResetSubsystem.
+	 */
+	virtual void ResetToInitialState() override;
 	
 private:
 	/**
@@ -101,11 +138,18 @@ private:
 	UPROPERTY(EditAnywhere)
 	UWidgetComponent* InteractPrompt;
 
+	/**
+	 * @brief The value bIsTrue had when the interactable began play, restored by ResetToInitialState.
+	 */
+	bool bInitialIsTrue = false;
+
 protected:
 	/**
-	 * Represents a replicated PaperFlipbookComponent used for interactable objects.
+	 * Represents the PaperFlipbookComponent used for interactable objects.
+	 *
+	 * Not replicated; every machine sets the flipbook itself from bIsTrue.
 	 */
-	UPROPERTY(replicated)
+	UPROPERTY()
 	UPaperFlipbookComponent* InteractableFlipbook;
 
 	/**
@@ -141,9 +185,34 @@ protected:
 	 * The value of this variable determines the state of an action - true for active or completed, false for
 	 * inactive or incomplete.
 	 */
-	UPROPERTY(replicated)
+	UPROPERTY(ReplicatedUsing=OnRep_IsTrue)
 	bool bIsTrue;
 
+	/**
+	 * @brief Called on clients when bIsTrue is replicated.
+	 *
+	 * Shows the TruePosition or FalsePosition flipbook to match the new state and notifies listeners.
+	 */
+	UFUNCTION()
+	void OnRep_IsTrue();
+
+	/**
+	 * @brief Sets the true/false state of the interactable.
+	 *
+	 * Updates bIsTrue, shows the matching flipbook and calls NotifyStateChanged. Does nothing if the state is
+	 * unchanged.
+	 *
+	 * @param bNewIsTrue The new state.
+	 */
+	void SetIsTrue(bool bNewIsTrue);
+
+	/**
+	 * @brief Tells listeners that bIsTrue changed.
+	 *
+	 * Broadcasts OnStateChanged. Subclasses override this to fire their own, more specific events.
+	 */
+	virtual void NotifyStateChanged();
+
 	/**
 	 * @brief Called when an actor stops overlapping with this interactable object.
 	 *
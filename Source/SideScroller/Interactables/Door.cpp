@@ -3,7 +3,8 @@
 
 #include "Door.h"
 
-#include "Kismet/GameplayStatics.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Subsystems/CosmeticCueSubsystem.h"
 
 /**
  * @brief Constructor for the ADoor class.
@@ -50,14 +51,13 @@ void ADoor::ToggleDoor()
 /**
  * @brief Close the door and set it to the closed position.
  *
- * This method sets the door to the closed position by updating the flipbook and setting
- * the interactivity of the door to true.
+ * This method sets the door to the closed position by updating its state (which swaps the flipbook and fires
+ * OnClosed) and setting the interactivity of the door to true.
  */
 void ADoor::CloseDoor()
 {
 	UE_LOG(LogTemp, Display, TEXT("ADoor::CloseDoor - Setting door to closed"))
-	bIsTrue = false;
-	InteractableFlipbook->SetFlipbook(FalsePosition);
+	SetIsTrue(false);
 
 	SetCanInteract(true);
 }
@@ -67,31 +67,34 @@ void ADoor::CloseDoor()
  *
  * This method sets the door to open by performing the following actions:
  * - Prints a log message using UE_LOG to indicate that the door is being set to open.
- * - Sets the bIsTrue variable to true indicating that the door is open.
- * - Sets the InteractableFlipbook's flipbook to TruePosition, which represents the open position of the door.
+ * - Sets the door's state to true (open), which shows the TruePosition flipbook and fires OnOpened.
  * - Enables interaction with the door by setting the CanInteract variable to true.
  */
 void ADoor::OpenDoor()
 {
 	UE_LOG(LogTemp, Display, TEXT("ADoor::OpenDoor - Setting door to open"))
-	bIsTrue = true;
-	InteractableFlipbook->SetFlipbook(TruePosition);
+	SetIsTrue(true);
 
 	SetCanInteract(true);
 }
 
 /**
- * Plays the specified door sound when the door is interacted with.
+ * Plays the door open or close sound of a DoorOpen or DoorClose cue.
  *
- * @param DoorSound The sound to play.
- * @return void
+ * @param Cue The cue to play.
+ * @param Location Where the cue happened on the server.
  */
-void ADoor::PlayDoorSound_Implementation(USoundBase* DoorSound) const
+void ADoor::PlayCosmeticCue(const ECosmeticCue Cue, const FVector& Location)
 {
-	UGameplayStatics::SpawnSoundAttached(
+	USoundBase* DoorSound = nullptr;
+	if (Cue == ECosmeticCue::DoorOpen) DoorSound = this->DoorOpenSound;
+	else if (Cue == ECosmeticCue::DoorClose) DoorSound = this->DoorCloseSound;
+
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		DoorSound,
 		this->InteractableFlipbook,
-		TEXT("DoorSound")
+		EAudioEventCategory::Interactable
 	);
 }
 
@@ -106,7 +109,7 @@ void ADoor::PlayDoorSound_Implementation(USoundBase* DoorSound) const
  */
 void ADoor::CloseDoorSoundAndTimer()
 {
-	PlayDoorSound(DoorCloseSound);
+	UCosmeticCueSubsystem::SendCue(this, ECosmeticCue::DoorClose);
 
 	GetWorld()->GetTimerManager().SetTimer(
 		this->DoorCloseTimerHandle,
@@ -129,7 +132,7 @@ void ADoor::CloseDoorSoundAndTimer()
  */
 void ADoor::OpenDoorSoundAndTimer()
 {
-	PlayDoorSound(DoorOpenSound);
+	UCosmeticCueSubsystem::SendCue(this, ECosmeticCue::DoorOpen);
 
 	GetWorld()->GetTimerManager().SetTimer(
 		this->DoorOpenTimerHandle,
@@ -149,3 +152,20 @@ bool ADoor::GetIsOpen() const
 {
 	return bIsTrue;
 }
+
+/**
+ * @brief Notifies listeners that the door opened or closed.
+ */
+void ADoor::NotifyStateChanged()
+{
+	Super::NotifyStateChanged();
+
+	if (bIsTrue)
+	{
+		OnOpened.Broadcast(this);
+	}
+	else
+	{
+		OnClosed.Broadcast(this);
+	}
+}
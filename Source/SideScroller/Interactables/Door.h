@@ -4,9 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "BaseInteractable.h"
+#include "SideScroller/Interfaces/CosmeticCueInterface.h"
 #include "SideScroller/Interfaces/InteractInterface.h"
 #include "Door.generated.h"
 
+class ADoor;
+
+/**
+ * @brief Broadcast when a door finishes opening or closing.
+ *
+ * @param Door The door that opened or closed.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDoorStateChanged, ADoor* /*Door*/);
+
 /**
  * @class ADoor
  * @brief Represents a door in the side scroller game.
@@ -18,7 +28,7 @@
  * @see IInteractInterface
  */
 UCLASS()
-class SIDESCROLLER_API ADoor : public ABaseInteractable, public IInteractInterface
+class SIDESCROLLER_API ADoor : public ABaseInteractable, public IInteractInterface, public ICosmeticCueInterface
 {
 	GENERATED_BODY()
 
@@ -82,8 +92,7 @@ public:
 	 * It plays the specified door open sound and sets a timer to automatically close the door after a certain
 	 * amount of time.
 	 *
-	 * @note This method assumes that the `PlayDoorSound` function and `GetWorld()->GetTimerManager()` are
-	 * already available.
+	 * @note The sound is sent to nearby players as a DoorOpen cue through the UCosmeticCueSubsystem.
 	 *
 	 * @param None
 	 *
@@ -93,11 +102,37 @@ public:
 	void OpenDoorSoundAndTimer();
 
 	/**
+	 * @brief Get the state of the door, whether it is open or not.
 	 *
+	 * @return True if the door is open, false otherwise.
 	 */
 	UFUNCTION(BlueprintCallable)
 	bool GetIsOpen() const;
 
+	/**
+	 * @brief Broadcast on the server and on clients when the door has opened.
+	 */
+	FOnDoorStateChanged OnOpened;
+
+	/**
+	 * @brief Broadcast on the server and on clients when the door has closed.
+	 */
+	FOnDoorStateChanged OnClosed;
+
+	/**
+	 * @brief Plays the door open or close sound of a DoorOpen or DoorClose cue.
+	 *
+	 * @param Cue The cue to play.
+	 * @param Location Where the cue happened on the server.
+	 */
+	virtual void PlayCosmeticCue(ECosmeticCue Cue, const FVector& Location) override;
+
+protected:
+	/**
+	 * @brief Broadcasts OnStateChanged, then OnOpened or OnClosed depending on the new state.
+	 */
+	virtual void NotifyStateChanged() override;
+
 private:
 	/**
 	 * @brief Toggles the state of the door.
@@ -132,21 +167,6 @@ private:
 	UFUNCTION(BlueprintCallable)
 	void OpenDoor();
 
-	/**
-	 * \brief Play a sound when a door is opened or closed.
-	 *
-	 * This function is a BlueprintCallable function, which means it can be
-	 * accessed from Blueprints. It is also a NetMulticast function, which means
-	 * it is called on both the server and all connected clients. It is reliable, meaning that
-	 * the function will be resent if it gets lost during network transmission.
-	 *
-	 * \param DoorSound The sound to be played when the door is opened or closed.
-	 *
-	 * \remarks This function does not return anything. It simply plays the specified sound when called.
-	 */
-	UFUNCTION(BlueprintCallable, NetMulticast, Reliable)
-	void PlayDoorSound(USoundBase* DoorSound) const;
-
 	/**
 	 * @brief The sound that plays when the door is opened.
 	 *
@@ -3,9 +3,10 @@
 
 #include "Lever.h"
 
-#include "Kismet/GameplayStatics.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "SideScroller/Mechanics/PlatformBlocks/MovingPlatform.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Subsystems/CosmeticCueSubsystem.h"
 
 /**
  * @brief Constructor for the ALever class.
@@ -55,8 +56,7 @@ void ALever::Interact()
 void ALever::TurnOffLever()
 {
 	UE_LOG(LogTemp, Display, TEXT("ALever::ToggleLever - Setting lever to off"))
-	bIsTrue = false;
-	InteractableFlipbook->SetFlipbook(FalsePosition);
+	SetIsTrue(false);
 
 	for (AMovingPlatform* Platform: PlatformsToTrigger)
 	{
@@ -73,8 +73,7 @@ void ALever::TurnOffLever()
 void ALever::TurnOnLever()
 {
 	UE_LOG(LogTemp, Display, TEXT("ALever::ToggleLever - Setting lever to on"))
-	bIsTrue = true;
-	InteractableFlipbook->SetFlipbook(TruePosition);
+	SetIsTrue(true);
 	
 	for (AMovingPlatform* Platform: PlatformsToTrigger)
 	{
@@ -102,17 +101,22 @@ void ALever::MoveLever()
 }
 
 /**
- * @brief Plays the lever move sound.
+ * @brief Plays the lever move sound of a LeverMove cue.
  *
- * This method is used to play the lever move sound effect when the lever is activated.
- * It spawns the sound attached to the lever's interactable flipbook.
+ * It plays the sound attached to the lever's interactable flipbook.
+ *
+ * @param Cue The cue to play.
+ * @param Location Where the cue happened on the server.
  */
-void ALever::PlayLeverMoveSound_Implementation() const
+void ALever::PlayCosmeticCue(const ECosmeticCue Cue, const FVector& Location)
 {
-	UGameplayStatics::SpawnSoundAttached(
+	if (Cue != ECosmeticCue::LeverMove) return;
+
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->LeverMoveSound,
 		this->InteractableFlipbook,
-		TEXT("LeverMoveSound")
+		EAudioEventCategory::Interactable
 	);
 }
 
@@ -123,7 +127,7 @@ void ALever::PlayLeverMoveSound_Implementation() const
  */
 void ALever::ToggleLever()
 {
-	PlayLeverMoveSound();
+	UCosmeticCueSubsystem::SendCue(this, ECosmeticCue::LeverMove);
 
 	GetWorld()->GetTimerManager().SetTimer(
 		this->LeverMoveTimerHandle,
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "BaseInteractable.h"
+#include "SideScroller/Interfaces/CosmeticCueInterface.h"
 #include "SideScroller/Interfaces/InteractInterface.h"
 #include "Lever.generated.h"
 
@@ -12,7 +13,7 @@
  * @brief This class represents a lever in a side-scrolling game.
  */
 UCLASS()
-class SIDESCROLLER_API ALever : public ABaseInteractable, public IInteractInterface
+class SIDESCROLLER_API ALever : public ABaseInteractable, public IInteractInterface, public ICosmeticCueInterface
 {
 	GENERATED_BODY()
 
@@ -41,18 +42,15 @@ public:
 	UFUNCTION()
 	virtual void Interact() override;
 
-private:
 	/**
-	 * @brief Plays the lever move sound.
+	 * @brief Plays the lever move sound of a LeverMove cue.
 	 *
-	 * This method is used to play a lever move sound. It is marked as a BlueprintCallable function,
-	 * meaning it can be called from Blueprints. It is also marked as NetMulticast and Reliable,
-	 * indicating that it is replicated across the network for all clients and that it is reliable
-	 * and will be resent if it is lost.
+	 * @param Cue The cue to play.
+	 * @param Location Where the cue happened on the server.
 	 */
-	UFUNCTION(BlueprintCallable, NetMulticast, Reliable)
-	void PlayLeverMoveSound() const;
+	virtual void PlayCosmeticCue(ECosmeticCue Cue, const FVector& Location) override;
 
+private:
 	/**
 	 * @brief The array of platforms that will be triggered.
 	 *
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "CosmeticCueInterface.generated.h"
+
+/**
+ * @enum ECosmeticCue
+ * @brief The purely cosmetic events the server tells clients about through the UCosmeticCueSubsystem.
+ */
+UENUM(BlueprintType)
+enum class ECosmeticCue : uint8
+{
+	Hurt,
+	DoorOpen,
+	DoorClose,
+	LeverMove
+};
+
+/**
+ * @brief Interface for actors that play the sounds and flipbooks of cosmetic cues they instigated.
+ */
+UINTERFACE(MinimalAPI)
+class UCosmeticCueInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * \class ICosmeticCueInterface
+ * \brief An interface for actors that instigate cosmetic cues.
+ *
+ * The server only sends the cue, its location and its instigator. Every machine then asks the instigator to play
+ * the cue, so the sounds and flipbooks a cue stands for are looked up locally from the instigator's own properties.
+ *
+ * @see UCosmeticCueSubsystem
+ */
+class SIDESCROLLER_API ICosmeticCueInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Plays the sounds and flipbooks of a cue this actor instigated.
+	 *
+	 * Called on every machine with a local player the cue is relevant to; never on a dedicated server.
+	 *
+	 * @param Cue The cue to play.
+	 * @param Location Where the cue happened on the server.
+	 *
+	 * @note This method is a pure virtual function and must be implemented by inheriting classes.
+	 */
+	UFUNCTION(Category="Cosmetics")
+	virtual void PlayCosmeticCue(ECosmeticCue Cue, const FVector& Location) = 0;
+};
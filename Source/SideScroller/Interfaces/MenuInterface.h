@@ -77,15 +77,16 @@ public:
 	 */
 	virtual void JoinIP(FString& IpAddress) = 0;
 	/**
-	 * Joins the given index.
+	 * Joins the session with the given ID.
 	 *
-	 * This method takes in an unsigned integer index and performs a join operation on the specified index.
+	 * This method takes in the ID of a session found by the last server list refresh and joins it. Sessions are
+	 * identified by ID rather than by position, since the server browser sorts and filters its rows.
 	 *
-	 * @param Index The index to join.
+	 * @param SessionId The ID of the session to join.
 	 *
 	 * @remarks This method is a pure virtual function and must be implemented by derived classes.
 	 */
-	virtual void Join(uint32 Index) = 0;
+	virtual void Join(const FString& SessionId) = 0;
 	/**
 	 * @brief Load the main menu.
 	 *
@@ -112,4 +113,15 @@ public:
 	 * @see None
 	 */
 	virtual void RefreshServerList() = 0;
+	/**
+	 * @brief Refreshes the live state of one listed server.
+	 *
+	 * Called periodically by the server browser for the rows it is showing. Implementations should query the
+	 * server cheaply, without a new session search, and hand the answer back to the menu.
+	 *
+	 * @param SessionId The ID of the session to refresh.
+	 *
+	 * @remarks This method is a pure virtual function and must be implemented by derived classes.
+	 */
+	virtual void RefreshServerInfo(const FString& SessionId) = 0;
 };
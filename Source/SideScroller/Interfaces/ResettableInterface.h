@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "ResettableInterface.generated.h"
+
+/**
+ * @brief Interface for level actors that can be put back into their initial state without reloading the map.
+ */
+UINTERFACE(MinimalAPI)
+class UResettableInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * \class IResettableInterface
+ * \brief An interface for actors that take part in an in-place level reset.
+ *
+ * Actors implementing this interface register themselves with the ULevelResetSubsystem in BeginPlay. When the level
+ * is reset the subsystem moves them back to their initial transform, reactivates them if they were released to the
+ * pool, and then calls ResetToInitialState so they can restore the rest of their state.
+ *
+ * @see ULevelResetSubsystem
+ */
+class SIDESCROLLER_API IResettableInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Restores the actor's gameplay state to what it was when the level began.
+	 *
+	 * Called on the server and on every client. Replicated state should only be changed where the actor has
+	 * authority; purely local state (flipbooks, timers, overlap settings) should be restored everywhere.
+	 *
+	 * @note This method is a pure virtual function and must be implemented by inheriting classes.
+	 */
+	UFUNCTION(Category="Reset")
+	virtual void ResetToInitialState() = 0;
+};
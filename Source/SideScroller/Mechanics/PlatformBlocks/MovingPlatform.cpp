@@ -4,13 +4,19 @@
 #include "MovingPlatform.h"
 
 #include "PaperSpriteComponent.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
 /**
  * @brief Constructor for the AMovingPlatform class.
  *
  * Initializes the PrimaryActorTick and sets the mobility of the render component to movable.
- * The actor is set to replicate across network.
+ * The actor is set to replicate across network, but its movement is not: every machine computes the platform's
+ * position itself from the replicated motion state. The platform is net dormant until its motion state changes, and
+ * only replicates that small state, so a low update rate is enough.
  */
 AMovingPlatform::AMovingPlatform()
 {
@@ -18,66 +24,224 @@ AMovingPlatform::AMovingPlatform()
 	GetRenderComponent()->SetMobility(EComponentMobility::Movable);
 
 	this->SetReplicates(true);
+	this->SetReplicatingMovement(false);
+	this->NetDormancy = DORM_DormantAll;
+	this->NetUpdateFrequency = 10.f;
+	this->MinNetUpdateFrequency = 1.f;
+	this->NetPriority = 1.5f;
 }
 
 /**
  * @brief Called when the game starts or when spawned.
  *
  * This function is called when the actor begins play. It is responsible for setting up initial properties
- * and state for the actor.
+ * and state for the actor. The path (straight line or spline) and its length are worked out once here, and the server
+ * starts the platform moving if it begins with active triggers. The platform registers with the ULevelResetSubsystem
+ * while it is still at its start location.
  */
 void AMovingPlatform::BeginPlay()
 {
 	Super::BeginPlay();
 	SetReplicates(true);
-	if (HasAuthority())
+	GlobalStartLocation = GetActorLocation();
+	InitialActiveTriggers = ActiveTriggers;
+
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
 	{
-		SetReplicateMovement(true);
+		LevelReset->RegisterActor(this);
 	}
-	GlobalStartLocation = GetActorLocation();
 	GlobalTargetLocation = GetTransform().TransformPosition(TargetLocation);
+
+	if (PathSplineActor != nullptr)
+	{
+		PathSpline = PathSplineActor->FindComponentByClass<USplineComponent>();
+		if (PathSpline == nullptr)
+		{
+			UE_LOG(LogTemp, Warning,
+				TEXT("AMovingPlatform::BeginPlay - %s has no spline component. Moving %s in a straight line."),
+				*PathSplineActor->GetName(),
+				*this->GetName()
+			);
+		}
+	}
+
+	JourneyLength = PathSpline != nullptr
+		? PathSpline->GetSplineLength()
+		: FVector::Distance(GlobalStartLocation, GlobalTargetLocation);
+
+	// every machine works this out from the same placed location, so they all agree on the phase
+	if (PathSpline != nullptr)
+	{
+		SplineStartDistance = PathSpline->GetDistanceAlongSplineAtSplineInputKey(
+			PathSpline->FindInputKeyClosestToWorldLocation(GlobalStartLocation)
+		);
+	}
+
+	if (HasAuthority())
+	{
+		UpdateMotionState();
+	}
+
+	// place the platform where it should be right now (late joiners) and only tick while it moves
+	SetActorLocation(GetLocationAtServerTime(GetServerWorldTime()));
+	SetActorTickEnabled(Motion.bIsMoving);
 }
 
 /**
  * @brief Update the platform's position.
  *
- * This method is responsible for updating the position of the moving platform. It is typically called every frame
- * to continuously move the platform according to its speed and target locations.
+ * This method is responsible for updating the position of the moving platform. It is called every frame on the
+ * server and on clients and places the platform where its path puts it at the current server world time.
  *
  * @param DeltaTime The time elapsed since the last frame.
  */
 void AMovingPlatform::Tick(float DeltaTime)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaTime);
 
-	if (ActiveTriggers > 0)
+	const FVector Location = GetLocationAtServerTime(GetServerWorldTime());
+	if (!Location.Equals(GetActorLocation()))
 	{
-		if (HasAuthority())
-		{
-			FVector Location = GetActorLocation();
-			const float JourneyLength = (GlobalTargetLocation - GlobalStartLocation).Size();
-			const float LengthTraveled = (Location - GlobalStartLocation).Size();
-			if (LengthTraveled >= JourneyLength)
-			{
-				const FVector Swap = GlobalStartLocation;
-				GlobalStartLocation = GlobalTargetLocation;
-				GlobalTargetLocation = Swap;
-			}
-			Location += Speed * DeltaTime * (GlobalTargetLocation - GlobalStartLocation).GetSafeNormal();
-			SetActorLocation(Location);
-		}
+		SetActorLocation(Location);
 	}
 }
 
+/**
+ * @brief Gets the server world time the platform's motion is evaluated at.
+ *
+ * @return The synchronized server world time, or the local world time while the game state is not replicated yet.
+ */
+float AMovingPlatform::GetServerWorldTime() const
+{
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	return GameState != nullptr ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
+
+/**
+ * @brief Computes the platform's location at the given server world time.
+ *
+ * The distance travelled is the total moving time times Speed, counted on a spline from where the platform was
+ * placed. On a straight line or open spline the platform goes back and forth between the ends; on a closed loop
+ * spline it keeps going round.
+ *
+ * @param ServerTime The server world time in seconds.
+ * @return The world location of the platform.
+ */
+FVector AMovingPlatform::GetLocationAtServerTime(const float ServerTime) const
+{
+	if (JourneyLength <= KINDA_SMALL_NUMBER) return GlobalStartLocation;
+
+	float TravelTime = Motion.AccumulatedTravelTime;
+	if (Motion.bIsMoving)
+	{
+		TravelTime += FMath::Max(ServerTime - Motion.ActivatedAtServerTime, 0.f);
+	}
+	const float Distance = SplineStartDistance + Speed * TravelTime;
+
+	if (PathSpline != nullptr && PathSpline->IsClosedLoop())
+	{
+		return PathSpline->GetLocationAtDistanceAlongSpline(
+			FMath::Fmod(Distance, JourneyLength), ESplineCoordinateSpace::World
+		);
+	}
+
+	// ping-pong: out to the end of the path and back again
+	float DistanceAlongPath = FMath::Fmod(Distance, 2.f * JourneyLength);
+	if (DistanceAlongPath > JourneyLength)
+	{
+		DistanceAlongPath = 2.f * JourneyLength - DistanceAlongPath;
+	}
+
+	if (PathSpline != nullptr)
+	{
+		return PathSpline->GetLocationAtDistanceAlongSpline(DistanceAlongPath, ESplineCoordinateSpace::World);
+	}
+	return FMath::Lerp(GlobalStartLocation, GlobalTargetLocation, DistanceAlongPath / JourneyLength);
+}
+
+/**
+ * @brief Starts or stops the platform's motion to match the number of active triggers.
+ *
+ * When the platform stops, the time it has been moving is added to AccumulatedTravelTime; when it starts, the
+ * current server world time is recorded as the activation time. Both are replicated, so clients pick up the change
+ * and keep evaluating the same path. The platform's net dormancy is flushed so the change goes out, and it only
+ * ticks while it moves.
+ */
+void AMovingPlatform::UpdateMotionState()
+{
+	const bool bShouldMove = ActiveTriggers > 0;
+	if (bShouldMove == Motion.bIsMoving) return;
+
+	const float ServerTime = GetServerWorldTime();
+	if (Motion.bIsMoving)
+	{
+		Motion.AccumulatedTravelTime += FMath::Max(ServerTime - Motion.ActivatedAtServerTime, 0.f);
+	}
+	FlushNetDormancy();
+	Motion.ActivatedAtServerTime = ServerTime;
+	Motion.bIsMoving = bShouldMove;
+
+	SetActorTickEnabled(bShouldMove);
+}
+
+/**
+ * @brief Restarts the platform from the beginning of its path.
+ *
+ * On the server the number of active triggers is restored and the motion state is cleared, so the travel time starts
+ * from zero again; UpdateMotionState then starts the platform if it began play with active triggers. Clients clear
+ * their motion state the same way instead of moving on the old one until the server's arrives. The platform is
+ * snapped onto its path on every machine.
+ */
+void AMovingPlatform::ResetToInitialState()
+{
+	Motion = FMovingPlatformMotion();
+	if (HasAuthority())
+	{
+		FlushNetDormancy();
+		ActiveTriggers = InitialActiveTriggers;
+		UpdateMotionState();
+	}
+	else
+	{
+		// what the server's UpdateMotionState works out; its replicated state replaces this when it arrives
+		Motion.bIsMoving = InitialActiveTriggers > 0;
+		Motion.ActivatedAtServerTime = GetServerWorldTime();
+	}
+
+	SetActorLocation(GetLocationAtServerTime(GetServerWorldTime()));
+	SetActorTickEnabled(Motion.bIsMoving);
+}
+
+/**
+ * @brief Applies a replicated motion state on a client.
+ *
+ * Snaps the platform onto its path for the new state and ticks it only while it moves.
+ */
+void AMovingPlatform::OnRep_Motion()
+{
+	// the initial state can arrive before BeginPlay has worked out the path
+	if (!HasActorBegunPlay()) return;
+
+	SetActorLocation(GetLocationAtServerTime(GetServerWorldTime()));
+	SetActorTickEnabled(Motion.bIsMoving);
+}
+
 /**
  * @brief Increments the ActiveTriggers variable by 1.
  *
  * This method is used to add an active trigger to the moving platform. Each active trigger increments the
- * ActiveTriggers variable by 1.
+ * ActiveTriggers variable by 1. Only the server changes the count; the count and the resulting motion state are
+ * replicated, so the platform's net dormancy is flushed first.
  */
 void AMovingPlatform::AddActiveTrigger()
 {
+	if (!HasAuthority()) return;
+
+	// ActiveTriggers replicates too, so wake the platform even when the motion state does not change
+	FlushNetDormancy();
 	ActiveTriggers++;
+	UpdateMotionState();
 }
 
 /**
@@ -87,10 +251,14 @@ void AMovingPlatform::AddActiveTrigger()
  */
 void AMovingPlatform::RemoveActiveTrigger()
 {
+	if (!HasAuthority()) return;
+
 	if (ActiveTriggers > 0)
 	{
+		FlushNetDormancy();
 		ActiveTriggers--;
 	}
+	UpdateMotionState();
 }
 
 /**
@@ -108,4 +276,5 @@ void AMovingPlatform::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > &
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(AMovingPlatform, ActiveTriggers);
+	DOREPLIFETIME(AMovingPlatform, Motion);
 }
@@ -4,8 +4,42 @@
 
 #include "CoreMinimal.h"
 #include "PaperSpriteActor.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
 #include "MovingPlatform.generated.h"
 
+class USplineComponent;
+
+/**
+ * @struct FMovingPlatformMotion
+ * @brief The replicated motion state of a moving platform.
+ *
+ * Together with the platform's path and speed this is all a machine needs to work out where the platform is at any
+ * server world time, so only this (and not the platform's transform) is replicated.
+ */
+USTRUCT()
+struct FMovingPlatformMotion
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Whether the platform is currently moving along its path.
+	 */
+	UPROPERTY()
+	bool bIsMoving = false;
+
+	/**
+	 * @brief The server world time, in seconds, at which the platform last started moving.
+	 */
+	UPROPERTY()
+	float ActivatedAtServerTime = 0.f;
+
+	/**
+	 * @brief Time, in seconds, the platform spent moving before it was last activated.
+	 */
+	UPROPERTY()
+	float AccumulatedTravelTime = 0.f;
+};
+
 /**
  * @class AMovingPlatform
  *
@@ -13,9 +47,20 @@
  *
  * This class is derived from APaperSpriteActor and provides functionality to move a platform from its starting location
  * to a target location with a certain speed. The platform can be triggered by activating or deactivating a trigger.
+ *
+ * The platform's position is a pure function of the synchronized server world time and the replicated
+ * FMovingPlatformMotion, so the server and every client evaluate it locally each frame and no movement is
+ * replicated. Optionally the platform follows the spline of another actor instead of the straight line to
+ * TargetLocation.
+ *
+ * While idle the platform neither ticks nor replicates: it is net dormant (DORM_DormantAll) and its tick is switched
+ * off, and both are woken up again when a trigger starts it.
+ *
+ * When the level is reset in place the platform goes back to its start location, its initial number of active
+ * triggers and a fresh motion state.
  */
 UCLASS()
-class SIDESCROLLER_API AMovingPlatform : public APaperSpriteActor
+class SIDESCROLLER_API AMovingPlatform : public APaperSpriteActor, public IResettableInterface
 {
 	GENERATED_BODY()
 	
@@ -35,6 +80,10 @@ public:
 	 */
 	virtual void BeginPlay() override;
 	/** Executes tick operations for the Moving Platform.
+	 *
+	 *  Moves the platform to the position its path gives for the current server world time. Runs on the server and
+	 *  on clients alike.
+	 *
 	 *  @param DeltaTime The time between the last frame and the current frame.
 	 */
 	virtual void Tick(float DeltaTime) override;
@@ -66,6 +115,16 @@ public:
 	UPROPERTY(EditAnywhere, Meta = (MakeEditWidget = true))
 	FVector TargetLocation;
 
+	/**
+	 * @brief Optional actor whose spline component the platform follows instead of moving to TargetLocation.
+	 *
+	 * The platform travels back and forth along an open spline and round and round a closed loop spline, starting
+	 * from the point of the spline closest to where it is placed. Leave empty to move in a straight line between the
+	 * start location and TargetLocation.
+	 */
+	UPROPERTY(EditAnywhere)
+	AActor* PathSplineActor = nullptr;
+
 	/**
 	 * @brief Increments the counter of active triggers.
 	 *
@@ -85,7 +144,71 @@ public:
 	 */
 	void RemoveActiveTrigger();
 
+	/**
+	 * @brief Puts the platform back at the start of its path with its initial number of active triggers.
+	 *
+	 * The server restores ActiveTriggers and starts a fresh motion state from the current server time, and clients
+	 * start the same fresh state locally so they do not keep simulating the old one until it replicates; every
+	 * machine then snaps the platform onto its path and ticks it only if it moves.
+	 */
+	virtual void ResetToInitialState() override;
+
 private:
+	/**
+	 * Starts or stops the platform when the number of active triggers crosses zero.
+	 *
+	 * Folds the time travelled so far into the replicated motion state and stamps the new activation time, so the
+	 * platform carries on from where it stopped. Server only.
+	 */
+	void UpdateMotionState();
+
+	/**
+	 * Gets the synchronized server world time.
+	 *
+	 * @return The server world time in seconds, or the local world time if the game state has not arrived yet.
+	 */
+	float GetServerWorldTime() const;
+
+	/**
+	 * Computes where the platform is at the given server world time.
+	 *
+	 * @param ServerTime The server world time in seconds.
+	 * @return The world location of the platform.
+	 */
+	FVector GetLocationAtServerTime(float ServerTime) const;
+
+	/**
+	 * @brief The spline the platform follows, found on PathSplineActor at BeginPlay.
+	 */
+	UPROPERTY()
+	USplineComponent* PathSpline = nullptr;
+
+	/**
+	 * @brief The length of the platform's path, cached at BeginPlay.
+	 */
+	float JourneyLength = 0.f;
+
+	/**
+	 * @brief How far along PathSpline the platform was placed, cached at BeginPlay, so it starts from there instead of
+	 * snapping to the start of the spline.
+	 */
+	float SplineStartDistance = 0.f;
+
+	/**
+	 * @brief The replicated motion state the platform's position is evaluated from.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_Motion)
+	FMovingPlatformMotion Motion;
+
+	/**
+	 * @brief Called on clients when the motion state is replicated.
+	 *
+	 * Enables ticking while the platform moves (disables it while idle) and snaps the platform to where the new
+	 * state puts it.
+	 */
+	UFUNCTION()
+	void OnRep_Motion();
+
 	/**
 	 * @brief GlobalTargetLocation
 	 *
@@ -129,4 +252,9 @@ private:
 	 */
 	UPROPERTY(EditAnywhere, replicated)
 	int ActiveTriggers = 1;
+
+	/**
+	 * @brief The number of active triggers the platform began play with, restored by ResetToInitialState.
+	 */
+	int InitialActiveTriggers = 1;
 };
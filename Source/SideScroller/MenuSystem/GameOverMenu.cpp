@@ -5,6 +5,8 @@
 
 #include "Components/Button.h"
 #include "GameFramework/GameModeBase.h"
+#include "SideScroller/Controllers/GameModePlayerController.h"
+#include "SideScroller/GameStates/LevelGameState.h"
 
 /**
  * Initializes the game over menu.
@@ -89,15 +91,31 @@ void UGameOverMenu::BackToMainMenu()
  *
  * This method is used to restart the game. It is called when the player selects the restart option in the game over
  * menu. The method first logs a message to inform that the game is being restarted. It then gets a reference to the
- * world and checks if it is valid. If the world is valid, it sets the 'bUseSeamlessTravel' flag of the current game
- * mode to true and performs a server travel to the level 'Map_Level1'.
+ * world and checks if it is valid. If the menu is shown over a level, it asks the server to reset that level in place
+ * through the owning player's AGameModePlayerController. Otherwise (the game over map) it sets the
+ * 'bUseSeamlessTravel' flag of the current game mode to true and performs a server travel to the level 'Map_Level1'.
  */
 void UGameOverMenu::RestartGame()
 {
 	UE_LOG(LogTemp, Display, TEXT("UGameOverMenu::RestartGame - Leaving GameOver Menu to restart game..."));
 	UWorld* World = GetWorld();
 	if (!World) return;
-	GetWorld()->GetAuthGameMode()->bUseSeamlessTravel = true;
+
+	if (World->GetGameState<ALevelGameState>() != nullptr)
+	{
+		AGameModePlayerController* PlayerController = Cast<AGameModePlayerController>(World->GetFirstPlayerController());
+		if (PlayerController == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGameOverMenu::RestartGame - Cant find GameMode player controller."));
+			return;
+		}
+		PlayerController->RestartLevel();
+		return;
+	}
+
+	AGameModeBase* GameMode = World->GetAuthGameMode();
+	if (GameMode == nullptr) return;  // only the server can travel
+	GameMode->bUseSeamlessTravel = true;
 	World->ServerTravel("/Game/Maps/Map_Level1?listen");
 }
 
@@ -3,10 +3,18 @@
 
 #include "MainMenu.h"
 
+#include "Blueprint/WidgetTree.h"
 #include "Components/Button.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/VerticalBox.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Components/WidgetSwitcher.h"
 #include "Components/EditableText.h"
+#include "Components/ListView.h"
+#include "Components/PanelWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "SideScroller/Beacons/ServerInfoBeaconClient.h"
+#include "ServerListItem.h"
 #include "ServerRow.h"
 #include "Components/ComboBoxString.h"
 #include "Components/Slider.h"
@@ -14,21 +22,20 @@
 #include "Components/TextBlock.h"
 #include "GameFramework/GameUserSettings.h"
 #include "SideScroller/SaveGames/SideScrollerSaveGame.h"
+#include "TimerManager.h"
 
 /**
  * Initializes the Main Menu.
  *
  * This method is called during the initialization of the Main Menu and sets up various button callbacks and
- * UI elements. It also loads the player data and sets the initial values for the custom player name, resolution
- * selection, and volume.
+ * UI elements. It also requests the player data; the initial values for the custom player name, resolution
+ * selection, and volume are applied once the player profile has finished loading (see ApplyPlayerProfile).
  *
  * @return True if the initialization is successful, False otherwise.
  */
 bool UMainMenu::Initialize()
 {
 	const bool SuccessfulInit = Super::Initialize();
-
-	LoadPlayerData();
 	
 	if (!SuccessfulInit) return false;
 	
@@ -74,16 +81,12 @@ bool UMainMenu::Initialize()
 
 	if (CustomPlayerName)
 	{
-		if (!PlayerProfile) return true;  // early return; player profile is null
-		UE_LOG(LogTemp, Display, TEXT("UMainMenu::Initialize - PlayerName is set to %s."), *PlayerProfile->PlayerName);
-		CustomPlayerName->SetText(FText::FromString(PlayerProfile->PlayerName));
-		
 		CustomPlayerName->OnTextCommitted.AddDynamic(this, &UMainMenu::SetCustomPlayerNameEnter);
 	}
 	else
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("UMainMenu::Initialize - Either CustomPlayerName or PlayerProfile is null.")
+			TEXT("UMainMenu::Initialize - Cant find the CustomPlayerName text box during init.")
 		);
 		return false;
 	}
@@ -170,15 +173,7 @@ bool UMainMenu::Initialize()
 
 	if (ResolutionSelectComboBox)
 	{
-		if (!PlayerProfile) return true;  // early return; player profile is null
-		UE_LOG(LogTemp, Display,
-			TEXT("UMainMenu::Initialize - ResolutionIndex is set to %i."),
-			PlayerProfile->ResolutionIndex
-		);
-		ResolutionSelectComboBox->SetSelectedIndex(PlayerProfile->ResolutionIndex);
-
 		ResolutionSelectComboBox->OnSelectionChanged.AddDynamic(this, &UMainMenu::SetResolution);
-
 	}
 	else
 	{
@@ -188,14 +183,7 @@ bool UMainMenu::Initialize()
 
 	if (VolumeSelectSlider)
 	{
-		if (!PlayerProfile) return true;  // early return; player profile is null
-		UE_LOG(LogTemp, Display,
-			TEXT("UMainMenu::Initialize - VolumeSelectSlider is set to %f."),
-			PlayerProfile->VolumeLevel
-		);
 		VolumeSelectSlider->OnValueChanged.AddDynamic(this, &UMainMenu::SetVolume);
-
-		VolumeSelectSlider->SetValue(PlayerProfile->VolumeLevel);
 	}
 	else
 	{
@@ -203,42 +191,85 @@ bool UMainMenu::Initialize()
 		return false;
 	}
 
+	if (ServerFilter)
+	{
+		ServerFilter->OnTextChanged.AddDynamic(this, &UMainMenu::OnServerFilterChanged);
+	}
+
+	// WBP_MainMenu has no replay page of its own, so one is built next to the other pages
+	BuildReplayMenu();
+
+	// menus the page could not be built into just have no way to play recordings
+	if (OpenReplayMenuButton)
+	{
+		OpenReplayMenuButton->OnClicked.AddDynamic(this, &UMainMenu::OpenReplayMenu);
+	}
+
+	if (ReplaySelectComboBox)
+	{
+		ReplaySelectComboBox->OnSelectionChanged.AddDynamic(this, &UMainMenu::OnReplaySelected);
+	}
+
+	if (PlayReplayButton)
+	{
+		PlayReplayButton->OnClicked.AddDynamic(this, &UMainMenu::PlaySelectedReplay);
+	}
+
+	if (BackButtonReplayMenu)
+	{
+		BackButtonReplayMenu->OnClicked.AddDynamic(this, &UMainMenu::BackToMainMenu);
+	}
+
+	// the profile is loaded asynchronously, so the profile driven values are filled in once it is ready
+	LoadPlayerData();
+
 	UE_LOG(LogTemp, Display, TEXT("Main Menu Init complete!"));
 	return true;
 }
 
+/**
+ * Switches back to the main page whenever the cached menu is shown again.
+ */
+void UMainMenu::NativeConstruct()
+{
+	Super::NativeConstruct();
+	BackToMainMenu();
+}
+
 /**
  * UMainMenu constructor.
  *
- * Initializes the UMainMenu object and sets the ServerRowClass by finding the UUserWidget class using the provided
- * blueprint path.
+ * Initializes the UMainMenu object and makes it focusable. A ServerList list view creates the server rows from its
+ * entry widget class; ServerRowClass is only used to fill a ServerList panel.
  *
  * @param ObjectInitializer The object initializer reference.
  */
 UMainMenu::UMainMenu(const FObjectInitializer & ObjectInitializer)
 {
 	ConstructorHelpers::FClassFinder<UUserWidget> ServerRowBPClass(TEXT("/Game/MenuSystem/WBP_ServerRow"));
-	if (!ServerRowBPClass.Class) return;
-	ServerRowClass = ServerRowBPClass.Class;
+	if (ServerRowBPClass.Class)
+	{
+		ServerRowClass = ServerRowBPClass.Class;
+	}
 	SetIsFocusable(true);
 	// bIsFocusable = true;  // deprecated
 }
 
 /**
  * @brief LoadPlayerData method is responsible for loading player data from the game instance.
- *        It assigns the player profile to the member variable PlayerProfile.
+ *        It asks the game instance to call ApplyPlayerProfile as soon as the player profile is ready, which is
+ *        immediately if it has already been loaded.
  *
  * @param None
  *
  * @return None
  *
  * @note This method assumes that the game instance is of type USideScrollerGameInstance.
- *       If the game instance is null or the player profile is null, it logs appropriate errors.
- *       Make sure to check if the PlayerProfile is null after calling this method.
+ *       If the game instance is null, it logs an error. PlayerProfile stays null until the profile is ready.
  */
 void UMainMenu::LoadPlayerData()
 {
-	const USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
+	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetGameInstance());
 	if (GameInstance == nullptr)
 	{
 		UE_LOG(LogTemp, Error,
@@ -247,73 +278,287 @@ void UMainMenu::LoadPlayerData()
 		return;
 	}
 
-	PlayerProfile = GameInstance->GetPlayerProfile();
+	if (!GameInstance->IsPlayerProfileReady())
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UMainMenu::LoadPlayerData - PlayerProfile is still loading. Waiting for it to be ready.")
+		);
+	}
+
+	GameInstance->CallWhenPlayerProfileReady(
+		FOnPlayerProfileReady::FDelegate::CreateUObject(this, &UMainMenu::ApplyPlayerProfile)
+	);
+}
+
+/**
+ * @brief Stores the loaded player profile and applies its values to the profile and settings widgets.
+ *
+ * @param LoadedProfile The player profile that finished loading.
+ */
+void UMainMenu::ApplyPlayerProfile(USideScrollerSaveGame* LoadedProfile)
+{
+	PlayerProfile = LoadedProfile;
 	if (PlayerProfile == nullptr)
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("UMainMenu::LoadPlayerData - Can't LoadPlayerData. PlayerProfile is null!")
+			TEXT("UMainMenu::ApplyPlayerProfile - Can't apply player data. PlayerProfile is null!")
+		);
+		return;
+	}
+
+	if (CustomPlayerName)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UMainMenu::ApplyPlayerProfile - PlayerName is set to %s."), *PlayerProfile->PlayerName
+		);
+		CustomPlayerName->SetText(FText::FromString(PlayerProfile->PlayerName));
+	}
+
+	if (ResolutionSelectComboBox)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UMainMenu::ApplyPlayerProfile - ResolutionIndex is set to %i."),
+			PlayerProfile->ResolutionIndex
 		);
+		ResolutionSelectComboBox->SetSelectedIndex(PlayerProfile->ResolutionIndex);
+	}
+
+	if (VolumeSelectSlider)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UMainMenu::ApplyPlayerProfile - VolumeSelectSlider is set to %f."),
+			PlayerProfile->VolumeLevel
+		);
+		VolumeSelectSlider->SetValue(PlayerProfile->VolumeLevel);
 	}
 }
 
 /**
- * Adds available servers to the server list.
+ * Merges search results into the server list model, keyed by session ID, and refreshes the list view.
  *
- * @param ServersData The array of server data to add to the list.
+ * @param ServersData The servers found since the last update, or all of them once the search is complete.
+ * @param bSearchComplete Whether ServersData holds the complete search results.
  */
-void UMainMenu::SetServerList(TArray<FServerData> ServersData)
+void UMainMenu::UpdateServerList(const TArray<FServerData>& ServersData, const bool bSearchComplete)
 {
-	UE_LOG(LogTemp, Display, TEXT("Adding available servers to server list."))
-	if (ServerRowClass)
+	UE_LOG(LogTemp, Display, TEXT("Merging %i servers into server list."), ServersData.Num())
+
+	TSet<FString> ReportedSessionIds;
+	ReportedSessionIds.Reserve(ServersData.Num());
+	for (const FServerData& ServerData : ServersData)
+	{
+		ReportedSessionIds.Add(ServerData.SessionId);
+		if (UServerListItem** ExistingItem = ServerItemsById.Find(ServerData.SessionId))
+		{
+			// the search cannot see the level, keep what the server's beacon reported
+			FServerData MergedData = ServerData;
+			MergedData.Level = (*ExistingItem)->GetServerData().Level;
+			(*ExistingItem)->SetServerData(MergedData);
+			continue;
+		}
+
+		UServerListItem* NewItem = NewObject<UServerListItem>(this);
+		NewItem->SetServerData(ServerData);
+		ServerItemsById.Add(ServerData.SessionId, NewItem);
+	}
+
+	if (bSearchComplete)
 	{
-		UE_LOG(LogTemp, Display, TEXT("Found Main Menu blueprint class %s."), *ServerRowClass->GetName());
-		UWorld* World = this->GetWorld();
-		if (World)
+		// servers that did not answer this search are gone
+		for (auto ItemIt = ServerItemsById.CreateIterator(); ItemIt; ++ItemIt)
 		{
-			uint32 i = 0;
-			ServerList->ClearChildren();
-			for (const FServerData& ServerData : ServersData)
+			if (!ReportedSessionIds.Contains(ItemIt.Key()))
 			{
-				UServerRow* ServerRow = CreateWidget<UServerRow>(World, ServerRowClass);
-				if (ServerRow)
-				{
-					if (ServerList)
-					{
-						ServerRow->ServerListItem->SetText(FText::FromString(ServerData.ServerName));
-						ServerRow->HostUser->SetText(FText::FromString(ServerData.HostUserName));
-						FString FractionText = FString::Printf(TEXT("%d/%d"),
-							ServerData.CurrentPlayers, ServerData.MaxPlayers);
-						ServerRow->ConnectionFraction->SetText(FText::FromString(FractionText));
-						ServerRow->Setup(this, i);
-						++i;
-						
-						ServerList->AddChild(ServerRow);
-					}
-					else
-					{
-						UE_LOG(LogTemp, Error, TEXT("ServerList object is null."));
-						return;
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("Cant create widget ServerRow."));
-					return;
-				}
+				ItemIt.RemoveCurrent();
 			}
 		}
-		else
+	}
+
+	RefreshServerListView();
+}
+
+/**
+ * Sorts and filters the server list model and hands it to the list view, which creates, recycles or keeps the row
+ * widgets as needed. A ServerList panel gets its rows rebuilt instead.
+ */
+void UMainMenu::RefreshServerListView()
+{
+	if (!ServerList)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ServerList object is null."));
+		return;
+	}
+
+	const FString FilterText = ServerFilter ? ServerFilter->GetText().ToString() : FString();
+
+	TArray<UServerListItem*> VisibleItems;
+	VisibleItems.Reserve(ServerItemsById.Num());
+	for (const TPair<FString, UServerListItem*>& ItemPair : ServerItemsById)
+	{
+		if (ItemPair.Value->MatchesFilter(FilterText))
+		{
+			VisibleItems.Add(ItemPair.Value);
+		}
+	}
+
+	VisibleItems.Sort([](const UServerListItem& A, const UServerListItem& B)
+	{
+		const FServerData& DataA = A.GetServerData();
+		const FServerData& DataB = B.GetServerData();
+		if (DataA.PingInMs != DataB.PingInMs) return DataA.PingInMs < DataB.PingInMs;
+		return DataA.ServerName < DataB.ServerName;
+	});
+
+	if (UPanelWidget* ServerListPanel = Cast<UPanelWidget>(ServerList))
+	{
+		RefreshServerListPanel(ServerListPanel, VisibleItems);
+		return;
+	}
+
+	UListView* ServerListView = Cast<UListView>(ServerList);
+	if (ServerListView == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ServerList is neither a list view nor a panel."));
+		return;
+	}
+
+	UServerListItem* SelectedItem = ServerListView->GetSelectedItem<UServerListItem>();
+	ServerListView->SetListItems(VisibleItems);
+	if (SelectedItem != nullptr && !VisibleItems.Contains(SelectedItem))
+	{
+		ServerListView->ClearSelection();
+	}
+}
+
+/**
+ * Replaces the rows of a ServerList panel with one WBP_ServerRow per visible server, the way the server list was
+ * filled before it became a list view. The selection is kept if the selected server is still shown.
+ *
+ * @param ServerListPanel The panel to fill.
+ * @param VisibleItems The servers to show, in order.
+ */
+void UMainMenu::RefreshServerListPanel(UPanelWidget* ServerListPanel, const TArray<UServerListItem*>& VisibleItems)
+{
+	if (!ServerRowClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cant find the server row blueprint class."));
+		return;
+	}
+
+	for (UWidget* ChildWidget : ServerListPanel->GetAllChildren())
+	{
+		if (UServerRow* OldRow = Cast<UServerRow>(ChildWidget))
+		{
+			OldRow->ShowServerItem(nullptr, nullptr);
+		}
+	}
+	ServerListPanel->ClearChildren();
+
+	if (SelectedServerItem != nullptr && !VisibleItems.Contains(SelectedServerItem))
+	{
+		SelectedServerItem = nullptr;
+	}
+
+	for (UServerListItem* Item : VisibleItems)
+	{
+		UServerRow* ServerRow = CreateWidget<UServerRow>(this, ServerRowClass);
+		if (ServerRow == nullptr)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Cant get World from this object."));
+			UE_LOG(LogTemp, Error, TEXT("Cant create widget ServerRow."));
 			return;
 		}
+		ServerRow->ShowServerItem(this, Item);
+		ServerRow->Selected = Item == SelectedServerItem;
+		ServerListPanel->AddChild(ServerRow);
+	}
+}
+
+/**
+ * Selects a server of a ServerList panel and marks only its row as selected.
+ *
+ * @param Item The server list item to select.
+ */
+void UMainMenu::SelectServerItem(UServerListItem* Item)
+{
+	SelectedServerItem = Item;
 
+	const UPanelWidget* ServerListPanel = Cast<UPanelWidget>(ServerList);
+	if (ServerListPanel == nullptr) return;
+
+	for (UWidget* ChildWidget : ServerListPanel->GetAllChildren())
+	{
+		if (UServerRow* Row = Cast<UServerRow>(ChildWidget))
+		{
+			Row->Selected = Row->GetServerItem() == Item;
+		}
 	}
-	else
+}
+
+/**
+ * Re-filters the server list when the filter text changes.
+ *
+ * @param Text The new filter text.
+ */
+void UMainMenu::OnServerFilterChanged(const FText& Text)
+{
+	RefreshServerListView();
+}
+
+/**
+ * Applies a server info beacon's answer to the server's item.
+ *
+ * @param SessionId The ID of the session that was queried.
+ * @param ServerInfo The server's live state.
+ * @param PingInMs The round trip time of the query in milliseconds.
+ */
+void UMainMenu::ApplyServerInfo(const FString& SessionId, const FServerBeaconInfo& ServerInfo, const int32 PingInMs)
+{
+	UServerListItem** Item = ServerItemsById.Find(SessionId);
+	if (Item == nullptr) return;  // dropped from the list while the beacon was out
+
+	FServerData ServerData = (*Item)->GetServerData();
+	if (!ServerInfo.ServerName.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the Main Menu blueprint class."));
+		ServerData.ServerName = ServerInfo.ServerName;
+	}
+	ServerData.CurrentPlayers = ServerInfo.CurrentPlayers;
+	ServerData.MaxPlayers = ServerInfo.MaxPlayers;
+	ServerData.Level = ServerInfo.Level;
+	ServerData.PingInMs = PingInMs;
+	(*Item)->SetServerData(ServerData);
+}
+
+/**
+ * Asks the menu interface to refresh every server that has a row on screen, or every row of a ServerList panel.
+ */
+void UMainMenu::RefreshDisplayedServerInfo()
+{
+	if (!ServerList || !MenuInterface) return;
+
+	if (const UPanelWidget* ServerListPanel = Cast<UPanelWidget>(ServerList))
+	{
+		for (UWidget* ChildWidget : ServerListPanel->GetAllChildren())
+		{
+			const UServerRow* Row = Cast<UServerRow>(ChildWidget);
+			if (Row == nullptr || Row->GetServerItem() == nullptr) continue;
+
+			MenuInterface->RefreshServerInfo(Row->GetServerItem()->GetServerData().SessionId);
+		}
 		return;
 	}
+
+	const UListView* ServerListView = Cast<UListView>(ServerList);
+	if (ServerListView == nullptr) return;
+
+	for (UUserWidget* EntryWidget : ServerListView->GetDisplayedEntryWidgets())
+	{
+		const UServerListItem* Item = Cast<UServerListItem>(
+			UUserObjectListEntryLibrary::GetListItemObject(EntryWidget)
+		);
+		if (Item == nullptr) continue;
+
+		MenuInterface->RefreshServerInfo(Item->GetServerData().SessionId);
+	}
 }
 
 /**
@@ -406,6 +651,16 @@ void UMainMenu::OpenJoinMenu()
 			if (MenuInterface)
 			{
 				MenuInterface->RefreshServerList();
+				if (const UWorld* World = GetWorld())
+				{
+					World->GetTimerManager().SetTimer(
+						ServerInfoRefreshTimerHandle,
+						this,
+						&UMainMenu::RefreshDisplayedServerInfo,
+						ServerInfoRefreshInterval,
+						true
+					);
+				}
 			}
 			else
 			{
@@ -483,14 +738,193 @@ void UMainMenu::OpenProfileMenu()
 	}
 }
 
+/**
+ * Opens the replay page and asks the match replay subsystem for the recordings on disk. The combo box is emptied
+ * right away and refilled by OnMatchReplaysFound.
+ */
+void UMainMenu::OpenReplayMenu()
+{
+	if (MenuSwitcher == nullptr || ReplayMenu == nullptr || ReplaySelectComboBox == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UMainMenu::OpenReplayMenu - Cant find the ReplayMenu Widget."));
+		return;
+	}
+	MenuSwitcher->SetActiveWidget(ReplayMenu);
+
+	FoundReplays.Reset();
+	ReplaySelectComboBox->ClearOptions();
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	if (GameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UMainMenu::OpenReplayMenu - Cant find the GameInstance."));
+		return;
+	}
+	GameInstance->GetSubsystem<UMatchReplaySubsystem>()->FindMatchReplays(
+		FOnMatchReplaysFound::CreateUObject(this, &UMainMenu::OnMatchReplaysFound)
+	);
+}
+
+/**
+ * Lists every found recording as "<map and time> (<minutes>:<seconds>)" and selects the newest.
+ *
+ * @param Replays The match recordings on disk, newest first.
+ */
+void UMainMenu::OnMatchReplaysFound(const TArray<FMatchReplayInfo>& Replays)
+{
+	if (ReplaySelectComboBox == nullptr) return;
+
+	FoundReplays = Replays;
+	ReplaySelectComboBox->ClearOptions();
+	for (const FMatchReplayInfo& Replay : FoundReplays)
+	{
+		const int32 Seconds = FMath::FloorToInt(Replay.LengthInSeconds);
+		ReplaySelectComboBox->AddOption(
+			FString::Printf(TEXT("%s (%i:%02i)"), *Replay.FriendlyName, Seconds / 60, Seconds % 60)
+		);
+	}
+
+	if (FoundReplays.Num() > 0)
+	{
+		ReplaySelectComboBox->SetSelectedIndex(0);
+	}
+}
+
+/**
+ * Limits the replay start time to the length of the newly selected recording and starts it from the beginning.
+ *
+ * @param SelectedItem The label of the selected recording.
+ * @param SelectionType How the recording was selected.
+ */
+void UMainMenu::OnReplaySelected(FString SelectedItem, ESelectInfo::Type SelectionType)
+{
+	if (ReplaySelectComboBox == nullptr || ReplayStartSpinBox == nullptr) return;
+
+	const int32 SelectedIndex = ReplaySelectComboBox->GetSelectedIndex();
+	if (!FoundReplays.IsValidIndex(SelectedIndex)) return;
+
+	ReplayStartSpinBox->SetMinValue(0.f);
+	ReplayStartSpinBox->SetMaxValue(FoundReplays[SelectedIndex].LengthInSeconds);
+	ReplayStartSpinBox->SetValue(0.f);
+}
+
+/**
+ * Plays the selected match recording. A start time later than 0 is reached by loading the nearest checkpoint before
+ * it once the recording has loaded.
+ */
+void UMainMenu::PlaySelectedReplay()
+{
+	const int32 SelectedIndex = ReplaySelectComboBox ? ReplaySelectComboBox->GetSelectedIndex() : INDEX_NONE;
+	if (!FoundReplays.IsValidIndex(SelectedIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UMainMenu::PlaySelectedReplay - No recording is selected."));
+		return;
+	}
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	if (GameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UMainMenu::PlaySelectedReplay - Cant find the GameInstance."));
+		return;
+	}
+
+	const float StartSeconds = ReplayStartSpinBox ? ReplayStartSpinBox->GetValue() : 0.f;
+	if (GameInstance->GetSubsystem<UMatchReplaySubsystem>()->PlayMatchReplay(
+		FoundReplays[SelectedIndex].Name, StartSeconds))
+	{
+		OnLevelRemovedFromWorld();
+	}
+}
+
+/**
+ * Builds the replay page and the button that opens it, for a widget blueprint that has neither. The page is a list of
+ * the widgets the replay page binds, added to the MenuSwitcher, and the button goes below OpenProfileMenuButton with
+ * the same style. A widget blueprint that has its own replay page keeps it.
+ */
+void UMainMenu::BuildReplayMenu()
+{
+	if (ReplayMenu != nullptr || MenuSwitcher == nullptr || WidgetTree == nullptr) return;
+
+	UVerticalBox* ReplayPage = WidgetTree->ConstructWidget<UVerticalBox>(
+		UVerticalBox::StaticClass(), TEXT("ReplayMenu")
+	);
+
+	UTextBlock* Title = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("ReplayMenuTitle"));
+	Title->SetText(FText::FromString(TEXT("REPLAYS")));
+	ReplayPage->AddChildToVerticalBox(Title);
+
+	ReplaySelectComboBox = WidgetTree->ConstructWidget<UComboBoxString>(
+		UComboBoxString::StaticClass(), TEXT("ReplaySelectComboBox")
+	);
+	ReplayPage->AddChildToVerticalBox(ReplaySelectComboBox);
+
+	ReplayStartSpinBox = WidgetTree->ConstructWidget<USpinBox>(USpinBox::StaticClass(), TEXT("ReplayStartSpinBox"));
+	ReplayStartSpinBox->SetMinValue(0.f);
+	ReplayStartSpinBox->SetMaxValue(0.f);
+	ReplayPage->AddChildToVerticalBox(ReplayStartSpinBox);
+
+	PlayReplayButton = MakeMenuButton(TEXT("PlayReplayButton"), FText::FromString(TEXT("PLAY")));
+	ReplayPage->AddChildToVerticalBox(PlayReplayButton);
+
+	BackButtonReplayMenu = MakeMenuButton(TEXT("BackButtonReplayMenu"), FText::FromString(TEXT("BACK")));
+	ReplayPage->AddChildToVerticalBox(BackButtonReplayMenu);
+
+	MenuSwitcher->AddChild(ReplayPage);
+	ReplayMenu = ReplayPage;
+
+	if (OpenReplayMenuButton != nullptr || OpenProfileMenuButton == nullptr) return;
+
+	UPanelWidget* MainPageButtons = OpenProfileMenuButton->GetParent();
+	if (MainPageButtons == nullptr) return;
+
+	OpenReplayMenuButton = MakeMenuButton(TEXT("OpenReplayMenuButton"), FText::FromString(TEXT("REPLAYS")));
+	UPanelSlot* ButtonSlot = MainPageButtons->AddChild(OpenReplayMenuButton);
+
+	// on a canvas the button is placed by hand, one button height below the profile button
+	const UCanvasPanelSlot* ProfileButtonSlot = Cast<UCanvasPanelSlot>(OpenProfileMenuButton->Slot);
+	if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(ButtonSlot); CanvasSlot && ProfileButtonSlot)
+	{
+		FAnchorData Layout = ProfileButtonSlot->GetLayout();
+		Layout.Offsets.Top += Layout.Offsets.Bottom;
+		CanvasSlot->SetLayout(Layout);
+	}
+}
+
+/**
+ * Creates a button with a text label, styled like OpenProfileMenuButton and its label if the menu has it.
+ *
+ * @param Name The name of the new button.
+ * @param Label The text on the button.
+ * @return The new button.
+ */
+UButton* UMainMenu::MakeMenuButton(const FName Name, const FText& Label)
+{
+	UButton* Button = WidgetTree->ConstructWidget<UButton>(UButton::StaticClass(), Name);
+	UTextBlock* LabelText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass());
+	LabelText->SetText(Label);
+
+	if (OpenProfileMenuButton != nullptr)
+	{
+		Button->SetStyle(OpenProfileMenuButton->GetStyle());
+		if (const UTextBlock* ProfileLabel = Cast<UTextBlock>(OpenProfileMenuButton->GetChildAt(0)))
+		{
+			LabelText->SetFont(ProfileLabel->GetFont());
+			LabelText->SetColorAndOpacity(ProfileLabel->GetColorAndOpacity());
+		}
+	}
+
+	Button->AddChild(LabelText);
+	return Button;
+}
+
 /**
  * Joins a server either by IP address or server list item.
  *
  * @param IpAddress The IP address of the server to join. This parameter is optional and can be empty.
- * @param SelectedIndex The index of the server list item to join. This parameter is optional and can be unset.
+ * The server list item to join is the one selected in the server list, if any.
  *
- * @note If the IP address is provided, it will take precedence over the selected index.
- * @note If neither the IP address nor the selected index is provided, the method will log an error and return without
+ * @note If the IP address is provided, it will take precedence over the selected server.
+ * @note If neither the IP address nor a selected server is provided, the method will log an error and return without
  * joining a server.
  */
 void UMainMenu::JoinServer()
@@ -507,10 +941,11 @@ void UMainMenu::JoinServer()
             else
             {
                 UE_LOG(LogTemp, Display, TEXT("IP Address field is empty. Trying server list item."));
-            	if (SelectedIndex.IsSet()) 
+            	const TOptional<FString> SelectedSessionId = GetSelectedSessionId();
+            	if (SelectedSessionId.IsSet()) 
             	{
-            		UE_LOG(LogTemp, Display, TEXT("Joining server index: %i"), SelectedIndex.GetValue());
-            		MenuInterface->Join(SelectedIndex.GetValue());
+            		UE_LOG(LogTemp, Display, TEXT("Joining server: %s"), *SelectedSessionId.GetValue());
+            		MenuInterface->Join(SelectedSessionId.GetValue());
             	}
             	else
             	{
@@ -566,10 +1001,16 @@ void UMainMenu::QuitGame()
  * @brief Switches back to the main menu widget.
  *
  * This method is used to switch back to the main menu widget by making it the active widget in the menu switcher.
+ * It also stops refreshing the server list rows started by OpenJoinMenu.
  * If the menu switcher or the main menu widget cannot be found, an error message is logged and the method returns.
  */
 void UMainMenu::BackToMainMenu()
 {
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ServerInfoRefreshTimerHandle);
+	}
+
 	if (MenuSwitcher)
 	{
 		if (MainMenu)
@@ -590,50 +1031,19 @@ void UMainMenu::BackToMainMenu()
 }
 
 /**
- * Retrieves the selected index from the main menu.
- *
- * @return The selected index as an optional unsigned 32-bit integer. If no index is selected, the optional
- * will be empty.
- */
-TOptional<uint32> UMainMenu::GetSelectedIndex() const
-{
-	return SelectedIndex;
-}
-
-/**
- * Sets the selected index of the main menu.
+ * Retrieves the session ID of the server selected in the server list.
  *
- * @param Index The index to set as selected. Use TOptional<uint32>() to clear the selected index.
+ * @return The selected server's session ID. If no server is selected, the optional will be empty.
  */
-void UMainMenu::SetSelectedIndex(const TOptional<uint32>& Index)
+TOptional<FString> UMainMenu::GetSelectedSessionId() const
 {
-	SelectedIndex = Index;
-	UpdateChildrenRows();
-}
+	const UListView* ServerListView = Cast<UListView>(ServerList);
+	const UServerListItem* SelectedItem = ServerListView != nullptr
+		? ServerListView->GetSelectedItem<UServerListItem>()
+		: SelectedServerItem;
+	if (SelectedItem == nullptr) return {};
 
-/**
- * Updates the rows of the child widgets in the main menu.
- *
- * This method iterates through all the child widgets of the ServerList and updates their state based on the
- * selected index. If a child widget is of type UServerRow, it sets the "Selected" property to true if the
- * SelectedIndex is set and matches the child widget's index in the ServerList.
- *
- * @see UWidget
- * @see UServerRow
- */
-void UMainMenu::UpdateChildrenRows()
-{
-	if (ServerList)
-	{
-		for (UWidget* CurrentWidget : ServerList->GetAllChildren())
-		{
-			auto Row = Cast<UServerRow>(CurrentWidget);
-			if (Row)
-			{
-				Row->Selected = (SelectedIndex.IsSet() && (SelectedIndex.GetValue() == ServerList->GetChildIndex(Row)));
-			}
-		}
-	}
+	return SelectedItem->GetServerData().SessionId;
 }
 
 /**
@@ -669,6 +1079,14 @@ void UMainMenu::SetCustomPlayerName()
 		return;  // no game instance - early return
 	}
 
+	if (PlayerProfile == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("UMainMenu::SetCustomPlayerName - PlayerProfile not loaded yet. Not saving player name to profile")
+		);
+		return;  // profile still loading - early return
+	}
+
 	const FString PlayerNameText = CustomPlayerName->GetText().ToString();
 	PlayerProfile->PlayerName = PlayerNameText;
 	UE_LOG(LogTemp, Display,
@@ -686,6 +1104,9 @@ void UMainMenu::SetCustomPlayerName()
  */
 void UMainMenu::SetResolution(FString SelectedItem, ESelectInfo::Type SelectionType)
 {
+	// direct selections come from ApplyPlayerProfile restoring the saved value, nothing to change or save
+	if (SelectionType == ESelectInfo::Direct) return;
+
 	const std::map<FString, int> ResolutionMap = {
 		{"640x480", 0},
 		{"1280x720", 1},
@@ -734,6 +1155,14 @@ void UMainMenu::SetResolution(FString SelectedItem, ESelectInfo::Type SelectionT
 	}
 
 	GameInstance->GetEngine()->GameUserSettings->SetScreenResolution(Resolution);
+
+	if (PlayerProfile == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("UMainMenu::SetResolution - PlayerProfile not loaded yet. Not saving ResolutionIndex to profile")
+		);
+		return;  // profile still loading - early return
+	}
 	
 	PlayerProfile->ResolutionIndex = ResolutionIndex;
 	UE_LOG(LogTemp, Display,
@@ -766,6 +1195,15 @@ void UMainMenu::SetVolume(float Value)
 		return;  // no game instance - early return
 	}
 
+	if (PlayerProfile == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("UMainMenu::SetVolume - PlayerProfile not loaded yet. Not saving volume to profile")
+		);
+		return;  // profile still loading - early return
+	}
+
+	// SaveGame coalesces writes, so dragging the slider only hits the disk once the value settles
 	PlayerProfile->VolumeLevel = Value;
 	UE_LOG(LogTemp, Display,
 		TEXT("UMainMenu::SetVolume - Attempting to save volume in profile SaveGame as %f"), Value
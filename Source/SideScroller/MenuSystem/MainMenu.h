@@ -6,6 +6,7 @@
 #include "MenuWidget.h"
 #include "Components/Button.h"
 #include "Sidescroller/SideScrollerGameInstance.h"
+#include "SideScroller/Replay/MatchReplaySubsystem.h"
 #include "SideScroller/SaveGames/SideScrollerSaveGame.h"
 #include "MainMenu.generated.h"
 
@@ -28,42 +29,50 @@ public:
 	 */
 	UMainMenu(const FObjectInitializer & ObjectInitializer);
 	/**
-	 * \brief Adds the available servers to the server list.
+	 * \brief Merges search results into the server list.
 	 *
-	 * This method takes an array of FServerData objects and adds the information about each server to the server list.
-	 * It creates a UServerRow widget for each server and sets the server name, host user name, connection fraction,
-	 * and sets up the widget to provide interaction with the server. The server list is cleared before adding the
-	 * new servers.
+	 * The list is diffed by session ID: a server that is already listed has its UServerListItem updated in place,
+	 * a new server gets a new item, and once the search is complete every server that was not in it is dropped.
+	 * Nothing is rebuilt; the list view only creates or recycles the UServerRow widgets that are on screen, so large
+	 * result sets do not stall the menu. The selected server stays selected as long as it is still listed.
 	 *
-	 * \param ServersData The array of FServerData objects representing the available servers.
+	 * \param ServersData The servers found since the last update, or all servers found once the search is complete.
+	 * \param bSearchComplete Whether ServersData holds the complete search results.
 	 *
 	 * \return None.
 	 *
-	 * \see FServerData, UServerRow
+	 * \see FServerData, UServerListItem, UServerRow
 	 */
-	void SetServerList(TArray<FServerData> ServersData);
+	void UpdateServerList(const TArray<FServerData>& ServersData, bool bSearchComplete);
+
 	/**
-	 * @brief Returns the selected index, if any.
-	 *
-	 * This method returns the selected index, if any, from the main menu. The index represents
-	 * the location of the selected item in the menu. If no item is currently selected, the method
-	 * will return an empty optional value.
+	 * @brief Returns the session ID of the selected server, if any.
 	 *
-	 * @return An optional value representing the selected index, or an empty optional if no index is selected.
+	 * @return The selected server's session ID, or an empty optional if no server is selected.
 	 * @see TOptional
 	 */
-	TOptional<uint32> GetSelectedIndex() const;
+	TOptional<FString> GetSelectedSessionId() const;
+
 	/**
-	 * @brief Sets the selected index in the main menu.
+	 * @brief Selects a server when the server list is a plain panel, and marks its row as selected.
+	 *
+	 * Called by the UServerRow that was clicked; a list view keeps its own selection instead.
 	 *
-	 * This method allows to set the selected index in the main menu. The selected index determines which menu option
-	 * is currently selected.
+	 * @param Item The server list item to select.
+	 */
+	void SelectServerItem(class UServerListItem* Item);
+
+	/**
+	 * @brief Applies the live state a server info beacon reported to the server's row.
 	 *
-	 * @param SelectedIndex The selected index value. Use TOptional<uint32>() to clear the selected index.
+	 * The item is updated in place, so only the row showing it (if any) refreshes. The list is not re-sorted, so
+	 * rows do not jump around under the cursor while the browser is open; the next search sorts by the new pings.
 	 *
-	 * @note Calling this method will also update the children rows in the main menu.
+	 * @param SessionId The ID of the session that was queried.
+	 * @param ServerInfo The server's live state.
+	 * @param PingInMs The round trip time of the query in milliseconds.
 	 */
-	void SetSelectedIndex(const TOptional<uint32>& SelectedIndex);
+	void ApplyServerInfo(const FString& SessionId, const struct FServerBeaconInfo& ServerInfo, int32 PingInMs);
 
 	/**
 	 * @brief Get the number of players.
@@ -94,22 +103,84 @@ private:
 	 * This method retrieves the game instance and checks if it is a valid instance.
 	 * If the game instance is null, an error message will be logged and the method will return.
 	 *
-	 * Then, it retrieves the player profile from the game instance. If the player profile is null,
-	 * a warning message will be logged.
+	 * Then, it asks the game instance to call ApplyPlayerProfile once the player profile has been loaded. The
+	 * profile is loaded asynchronously, so this may happen right away or some frames later.
 	 */
 	void LoadPlayerData();
 
 	/**
-	 * @brief The class representing the server row in the user interface.
+	 * @brief Applies the loaded player profile to the menu.
+	 *
+	 * Stores the profile and sets the custom player name text, the selected resolution and the volume slider value
+	 * from it.
+	 *
+	 * @param LoadedProfile The player profile that finished loading.
+	 */
+	void ApplyPlayerProfile(USideScrollerSaveGame* LoadedProfile);
+
+	/**
+	 * @brief The server list items, keyed by session ID.
+	 *
+	 * This is the data model behind the server list: sorting and filtering happen on these items, and the list view
+	 * is only told which of them to show and in what order.
+	 */
+	UPROPERTY()
+	TMap<FString, class UServerListItem*> ServerItemsById;
+
+	/**
+	 * @brief Sorts and filters ServerItemsById and hands the result to the ServerList list view, or rebuilds the rows
+	 * of a ServerList panel.
+	 *
+	 * Servers are shown lowest ping first, then by name, and only if they match the ServerFilter text.
+	 */
+	void RefreshServerListView();
+
+	/**
+	 * @brief Replaces the rows of a ServerList panel with one UServerRow per visible server.
+	 *
+	 * @param ServerListPanel The panel to fill.
+	 * @param VisibleItems The servers to show, in order.
+	 */
+	void RefreshServerListPanel(class UPanelWidget* ServerListPanel, const TArray<UServerListItem*>& VisibleItems);
+
+	/**
+	 * @brief The row widget class the ServerList panel is filled with, WBP_ServerRow.
+	 */
+	UPROPERTY()
+	TSubclassOf<UUserWidget> ServerRowClass;
+
+	/**
+	 * @brief The selected server when the ServerList is a panel, which has no selection of its own.
+	 */
+	UPROPERTY()
+	UServerListItem* SelectedServerItem = nullptr;
+
+	/**
+	 * @brief Called when the server filter text changes; re-filters the server list.
 	 *
-	 * This class is a subclass of UUserWidget and represents the visual representation of a server row
-	 * in the user interface. It is used to display server information such as server name, current
-	 * players, and ping.
+	 * @param Text The new filter text.
+	 */
+	UFUNCTION()
+	void OnServerFilterChanged(const FText& Text);
+
+	/**
+	 * @brief Seconds between refreshing the live state of the servers shown in the server list.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Server List")
+	float ServerInfoRefreshInterval = 2.f;
+
+	/**
+	 * @brief Timer that refreshes the shown servers while the join menu is open.
+	 */
+	FTimerHandle ServerInfoRefreshTimerHandle;
+
+	/**
+	 * @brief Asks the menu interface to refresh the live state of every server that currently has a row on screen.
 	 *
-	 * The class is defined by a TSubclassOf template, which allows selecting a specific subclass of
-	 * UUserWidget as the server row class. It is initialized with nullptr by default.
+	 * Only the rows the list view has created are refreshed, so the cost does not grow with the number of servers
+	 * found.
 	 */
-	TSubclassOf<class UUserWidget> ServerRowClass = nullptr;
+	void RefreshDisplayedServerInfo();
 
 	/**
 	 * @brief The HostButton variable.
@@ -228,21 +299,71 @@ private:
 	class UEditableText* CustomServerName;
 
 	/**
-	 * @brief This variable is a reference to a panel widget that represents the server list.
+	 * @brief This variable is a reference to the widget that represents the server list.
 	 *
-	 * The server list panel widget is used to display a list of available servers for clients to join.
-	 * This variable is used to bind a UPanelWidget object to the ServerList variable in Blueprint.
+	 * The server list is used to display a list of available servers for clients to join. It should be a list view
+	 * whose items are UServerListItem objects and whose entry widget class is WBP_ServerRow (a UServerRow); the list
+	 * view only creates entry widgets for the rows on screen and recycles them while scrolling.
 	 *
-	 * Example usage:
-	 *   - Bind a panel widget to the ServerList variable in Blueprint:
-	 *     ```cpp
-	 *     UPROPERTY(meta = (BindWidget))
-	 *     class UPanelWidget* ServerList;
-	 *     ```
-	 *   - Use the ServerList variable to perform operations on the server list panel widget.
+	 * @note WBP_MainMenu still has a panel here. Until the widget blueprint is changed to a list view in the editor,
+	 * a panel is filled with a WBP_ServerRow for every visible server, as before, so the menu keeps working.
 	 */
 	UPROPERTY(meta = (BindWidget))
-	class UPanelWidget* ServerList;
+	class UWidget* ServerList;
+
+	/**
+	 * @brief Optional text box for filtering the server list by server or host name.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UEditableText* ServerFilter;
+
+	/**
+	 * @brief Optional button that opens the replay page.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UButton* OpenReplayMenuButton;
+
+	/**
+	 * @brief Optional replay page: the match recordings on disk, where to start one, and buttons to play it or go
+	 * back.
+	 *
+	 * WBP_MainMenu does not have this page, so Initialize builds it, with its widgets and OpenReplayMenuButton, in
+	 * BuildReplayMenu. A widget blueprint that lays out its own replay page under these names keeps that one.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UWidget* ReplayMenu;
+
+	/**
+	 * @brief Optional combo box listing the match recordings on disk, newest first.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UComboBoxString* ReplaySelectComboBox;
+
+	/**
+	 * @brief Optional spin box with the time, in seconds, the selected recording starts playing at.
+	 *
+	 * Its maximum follows the length of the selected recording. Starting later than 0 seeks there as soon as the
+	 * recording has loaded, from the nearest checkpoint.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class USpinBox* ReplayStartSpinBox;
+
+	/**
+	 * @brief Optional button that plays the selected recording.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UButton* PlayReplayButton;
+
+	/**
+	 * @brief Optional button that goes back from the replay page to the main page.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UButton* BackButtonReplayMenu;
+
+	/**
+	 * @brief The match recordings listed in ReplaySelectComboBox, in the same order.
+	 */
+	TArray<FMatchReplayInfo> FoundReplays;
 
 	/**
 	 * @brief A variable representing a widget switcher for a menu.
@@ -429,6 +550,8 @@ private:
 
 	/**
 	 * @brief The PlayerProfile variable stores the instance of the player's save game data.
+	 *
+	 * Null until the game instance has finished loading the profile.
 	 */
 	UPROPERTY()
 	USideScrollerSaveGame* PlayerProfile;
@@ -465,8 +588,9 @@ private:
 	 * Opens the join menu.
 	 *
 	 * This method sets the active widget to the join menu widget in the menu switcher, and calls the
-	 * RefreshServerList method on the menu interface. If the menu interface is not found, an error message
-	 * is logged and the method returns. If the join menu widget or the menu switcher object is not found,
+	 * RefreshServerList method on the menu interface. While the join menu is open the rows on screen are refreshed
+	 * every ServerInfoRefreshInterval seconds through RefreshDisplayedServerInfo. If the menu interface is not found,
+	 * an error message is logged and the method returns. If the join menu widget or the menu switcher object is not found,
 	 * an error message is logged and the method returns.
 	 *
 	 * @param None
@@ -498,6 +622,51 @@ private:
 	UFUNCTION()
 	void OpenProfileMenu();
 
+	/**
+	 * @brief Opens the replay page and lists the match recordings on disk.
+	 *
+	 * The list is filled in by OnMatchReplaysFound once the replay streamer has looked through the recordings.
+	 */
+	UFUNCTION()
+	void OpenReplayMenu();
+
+	/**
+	 * @brief Lists the found match recordings in the replay combo box and selects the newest.
+	 *
+	 * @param Replays The match recordings on disk, newest first.
+	 */
+	void OnMatchReplaysFound(const TArray<FMatchReplayInfo>& Replays);
+
+	/**
+	 * @brief Limits the replay start time to the length of the newly selected recording.
+	 *
+	 * @param SelectedItem The label of the selected recording.
+	 * @param SelectionType How the recording was selected.
+	 */
+	UFUNCTION()
+	void OnReplaySelected(FString SelectedItem, ESelectInfo::Type SelectionType);
+
+	/**
+	 * @brief Plays the selected match recording from the time in ReplayStartSpinBox.
+	 */
+	UFUNCTION()
+	void PlaySelectedReplay();
+
+	/**
+	 * @brief Builds the replay page into the MenuSwitcher, and the button that opens it onto the main page, if the
+	 * widget blueprint does not have them.
+	 */
+	void BuildReplayMenu();
+
+	/**
+	 * @brief Creates a button with a text label, styled like the main page's buttons.
+	 *
+	 * @param Name The name of the new button.
+	 * @param Label The text on the button.
+	 * @return The new button.
+	 */
+	class UButton* MakeMenuButton(FName Name, const FText& Label);
+
 	/**
 	 * @brief Joins a server using either an IP address or a selected server index.
 	 *
@@ -583,37 +752,21 @@ private:
 	UFUNCTION()
 	void SetVolume(float Value);
 
-	/**
-	 * @brief Represents the selected index value.
-	 *
-	 * The SelectedIndex variable is an optional unsigned 32-bit integer value
-	 * that represents the index of a selected item in a collection or list.
-	 *
-	 * The value of SelectedIndex will be None if no item is selected.
-	 *
-	 * @see TOptional
-	 *
-	 * @note This documentation is generated using Doxygen.
-	 */
-	TOptional<uint32> SelectedIndex;
-
-	/**
-	 * @brief Updates the rows of the child widgets in the server list.
-	 *
-	 * This method iterates through each child widget in the server list and updates its row based on the
-	 * selected index value. If the selected index is set and matches the index of the current widget in the
-	 * server list, the widget's Selected property is set to true.
-	 */
-	void UpdateChildrenRows();
-	
 protected:
 	/**
 	 * Initializes the main menu.
 	 *
-	 * This method initializes the main menu by loading player data and setting up event bindings for various
-	 * UI elements. It also sets the custom player name text and handles the user input for setting the player name.
+	 * This method initializes the main menu by setting up event bindings for various UI elements and requesting
+	 * the player data. The custom player name text and the settings values are filled in once the profile is ready.
 	 *
 	 * @return true if initialization is successful, false otherwise
 	 */
 	virtual bool Initialize() override;
+
+	/**
+	 * @brief Opens the menu on its main page every time it is shown.
+	 *
+	 * The game instance caches the main menu, so without this it would come back on whatever page it was left on.
+	 */
+	virtual void NativeConstruct() override;
 };
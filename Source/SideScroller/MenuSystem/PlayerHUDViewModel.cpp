@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PlayerHUDViewModel.h"
+
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+
+/**
+ * Starts showing the stats of the given player, and stops showing the previous one.
+ *
+ * @param Player The locally controlled player pawn.
+ */
+void UPlayerHUDViewModel::BindToPlayer(APC_PlayerFox* Player)
+{
+	if (BoundPlayer.Get() == Player) return;
+
+	if (APC_PlayerFox* PreviousPlayer = BoundPlayer.Get())
+	{
+		UnbindFromPlayer(PreviousPlayer);
+	}
+	if (Player == nullptr) return;
+
+	BoundPlayer = Player;
+	HUDStatsChangedHandle = Player->OnHUDStatsChanged.AddUObject(this, &UPlayerHUDViewModel::Refresh);
+	Refresh(Player);
+}
+
+/**
+ * Stops listening to the given player, if it is the one bound.
+ *
+ * @param Player The player pawn going away.
+ */
+void UPlayerHUDViewModel::UnbindFromPlayer(const APC_PlayerFox* Player)
+{
+	if (Player == nullptr || BoundPlayer.Get() != Player) return;
+
+	BoundPlayer->OnHUDStatsChanged.Remove(HUDStatsChangedHandle);
+	HUDStatsChangedHandle.Reset();
+	BoundPlayer.Reset();
+}
+
+/**
+ * Broadcasts every value once.
+ */
+void UPlayerHUDViewModel::BroadcastAll()
+{
+	OnPointsChanged.Broadcast(Points);
+	OnLivesChanged.Broadcast(Lives);
+	OnCherriesChanged.Broadcast(Cherries);
+	OnMoneyChanged.Broadcast(Money);
+	OnHealthChanged.Broadcast(Health, MaxHealth);
+}
+
+int32 UPlayerHUDViewModel::GetPoints() const
+{
+	return Points;
+}
+
+int32 UPlayerHUDViewModel::GetLives() const
+{
+	return Lives;
+}
+
+int32 UPlayerHUDViewModel::GetCherries() const
+{
+	return Cherries;
+}
+
+int32 UPlayerHUDViewModel::GetMoney() const
+{
+	return Money;
+}
+
+float UPlayerHUDViewModel::GetHealthPercent() const
+{
+	return MaxHealth > 0.f ? Health / MaxHealth : 0.f;
+}
+
+/**
+ * Reads the player's stats and broadcasts only the ones that changed since the last read.
+ *
+ * @param Player The bound player pawn.
+ */
+void UPlayerHUDViewModel::Refresh(APC_PlayerFox* Player)
+{
+	if (Player == nullptr) return;
+
+	if (Points != Player->GetAccumulatedPoints())
+	{
+		Points = Player->GetAccumulatedPoints();
+		OnPointsChanged.Broadcast(Points);
+	}
+	if (Lives != Player->GetNumberOfLives())
+	{
+		Lives = Player->GetNumberOfLives();
+		OnLivesChanged.Broadcast(Lives);
+	}
+	if (Cherries != Player->GetCherryCount())
+	{
+		Cherries = Player->GetCherryCount();
+		OnCherriesChanged.Broadcast(Cherries);
+	}
+	if (Money != Player->GetMoneyCount())
+	{
+		Money = Player->GetMoneyCount();
+		OnMoneyChanged.Broadcast(Money);
+	}
+	if (Health != Player->GetHealth() || MaxHealth != Player->GetDefaultHealth())
+	{
+		Health = Player->GetHealth();
+		MaxHealth = Player->GetDefaultHealth();
+		OnHealthChanged.Broadcast(Health, MaxHealth);
+	}
+}
@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "PlayerHUDViewModel.generated.h"
+
+class APC_PlayerFox;
+
+/**
+ * @brief Broadcast when one of the counters shown on the HUD changed.
+ *
+ * @param NewCount The new value of the counter.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHUDCountChanged, int32, NewCount);
+
+/**
+ * @brief Broadcast when the health shown on the HUD changed.
+ *
+ * @param Health The player's current health.
+ * @param MaxHealth The player's full health.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHUDHealthChanged, float, Health, float, MaxHealth);
+
+/**
+ * @class UPlayerHUDViewModel
+ * @brief The values the player HUD shows, pushed to the HUD only when they change.
+ *
+ * Owned by the local AGameModePlayerController and bound to the pawn it controls. The pawn fires
+ * APC_PlayerFox::OnHUDStatsChanged from its setters and OnReps; the view model then compares the pawn's points,
+ * lives, cherries, money and health with the values it holds and broadcasts only the ones that differ. The HUD
+ * widget listens to those delegates instead of polling the pawn's getters through per-frame property bindings.
+ *
+ * @see UPlayerHUDWidget
+ */
+UCLASS(BlueprintType)
+class SIDESCROLLER_API UPlayerHUDViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Starts showing the stats of the given player, and stops showing the previous one.
+	 *
+	 * @param Player The locally controlled player pawn.
+	 */
+	void BindToPlayer(APC_PlayerFox* Player);
+
+	/**
+	 * @brief Stops showing the stats of the given player, if it is the one bound.
+	 *
+	 * @param Player The player pawn going away.
+	 */
+	void UnbindFromPlayer(const APC_PlayerFox* Player);
+
+	/**
+	 * @brief Broadcasts every value once, so a newly bound widget can fill itself in.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "HUD")
+	void BroadcastAll();
+
+	/**
+	 * @brief Gets the points shown on the HUD.
+	 *
+	 * @return The player's accumulated points.
+	 */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	int32 GetPoints() const;
+
+	/**
+	 * @brief Gets the lives shown on the HUD.
+	 *
+	 * @return The player's number of lives.
+	 */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	int32 GetLives() const;
+
+	/**
+	 * @brief Gets the cherries shown on the HUD.
+	 *
+	 * @return The number of cherries in the player's stash.
+	 */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	int32 GetCherries() const;
+
+	/**
+	 * @brief Gets the money shown on the HUD.
+	 *
+	 * @return The amount of money in the player's stash.
+	 */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	int32 GetMoney() const;
+
+	/**
+	 * @brief Gets the health shown on the HUD as a fraction of full health.
+	 *
+	 * @return The player's health between 0 and 1.
+	 */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	float GetHealthPercent() const;
+
+	/**
+	 * @brief Broadcast when the player's accumulated points changed.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "HUD")
+	FOnHUDCountChanged OnPointsChanged;
+
+	/**
+	 * @brief Broadcast when the player's number of lives changed.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "HUD")
+	FOnHUDCountChanged OnLivesChanged;
+
+	/**
+	 * @brief Broadcast when the player's cherry stash changed.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "HUD")
+	FOnHUDCountChanged OnCherriesChanged;
+
+	/**
+	 * @brief Broadcast when the player's money stash changed.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "HUD")
+	FOnHUDCountChanged OnMoneyChanged;
+
+	/**
+	 * @brief Broadcast when the player's health changed.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "HUD")
+	FOnHUDHealthChanged OnHealthChanged;
+
+private:
+	/**
+	 * @brief Reads the player's stats and broadcasts the ones that differ from the values held.
+	 *
+	 * @param Player The bound player pawn.
+	 */
+	void Refresh(APC_PlayerFox* Player);
+
+	/**
+	 * @brief The player pawn whose stats are shown.
+	 */
+	TWeakObjectPtr<APC_PlayerFox> BoundPlayer;
+
+	/**
+	 * @brief The handle of the binding to the bound player's OnHUDStatsChanged.
+	 */
+	FDelegateHandle HUDStatsChangedHandle;
+
+	/**
+	 * @brief The points last read from the player.
+	 */
+	int32 Points = 0;
+
+	/**
+	 * @brief The lives last read from the player.
+	 */
+	int32 Lives = 0;
+
+	/**
+	 * @brief The cherries last read from the player.
+	 */
+	int32 Cherries = 0;
+
+	/**
+	 * @brief The money last read from the player.
+	 */
+	int32 Money = 0;
+
+	/**
+	 * @brief The health last read from the player.
+	 */
+	float Health = 0.f;
+
+	/**
+	 * @brief The full health last read from the player.
+	 */
+	float MaxHealth = 0.f;
+};
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PlayerHUDWidget.h"
+
+#include "PlayerHUDViewModel.h"
+#include "Components/ProgressBar.h"
+#include "Components/TextBlock.h"
+
+/**
+ * Listens to the given view model's delegates and fills the widgets in with its current values.
+ *
+ * @param InViewModel The view model of the local player's HUD.
+ */
+void UPlayerHUDWidget::SetViewModel(UPlayerHUDViewModel* InViewModel)
+{
+	if (this->ViewModel == InViewModel) return;
+
+	this->UnbindViewModel();
+	this->ViewModel = InViewModel;
+	this->BindViewModel();
+}
+
+void UPlayerHUDWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+	this->BindViewModel();
+}
+
+void UPlayerHUDWidget::NativeDestruct()
+{
+	this->UnbindViewModel();
+	Super::NativeDestruct();
+}
+
+void UPlayerHUDWidget::BindViewModel()
+{
+	if (this->ViewModel == nullptr) return;
+
+	// NativeConstruct and SetViewModel can both get here; never add the same handler twice
+	this->UnbindViewModel();
+	this->ViewModel->OnPointsChanged.AddDynamic(this, &UPlayerHUDWidget::HandlePointsChanged);
+	this->ViewModel->OnLivesChanged.AddDynamic(this, &UPlayerHUDWidget::HandleLivesChanged);
+	this->ViewModel->OnCherriesChanged.AddDynamic(this, &UPlayerHUDWidget::HandleCherriesChanged);
+	this->ViewModel->OnMoneyChanged.AddDynamic(this, &UPlayerHUDWidget::HandleMoneyChanged);
+	this->ViewModel->OnHealthChanged.AddDynamic(this, &UPlayerHUDWidget::HandleHealthChanged);
+
+	this->HandlePointsChanged(this->ViewModel->GetPoints());
+	this->HandleLivesChanged(this->ViewModel->GetLives());
+	this->HandleCherriesChanged(this->ViewModel->GetCherries());
+	this->HandleMoneyChanged(this->ViewModel->GetMoney());
+	if (this->HealthBar != nullptr)
+	{
+		this->HealthBar->SetPercent(this->ViewModel->GetHealthPercent());
+	}
+	this->OnViewModelSet();
+}
+
+void UPlayerHUDWidget::UnbindViewModel()
+{
+	if (this->ViewModel == nullptr) return;
+
+	this->ViewModel->OnPointsChanged.RemoveAll(this);
+	this->ViewModel->OnLivesChanged.RemoveAll(this);
+	this->ViewModel->OnCherriesChanged.RemoveAll(this);
+	this->ViewModel->OnMoneyChanged.RemoveAll(this);
+	this->ViewModel->OnHealthChanged.RemoveAll(this);
+}
+
+void UPlayerHUDWidget::HandlePointsChanged(const int32 NewCount)
+{
+	if (this->PointsText == nullptr) return;
+	this->PointsText->SetText(FText::AsNumber(NewCount));
+}
+
+void UPlayerHUDWidget::HandleLivesChanged(const int32 NewCount)
+{
+	if (this->LivesText == nullptr) return;
+	this->LivesText->SetText(FText::AsNumber(NewCount));
+}
+
+void UPlayerHUDWidget::HandleCherriesChanged(const int32 NewCount)
+{
+	if (this->CherriesText == nullptr) return;
+	this->CherriesText->SetText(FText::AsNumber(NewCount));
+}
+
+void UPlayerHUDWidget::HandleMoneyChanged(const int32 NewCount)
+{
+	if (this->MoneyText == nullptr) return;
+	this->MoneyText->SetText(FText::AsNumber(NewCount));
+}
+
+void UPlayerHUDWidget::HandleHealthChanged(const float Health, const float MaxHealth)
+{
+	if (this->HealthBar == nullptr) return;
+	this->HealthBar->SetPercent(MaxHealth > 0.f ? Health / MaxHealth : 0.f);
+}
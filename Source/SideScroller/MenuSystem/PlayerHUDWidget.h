@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "PlayerHUDWidget.generated.h"
+
+class UPlayerHUDViewModel;
+
+/**
+ * @class UPlayerHUDWidget
+ * @brief The player HUD, updated from the delegates of a UPlayerHUDViewModel instead of per-frame bindings.
+ *
+ * Text and progress bar property bindings in UMG are evaluated every frame for every bound widget. This widget
+ * instead writes its optional text blocks and health bar only when the view model reports that a value changed.
+ * Blueprint subclasses that show the stats differently can listen to the view model's delegates in
+ * OnViewModelSet.
+ *
+ * Usage:
+ * - Reparent WBP_PlayerHUD to this class and name its widgets PointsText, LivesText, CherriesText, MoneyText and
+ *   HealthBar, removing their property bindings. This is a change to the widget blueprint asset, made in the
+ *   editor; until it is made the HUD keeps working through its old per-frame bindings.
+ */
+UCLASS()
+class SIDESCROLLER_API UPlayerHUDWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Shows the given view model, and stops listening to the previous one.
+	 *
+	 * @param InViewModel The view model of the local player's HUD.
+	 */
+	void SetViewModel(UPlayerHUDViewModel* InViewModel);
+
+	/**
+	 * @brief Optional text showing the player's accumulated points.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* PointsText;
+
+	/**
+	 * @brief Optional text showing the player's number of lives.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* LivesText;
+
+	/**
+	 * @brief Optional text showing the number of cherries in the player's stash.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* CherriesText;
+
+	/**
+	 * @brief Optional text showing the amount of money in the player's stash.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* MoneyText;
+
+	/**
+	 * @brief Optional bar showing the player's health as a fraction of full health.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UProgressBar* HealthBar;
+
+protected:
+	/**
+	 * @brief Called after SetViewModel, once the widgets have been filled in with the view model's values.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "HUD")
+	void OnViewModelSet();
+
+	/**
+	 * @brief Listens to the view model again when the widget is added back to the screen after being removed.
+	 */
+	virtual void NativeConstruct() override;
+
+	/**
+	 * @brief Stops listening to the view model when the widget is removed, but keeps it for NativeConstruct.
+	 */
+	virtual void NativeDestruct() override;
+
+	/**
+	 * @brief The view model the HUD shows. Kept while the widget is off screen.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "HUD")
+	UPlayerHUDViewModel* ViewModel = nullptr;
+
+private:
+	UFUNCTION()
+	void HandlePointsChanged(int32 NewCount);
+
+	UFUNCTION()
+	void HandleLivesChanged(int32 NewCount);
+
+	UFUNCTION()
+	void HandleCherriesChanged(int32 NewCount);
+
+	UFUNCTION()
+	void HandleMoneyChanged(int32 NewCount);
+
+	UFUNCTION()
+	void HandleHealthChanged(float Health, float MaxHealth);
+
+	/**
+	 * @brief Adds this widget's handlers to the view model's delegates and fills the widgets in with its values.
+	 */
+	void BindViewModel();
+
+	/**
+	 * @brief Removes this widget's handlers from the view model's delegates.
+	 */
+	void UnbindViewModel();
+};
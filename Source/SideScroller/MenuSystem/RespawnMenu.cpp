@@ -10,7 +10,7 @@
  * @brief Initializes the respawn menu.
  *
  * This method initializes the respawn menu by setting up button click events and checking for button references.
- * If the initialization is successful, the respawn button is disabled, and the respawn timer is started.
+ * The menu is created once and cached, so the countdown is started in NativeConstruct, every time it is shown.
  *
  * @return Returns true if initialization is successful, otherwise false.
  */
@@ -22,11 +22,6 @@ bool URespawnMenu::Initialize()
 	if (RespawnButton)
 	{
 		RespawnButton->OnClicked.AddDynamic(this, &URespawnMenu::Respawn);
-
-		RespawnButton->SetIsEnabled(false);
-
-		RespawnCountDown = RespawnDelayTime;
-		RunRespawnTimer();
 	}
 	else
 	{
@@ -64,6 +59,20 @@ bool URespawnMenu::Initialize()
 	return true;
 }
 
+/**
+ * @brief Disables the respawn button and restarts the countdown every time the menu is shown.
+ */
+void URespawnMenu::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	if (RespawnButton == nullptr) return;
+
+	RespawnButton->SetIsEnabled(false);
+	RespawnCountDown = RespawnDelayTime;
+	RunRespawnTimer();
+}
+
 /**
  * @brief Returns the user to the main menu.
  *
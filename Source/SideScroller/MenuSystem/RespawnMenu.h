@@ -41,6 +41,13 @@ protected:
 	UFUNCTION()
 	virtual bool Initialize() override;
 
+	/**
+	 * @brief Disables the respawn button and starts the respawn countdown.
+	 *
+	 * Runs every time the menu is added to the viewport, since the game instance re-shows the same cached menu.
+	 */
+	virtual void NativeConstruct() override;
+
 private:
 	/**
 	 * @class RespawnButton
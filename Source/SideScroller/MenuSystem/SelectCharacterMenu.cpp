@@ -3,68 +3,54 @@
 
 #include "SelectCharacterMenu.h"
 #include "Components/Button.h"
-#include "GameFramework/GameStateBase.h"
-#include "GameFramework/PlayerState.h"
 #include "SideScroller/SideScrollerGameInstance.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "SideScroller/Controllers/GameModePlayerController.h"
+#include "SideScroller/DataAssets/CharacterRoster.h"
+#include "SideScroller/GameStates/LobbyGameState.h"
 #include "SideScroller/PlayerStates/PlayerFoxState.h"
 
 /**
  * @brief Selects the pink player character.
  *
- * This method calls the SelectPlayer method with the appropriate blueprint and character name to select the
- * pink player.
- *
- * @param PinkPlayerBP The blueprint of the pink player character.
- * @param playerName The name of the pink player character.
+ * This method calls the SelectPlayer method with the roster color of the pink player.
  */
 void USelectCharacterMenu::PinkPlayerSelect()
 {
-	SelectPlayer(PinkPlayerBP, "Pink");
+	SelectPlayer("Pink");
 }
 
 /**
  * @brief Selects the orange player character.
  *
  * This method selects the orange player character by calling the SelectPlayer function.
- *
- * @param OrangePlayerBP The blueprint of the orange player character.
- * @param Color The color of the player character.
  */
 void USelectCharacterMenu::OrangePlayerSelect()
 {
-	SelectPlayer(OrangePlayerBP, "Orange");
+	SelectPlayer("Orange");
 }
 
 /**
  * @brief Function to select the yellow player character.
  *
  * This function is responsible for selecting the yellow player character in the character select menu.
- * It calls the SelectPlayer function with the necessary parameters to select the yellow player character.
- *
- * @param YellowPlayerBP The blueprint reference of the yellow player character.
- * @param PlayerName The name of the player character.
+ * It calls the SelectPlayer function with the roster color of the yellow player character.
  */
 void USelectCharacterMenu::YellowPlayerSelect()
 {
-	SelectPlayer(YellowPlayerBP, "Yellow");
+	SelectPlayer("Yellow");
 }
 
 /**
  * @brief Selects the Green player character.
  *
- * This method selects the Green player character by calling the SelectPlayer method with the GreenPlayerBP and
- * "Green" parameters.
- *
- * @param GreenPlayerBP The Blueprints of the Green player character.
- * @param color The color of the Green player character.
+ * This method selects the Green player character by calling the SelectPlayer method with "Green".
  *
  * @see USelectCharacterMenu::SelectPlayer()
  */
 void USelectCharacterMenu::GreenPlayerSelect()
 {
-	SelectPlayer(GreenPlayerBP, "Green");
+	SelectPlayer("Green");
 }
 
 /**
@@ -72,14 +58,11 @@ void USelectCharacterMenu::GreenPlayerSelect()
  * \details This method is called when the blue player is selected in the character menu.
  *          It calls the SelectPlayer method to set the blue player character.
  *
- * \param BluePlayerBP The blueprint of the blue player character to be selected.
- * \param BluePlayerTag The tag to be assigned to the blue player character.
- *
  * \see USelectCharacterMenu::SelectPlayer()
  */
 void USelectCharacterMenu::BluePlayerSelect()
 {
-	SelectPlayer(BluePlayerBP, "Blue");
+	SelectPlayer("Blue");
 }
 
 /**
@@ -87,18 +70,15 @@ void USelectCharacterMenu::BluePlayerSelect()
  *
  * This method selects the black player character by calling the SelectPlayer method with
  * the appropriate parameters.
- *
- * @param BlackPlayerBP The blueprint of the black player character.
  */
 void USelectCharacterMenu::BlackPlayerSelect()
 {
-	SelectPlayer(BlackPlayerBP, "Black");
+	SelectPlayer("Black");
 }
 
 /**
- * UpdateSelectedCharacterButtons method updates the status of selected character buttons.
- *
- * @param CharacterColorButtonMap A map containing the button color as key and the associated button as value.
+ * UpdateSelectedCharacterButtons method updates the status of selected character buttons from the claimed
+ * characters the lobby game state replicates.
  */
 void USelectCharacterMenu::UpdateSelectedCharacterButtons()
 {
@@ -111,67 +91,39 @@ void USelectCharacterMenu::UpdateSelectedCharacterButtons()
 		return;
 	}
 	
-	AGameStateBase* GameState = World->GetGameState();
-	if (GameState == nullptr)
+	const ALobbyGameState* LobbyGameState = World->GetGameState<ALobbyGameState>();
+	if (LobbyGameState == nullptr)
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - No update. Cant find GameState.")
+			TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - No update. Cant find LobbyGameState.")
 		);
 		return;
 	}
 
-	TArray<FString> CurrentPlayerPawnNames;
-	UE_LOG(LogTemp, Display, TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - Updating button statuses."));
-	for (const APlayerState* PlayerStateI : GameState->PlayerArray)
+	const USideScrollerGameInstance* GameInstance = GetGameInstance<USideScrollerGameInstance>();
+	const UCharacterRoster* CharacterRoster = GameInstance ? GameInstance->GetCharacterRoster() : nullptr;
+	if (CharacterRoster == nullptr)
 	{
-		const APawn* PlayerPawnI = PlayerStateI->GetPawn();
-		if (PlayerPawnI == nullptr)
-		{
-			UE_LOG(LogTemp, Warning,
-				TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - Cant get Pawn related to PlayerState %s."),
-				*PlayerStateI->GetName()
-			);
-			continue;
-		}
-		CurrentPlayerPawnNames.Add(PlayerPawnI->GetName());
+		UE_LOG(LogTemp, Warning,
+			TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - No update. Cant find the CharacterRoster.")
+		);
+		return;
 	}
 
-	std::map<FString, UButton*>::iterator Iterator = CharacterColorButtonMap.begin();
-	while (Iterator != CharacterColorButtonMap.end())
+	UE_LOG(LogTemp, Display, TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - Updating button statuses."));
+	for (const std::pair<const FString, UButton*>& ColorButton : CharacterColorButtonMap)
 	{
-		// Accessing the key
-		FString ButtonColor = Iterator->first;
-		// Accessing the value
-		UButton* Button = Iterator->second;
-
-		UE_LOG(LogTemp, VeryVerbose,
-			TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - Enabling, the %s button associated with "
-				"the %s charater. If a player is using this character, it will be disabled again."
-			),
-			*Button->GetName(),
-			*ButtonColor
+		const bool bIsClaimed = LobbyGameState->IsCharacterClaimed(
+			CharacterRoster->FindCharacterIndex(ColorButton.first)
 		);
-		Button->SetIsEnabled(true);
-		
-		// look through the CurrentPlayerPawnNames to see if each button color is in the name
-		for (FString PlayerPawnName : CurrentPlayerPawnNames)
-		{
-			if (PlayerPawnName.Contains(ButtonColor))
-			{
-				UE_LOG(LogTemp, Verbose,
-					TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - "
-						"Disabling %s as %s is using the %s charater."
-					),
-					*Button->GetName(),
-					*PlayerPawnName,
-					*ButtonColor
-				);
-				Button->SetIsEnabled(false);
-			}
-		}
-		
-		// iterator incremented to point next item
-		++Iterator;
+		UE_LOG(LogTemp, Verbose,
+			TEXT("USelectCharacterMenu::UpdateSelectedCharacterButtons - %s the %s button, the %s character is %s."),
+			bIsClaimed ? TEXT("Disabling") : TEXT("Enabling"),
+			*ColorButton.second->GetName(),
+			*ColorButton.first,
+			bIsClaimed ? TEXT("taken") : TEXT("free")
+		);
+		ColorButton.second->SetIsEnabled(!bIsClaimed);
 	}
 }
 
@@ -188,8 +140,6 @@ bool USelectCharacterMenu::Initialize()
 	if (PinkPlayerButton)
 	{
 		PinkPlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::PinkPlayerSelect);
-		PinkPlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		PinkPlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -200,8 +150,6 @@ bool USelectCharacterMenu::Initialize()
 	if (OrangePlayerButton)
 	{
 		OrangePlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::OrangePlayerSelect);
-		OrangePlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		OrangePlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -212,8 +160,6 @@ bool USelectCharacterMenu::Initialize()
 	if (YellowPlayerButton)
 	{
 		YellowPlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::YellowPlayerSelect);
-		YellowPlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		YellowPlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -224,8 +170,6 @@ bool USelectCharacterMenu::Initialize()
 	if (GreenPlayerButton)
 	{
 		GreenPlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::GreenPlayerSelect);
-		GreenPlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		GreenPlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -236,8 +180,6 @@ bool USelectCharacterMenu::Initialize()
 	if (BluePlayerButton)
 	{
 		BluePlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::BluePlayerSelect);
-		BluePlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		BluePlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -248,8 +190,6 @@ bool USelectCharacterMenu::Initialize()
 	if (BlackPlayerButton)
 	{
 		BlackPlayerButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::BlackPlayerSelect);
-		BlackPlayerButton->OnHovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
-		BlackPlayerButton->OnUnhovered.AddDynamic(this, &USelectCharacterMenu::UpdateSelectedCharacterButtons);
 	}
 	else
 	{
@@ -260,47 +200,6 @@ bool USelectCharacterMenu::Initialize()
 	if (CancelButton)
 	{
 		CancelButton->OnClicked.AddDynamic(this, &USelectCharacterMenu::BackToGame);
-		
-		CancelButton->SetIsEnabled(false);  // disabled if the player hasn't selected a character yet
-		APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
-		if (PlayerController == nullptr)
-		{
-			UE_LOG(LogTemp, Warning,
-				TEXT("USelectCharacterMenu::Initialize - No PlayerController. Not enabling cancel button.")
-			);
-		}
-		else
-		{
-			APC_PlayerFox* PlayerFox = dynamic_cast<APC_PlayerFox*>(PlayerController->GetPawn());
-			if (PlayerFox == nullptr)
-			{
-				UE_LOG(LogTemp, Warning,
-					TEXT("USelectCharacterMenu::Initialize - No PlayerFox. cant check if player selcted character")
-				);
-			}
-			else
-			{
-				const APlayerFoxState* PlayerFoxState = Cast<APlayerFoxState>(PlayerFox->GetPlayerState());
-				if (PlayerFoxState != nullptr)
-				{
-					if (PlayerFoxState->GetHasChosenCharacter())
-					{
-						UE_LOG(LogTemp, Display,
-						       TEXT("USelectCharacterMenu::Initialize - Player has selected character, "
-									"enabling cancel button."
-								)
-						);
-						CancelButton->SetIsEnabled(true);
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning,
-						TEXT("USelectCharacterMenu::Initialize - Cant find PlayerFoxState, wont enable cancel button.")
-					);
-				}
-			}
-		}
 	}
 	else
 	{
@@ -320,19 +219,92 @@ bool USelectCharacterMenu::Initialize()
 
 	CharacterColorButtonMap = {
 		{"Pink",			PinkPlayerButton},
-		{"PC_PlayerFox_C",	OrangePlayerButton},
+		{"Orange",			OrangePlayerButton},
 		{"Yellow",			YellowPlayerButton},
 		{"Green",			GreenPlayerButton},
 		{"Blue",			BluePlayerButton},
 		{"Black",			BlackPlayerButton}
 	};
 
-	UpdateSelectedCharacterButtons();
-	
 	UE_LOG(LogTemp, Display, TEXT("USelectCharacterMenu::Initialize - Select Character Menu Init complete!"));
 	return true;
 }
 
+/**
+ * Refreshes the character buttons and the cancel button every time the menu is shown.
+ */
+void USelectCharacterMenu::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	if (ALobbyGameState* LobbyGameState = GetWorld()->GetGameState<ALobbyGameState>())
+	{
+		BoundLobbyGameState = LobbyGameState;
+		ClaimedCharactersChangedHandle = LobbyGameState->OnClaimedCharactersChanged.AddUObject(
+			this, &USelectCharacterMenu::UpdateSelectedCharacterButtons
+		);
+	}
+	UpdateSelectedCharacterButtons();
+
+	if (CancelButton == nullptr) return;
+
+	CancelButton->SetIsEnabled(false);  // disabled if the player hasn't selected a character yet
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("USelectCharacterMenu::NativeConstruct - No PlayerController. Not enabling cancel button.")
+		);
+	}
+	else
+	{
+		APC_PlayerFox* PlayerFox = dynamic_cast<APC_PlayerFox*>(PlayerController->GetPawn());
+		if (PlayerFox == nullptr)
+		{
+			UE_LOG(LogTemp, Warning,
+				TEXT("USelectCharacterMenu::NativeConstruct - No PlayerFox. cant check if player selcted character")
+			);
+		}
+		else
+		{
+			const APlayerFoxState* PlayerFoxState = Cast<APlayerFoxState>(PlayerFox->GetPlayerState());
+			if (PlayerFoxState != nullptr)
+			{
+				if (PlayerFoxState->GetHasChosenCharacter())
+				{
+					UE_LOG(LogTemp, Display,
+					       TEXT("USelectCharacterMenu::NativeConstruct - Player has selected character, "
+								"enabling cancel button."
+							)
+					);
+					CancelButton->SetIsEnabled(true);
+				}
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning,
+					TEXT("USelectCharacterMenu::NativeConstruct - Cant find PlayerFoxState, wont enable cancel button.")
+				);
+			}
+		}
+	}
+}
+
+/**
+ * Stops listening for claimed character changes while the menu is hidden.
+ */
+void USelectCharacterMenu::NativeDestruct()
+{
+	if (ALobbyGameState* LobbyGameState = BoundLobbyGameState.Get())
+	{
+		LobbyGameState->OnClaimedCharactersChanged.Remove(ClaimedCharactersChangedHandle);
+	}
+	BoundLobbyGameState.Reset();
+	ClaimedCharactersChangedHandle.Reset();
+
+	Super::NativeDestruct();
+}
+
 /**
  * \brief Returns to the main menu.
  *
@@ -371,42 +343,12 @@ void USelectCharacterMenu::BackToGame()
 }
 
 /**
- * Writes a launch warning on the screen.
- *
- * @param PlayerController The player controller to write the launch warning.
- * @return True if the launch warning was successfully written on the screen, false otherwise.
- */
-bool USelectCharacterMenu::WriteLaunchWarningOnScreen(APlayerController* PlayerController)
-{
-	USideScrollerGameInstance* GameInstance = Cast<USideScrollerGameInstance>(GetWorld()->GetGameInstance());
-	if (GameInstance != nullptr)
-	{
-		UEngine* Engine = GameInstance->GetEngine();
-		if (!Engine) return true;
-		Engine->AddOnScreenDebugMessage(0,
-            CheckStartReadinessDelayTimer,
-            FColor::Green,
-            TEXT("USelectCharacterMenu::SelectPlayer - Checking to see if all players are ready, if so "
-                "the game will be launching in a few seconds"
-            )
-		);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning,
-		       TEXT("USelectCharacterMenu::SelectPlayer - Can't show onscreen message. GameInstance is null!")
-		);
-	}
-	return false;
-}
-
-/**
- * Selects a player character based on the provided player blueprint and color string.
+ * Selects a player character by its color in the character roster. The character is loaded locally before the
+ * server is asked to spawn it.
  *
- * @param PlayerBP The blueprint class of the player character to select.
  * @param PlayerColorStr The color string of the player character to select.
  */
-void USelectCharacterMenu::SelectPlayer(const TSubclassOf<APC_PlayerFox> PlayerBP, const FString& PlayerColorStr)
+void USelectCharacterMenu::SelectPlayer(const FString& PlayerColorStr)
 {
 	UE_LOG(LogTemp, Display,
 		TEXT("USelectCharacterMenu::SelectPlayer - Player Selected the %s player character."),
@@ -432,42 +374,25 @@ void USelectCharacterMenu::SelectPlayer(const TSubclassOf<APC_PlayerFox> PlayerB
 		return;
 	}
 
-	GameModePlayerController->SpawnPlayer(PlayerBP, PlayerColorStr, PlayerController);
-	BackToGame();
+	USideScrollerGameInstance* GameInstance = GetGameInstance<USideScrollerGameInstance>();
+	if (GameInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("USelectCharacterMenu::SelectPlayer - Select %s character failed! No GameInstance."),
+			*PlayerColorStr
+		);
+		return;
+	}
 
-	CheckStartReadinessDelayTimerDelegate.BindUFunction(
-		this,
-		FName("CheckStartReadinessDelay"),
-		GameModePlayerController
-	);
-	
-	GetWorld()->GetTimerManager().SetTimer(
-		this->CheckStartReadinessDelayTimerHandle,
-		CheckStartReadinessDelayTimerDelegate,
-		CheckStartReadinessDelayTimer,
-		false
+	// stream the character in here too, so it is loaded before its pawn replicates to this machine
+	const TWeakObjectPtr<AGameModePlayerController> WeakGameModePlayerController = GameModePlayerController;
+	GameInstance->LoadCharacterClass(
+		PlayerColorStr,
+		[WeakGameModePlayerController, PlayerColorStr](const TSubclassOf<APC_PlayerFox> PlayerBP)
+		{
+			if (PlayerBP == nullptr || !WeakGameModePlayerController.IsValid()) return;
+			WeakGameModePlayerController->SpawnPlayer(PlayerColorStr, WeakGameModePlayerController.Get());
+		}
 	);
-
-	if (WriteLaunchWarningOnScreen(PlayerController)) return;
-}
-
-/**
- * @brief CheckStartReadinessDelay method checks the readiness delay of a game mode player controller
- *        and performs required actions accordingly.
- *
- * @param GameModePlayerController The game mode player controller to check readiness delay for.
- *
- * @details This method checks the readiness delay of the specified game mode player controller.
- *          If the game mode player controller has fulfilled the necessary requirements, it will
- *          perform the required actions to start the game, such as checking game start requirements
- *          and traveling to the level.
- *          Note: This method does not return any values.
- *
- * @see AGameModePlayerController::CheckGameStartReqs()
- * @see AGameModePlayerController::TravelToLevel()
- */
-void USelectCharacterMenu::CheckStartReadinessDelay(AGameModePlayerController* GameModePlayerController)
-{
-	GameModePlayerController->CheckGameStartReqs();
-	GameModePlayerController->TravelToLevel();
+	BackToGame();
 }
@@ -24,123 +24,16 @@
 class APC_PlayerFox;
 /**
  * USelectCharacterMenu is a subclass of UMenuWidget that represents the character selection menu in the game.
- * This menu allows the player to choose their character from a list of available options.
+ * This menu allows the player to choose their character from a list of available options. The characters are
+ * picked by color from the character roster, which only soft references them, so none are loaded by the menu.
+ *
+ * @see UCharacterRoster
  */
 UCLASS()
 class SIDESCROLLER_API USelectCharacterMenu : public UMenuWidget
 {
 	GENERATED_BODY()
 
-public:
-	/**
-	 * @brief The PinkPlayerBP variable is a reference to the blueprint class "APC_PlayerFox" for the Pink player.
-	 *
-	 * This variable is an editable property that can be modified in the editor.
-	 * It belongs to the "Classes" category and can be read and modified in Blueprints.
-	 *
-	 * The default value of the PinkPlayerBP is nullptr, indicating that no specific Pink player blueprint is
-	 * assigned. In order to assign a specific blueprint, you can change the value of this variable in the editor
-	 * or in Blueprints.
-	 *
-	 * @see APC_PlayerFox
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> PinkPlayerBP = nullptr;
-
-	/**
-	 * Variable for storing the blueprint class used to spawn the Orange Player character.
-	 *
-	 * The OrangePlayerBP variable is of type TSubclassOf<APC_PlayerFox>, which is a template class that allows for
-	 * storing a reference to a blueprint class. This blueprint class is used to create instances of the Orange
-	 * Player character in the game.
-	 *
-	 * The variable is decorated with the EditAnywhere and BlueprintReadWrite UPROPERTY macros, which enables the
-	 * class variable to be modified in the Unreal Engine editor and accessed from blueprints to spawn the Orange
-	 * Player character.
-	 *
-	 * The Category parameter is set to "Classes", which group the variables in this category in the Unreal Engine
-	 * editor for better organization.
-	 *
-	 * The initial value of the OrangePlayerBP variable is set to nullptr, which means that if no blueprint class
-	 * is assigned, the default value will be null.
-	 *
-	 * @see APC_PlayerFox
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> OrangePlayerBP = nullptr;
-
-	/**
-	 * @brief The Blueprint subclass of the Yellow player character.
-	 *
-	 * This variable represents the Blueprint subclass of the Yellow player character.
-	 * It is used to spawn an instance of the Yellow player character in the game world.
-	 *
-	 * @details This variable is of type TSubclassOf<APC_PlayerFox> and allows for easy selection of the Yellow
-	 * player character from within the Unreal Editor Blueprint system. It can be assigned a Blueprint class
-	 * that derives from the base class APC_PlayerFox.
-	 *
-	 * The "EditAnywhere" property specifier allows this variable to be modified in the Unreal Editor.
-	 * The "BlueprintReadWrite" property specifier enables it to be accessed and modified from Blueprint scripts.
-	 * It is categorized under "Classes" to help organize related variables.
-	 *
-	 * The default value of this variable is nullptr, meaning it is initially not assigned to any class.
-	 * This allows for easy detection of whether a valid Blueprint class has been assigned at runtime.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> YellowPlayerBP = nullptr;
-
-	/**
-	 * @brief The GreenPlayerBP variable is a blueprint class pointer property that allows assigning a subclass
-	 *        of APC_PlayerFox to it. This variable is editable anywhere and readable/writable in Blueprints.
-	 *        It belongs to the "Classes" category.
-	 *
-	 * @details This variable is used to specify the class of the green player blueprint that will be used in
-	 *          the game. It should be assigned to a subclass of APC_PlayerFox. The initial value of the
-	 *          GreenPlayerBP variable is nullptr, which means it is not pointing to any subclass at the start.
-	 *          It can be modified in Blueprint editor and accessed in Blueprints for gameplay purposes.
-	 *
-	 * @see APC_PlayerFox
-	 *
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> GreenPlayerBP = nullptr;
-
-	/**
-	 * @brief The BluePlayerBP variable represents the blueprint class used to spawn the blue player character.
-	 *
-	 * The BluePlayerBP variable is a TSubclassOf type that allows selecting a blueprint class from the property
-	 * editor in Unreal Engine. It is used to determine the blueprint class to spawn when creating instances
-	 * of the blue player character.
-	 *
-	 * @details The blueprint class selected for the BluePlayerBP variable must be a subclass of the
-	 * APC_PlayerFox class.
-	 *
-	 * @note The default value for the BluePlayerBP variable is nullptr, meaning no blueprint class is initially
-	 * assigned. It is recommended to assign a valid blueprint class before using this variable to avoid
-	 * crashes or unexpected behavior.
-	 *
-	 * @see APC_PlayerFox
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> BluePlayerBP = nullptr;
-
-	/**
-	 * @brief The class variable BlackPlayerBP is a blueprint reference to the Black Player Fox class.
-	 *
-	 * BlackPlayerBP is used to spawn instances of the Black Player Fox class during gameplay. It is a subclass
-	 * of APC_PlayerFox. The variable is editable in Blueprint, allowing designers to specify the Black Player
-	 * Fox class they want to use. This variable is visible and can be modified in the Blueprint editor.
-	 * The Black Player Fox class must be derived from APC_PlayerFox.
-	 * The default value for BlackPlayerBP is nullptr, meaning no Black Player Fox class is selected by default.
-	 * Set a valid Black Player Fox class to BlackPlayerBP using the Blueprint editor or through C++ code.
-	 *
-	 * @see APC_PlayerFox
-	 *
-	 * @since The variable was first introduced in the project.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Classes)
-	TSubclassOf<APC_PlayerFox> BlackPlayerBP = nullptr;
-
 protected:
 	/**
 	 * Selects the pink player.
@@ -167,7 +60,7 @@ protected:
 	 * @brief Selects the yellow player character.
 	 *
 	 * This method is used to select the yellow player character in the select character menu.
-	 * It calls the SelectPlayer() function passing the YellowPlayerBP blueprint and "Yellow" as the parameters.
+	 * It calls the SelectPlayer() function passing "Yellow" as the roster color.
 	 *
 	 * @param void None
 	 *
@@ -180,9 +73,6 @@ protected:
 	 * @brief Selects the green player.
 	 *
 	 * This method is used to select the green player character in the Select Character Menu.
-	 *
-	 * @param GreenPlayerBP The blueprint of the green player character.
-	 * @param GreenPlayerName The name of the green player character.
 	 */
 	UFUNCTION()
 	void GreenPlayerSelect();
@@ -193,8 +83,6 @@ protected:
 	 * This method is responsible for selecting the blue player in the character menu.
 	 * It internally calls the SelectPlayer() method to update the player selection.
 	 *
-	 * @param BluePlayerBP The blueprint of the blue player.
-	 *
 	 * @see SelectPlayer()
 	 */
 	UFUNCTION()
@@ -205,7 +93,7 @@ protected:
 	 *
 	 * This function is responsible for selecting the black player character.
 	 * It calls the SelectPlayer() function from the USelectCharacterMenu class
-	 * passing the black player blueprint as a parameter and "Black" as the player name.
+	 * passing "Black" as the roster color.
 	 *
 	 * @param None.
 	 *
@@ -217,12 +105,9 @@ protected:
 	/**
 	 * @brief Updates the status of selected character buttons based on the current game state.
 	 *
-	 * This method checks the current game state and enables or disables the associated character buttons accordingly.
-	 * If a player is already using a specific character, the button for that character will be disabled.
-	 *
-	 * @param None
-	 *
-	 * @return None
+	 * This method reads the claimed characters bitmask of the lobby game state and enables or disables the
+	 * associated character buttons accordingly. If a player is already using a specific character, the button for
+	 * that character will be disabled. It runs when the menu is shown and whenever the bitmask changes.
 	 */
 	UFUNCTION()
 	void UpdateSelectedCharacterButtons();
@@ -233,12 +118,28 @@ protected:
 	 * @return True if the initialization was successful, otherwise false.
 	 */
 	virtual bool Initialize() override;
+
+	/**
+	 * Refreshes which characters can be picked and whether the menu can be cancelled. This method is called every
+	 * time the menu is shown, since the game instance re-shows the same cached menu.
+	 */
+	virtual void NativeConstruct() override;
+
+	/**
+	 * Stops listening for claimed character changes. This method is called every time the menu is hidden.
+	 */
+	virtual void NativeDestruct() override;
 	
 private:
 	/**
+	 * @brief Picks the roster character of the given color for the local player.
+	 *
+	 * The character's blueprint class is streamed in on this machine first, so it is ready by the time the server
+	 * spawns it and the pawn replicates back, and then the server is asked to spawn it.
 	 *
+	 * @param PlayerColorStr The color of the picked character in the character roster.
 	 */
-	void SelectPlayer(TSubclassOf<APC_PlayerFox> PlayerBP, const FString& PlayerColorStr);
+	void SelectPlayer(const FString& PlayerColorStr);
 
 	/**
 	 * @brief A variable representing a Pink Player Button.
@@ -354,70 +255,11 @@ private:
 	 */
 	UFUNCTION(BlueprintCallable)
 	virtual void BackToGame();
-	/**
-	 * Writes a launch warning message on the screen for a player controller.
-	 *
-	 * @param PlayerController The player controller to write the warning for.
-	 * @return true if the warning was successfully written, false otherwise.
-	 */
-	bool WriteLaunchWarningOnScreen(APlayerController* PlayerController);
-
-	/**
-	 * @brief Checks the start readiness delay for the game mode player controller.
-	 *
-	 * @param GameModePlayerController The game mode player controller to check the start readiness delay for.
-	 */
-	UFUNCTION(BlueprintCallable)
-	static void CheckStartReadinessDelay(AGameModePlayerController* GameModePlayerController);
-
-	/**
-	 * @brief The delay timer for checking start readiness.
-	 *
-	 * The CheckStartReadinessDelayTimer variable is a float value that represents the delay in seconds for
-	 * checking the start readiness. It is editable anywhere and its initial value is 2.0.
-	 *
-	 * @note Modifying this variable at runtime can affect the timing of the start readiness check.
-	 */
-	UPROPERTY(EditAnywhere)
-	float CheckStartReadinessDelayTimer = 2.0;
-
-	/**
-	 * @brief Timer handle variable for delaying the start readiness check.
-	 *
-	 * Should be used to store the timer handle for delaying the
-	 * start readiness check in Unreal Engine projects.
-	 */
-	FTimerHandle CheckStartReadinessDelayTimerHandle;
-
-	/**
-	 * @brief CheckStartReadinessDelayTimerDelegate represents a timer delegate used for checking the
-	 * readiness delay.
-	 *
-	 * The CheckStartReadinessDelayTimerDelegate is used to handle a timer event that checks the readiness delay.
-	 * It is used in conjunction with a timer object to execute a specific function or callback when the timer
-	 * event is triggered.
-	 *
-	 * Usage example:
-	 *
-	 * ```cpp
-	 * FTimerHandle TimerHandle;
-	 * FTimerDelegate TimerDelegate;
-	 *
-	 * // Set up the timer delegate
-	 * TimerDelegate.BindUObject(this, &AMyClass::OnTimerExpired);
-	 *
-	 * // Start the timer with the delegate
-	 * GetWorldTimerManager().SetTimer(TimerHandle, TimerDelegate, 5.0f, false, 0.0f);
-	 * ```
-	 *
-	 * @see FTimerHandle, FTimerDelegate
-	 */
-	FTimerDelegate CheckStartReadinessDelayTimerDelegate;
 
 	/**
 	 * @brief A map representing the relationship between character colors and buttons.
 	 *
-	 * This map stores character colors as keys and UButton pointers as values.
+	 * This map stores character colors, as named in the character roster, as keys and UButton pointers as values.
 	 *
 	 * @details
 	 * The map enables easy access to buttons based on the corresponding character color.
@@ -430,4 +272,14 @@ private:
 	 * @see UButton
 	 */
 	std::map<FString, UButton*> CharacterColorButtonMap;
+
+	/**
+	 * @brief The lobby game state the menu listens to for claimed character changes while it is shown.
+	 */
+	TWeakObjectPtr<class ALobbyGameState> BoundLobbyGameState;
+
+	/**
+	 * @brief The handle of the menu's binding to ALobbyGameState::OnClaimedCharactersChanged.
+	 */
+	FDelegateHandle ClaimedCharactersChangedHandle;
 };
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ServerListItem.h"
+
+/**
+ * @brief Gets the server data the item represents.
+ *
+ * @return The server data.
+ */
+const FServerData& UServerListItem::GetServerData() const
+{
+	return ServerData;
+}
+
+/**
+ * @brief Replaces the server data and broadcasts OnChanged if anything the row shows has changed.
+ *
+ * @param NewServerData The newer data for the same session.
+ */
+void UServerListItem::SetServerData(const FServerData& NewServerData)
+{
+	const bool bChanged = ServerData.ServerName != NewServerData.ServerName ||
+		ServerData.HostUserName != NewServerData.HostUserName ||
+		ServerData.CurrentPlayers != NewServerData.CurrentPlayers ||
+		ServerData.MaxPlayers != NewServerData.MaxPlayers ||
+		ServerData.PingInMs != NewServerData.PingInMs ||
+		ServerData.Level != NewServerData.Level;
+
+	ServerData = NewServerData;
+	if (bChanged)
+	{
+		OnChanged.Broadcast();
+	}
+}
+
+/**
+ * @brief Checks whether the server name or host name contains the filter text, ignoring case.
+ *
+ * @param FilterText The text to look for.
+ * @return True if the filter is empty or matches.
+ */
+bool UServerListItem::MatchesFilter(const FString& FilterText) const
+{
+	if (FilterText.IsEmpty()) return true;
+
+	return ServerData.ServerName.Contains(FilterText, ESearchCase::IgnoreCase) ||
+		ServerData.HostUserName.Contains(FilterText, ESearchCase::IgnoreCase);
+}
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SideScroller/SideScrollerGameInstance.h"
+#include "ServerListItem.generated.h"
+
+/**
+ * @brief Broadcast when the data of a server list item was updated by a newer search result.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnServerListItemChanged);
+
+/**
+ * @class UServerListItem
+ * @brief The data model behind one row of the server browser.
+ *
+ * The main menu keeps one UServerListItem per session, keyed by the session ID, and hands them to its UListView. The
+ * list view only creates UServerRow widgets for the items that are on screen and recycles them as the list scrolls,
+ * so the number of sessions found does not change the number of widgets. When a search reports a session again its
+ * existing item is updated in place and the row showing it (if any) refreshes itself through OnChanged.
+ */
+UCLASS()
+class SIDESCROLLER_API UServerListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Gets the server data the item represents.
+	 *
+	 * @return The server data.
+	 */
+	const FServerData& GetServerData() const;
+
+	/**
+	 * @brief Replaces the server data and notifies the row showing it, if anything changed.
+	 *
+	 * @param NewServerData The newer data for the same session.
+	 */
+	void SetServerData(const FServerData& NewServerData);
+
+	/**
+	 * @brief Checks whether the server name or host name contains the filter text.
+	 *
+	 * @param FilterText The text to look for, ignoring case. An empty filter matches every server.
+	 * @return True if the server should be shown.
+	 */
+	bool MatchesFilter(const FString& FilterText) const;
+
+	/**
+	 * @brief Broadcast after SetServerData changed the item's data.
+	 */
+	FOnServerListItemChanged OnChanged;
+
+private:
+	/**
+	 * @brief The server data the item represents.
+	 */
+	FServerData ServerData;
+};
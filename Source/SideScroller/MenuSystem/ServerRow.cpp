@@ -2,30 +2,136 @@
 
 
 #include "ServerRow.h"
+#include "Blueprint/IUserListEntry.h"
 #include "Components/Button.h"
+#include "Components/ListView.h"
+#include "Components/TextBlock.h"
 #include "MainMenu.h"
+#include "ServerListItem.h"
 
 /**
- * @brief Set up the server row.
+ * @brief Binds the row button once, when the row widget is first created.
  *
- * This method is responsible for setting up the server row with the given parent and index.
+ * List view rows are recycled, so this runs once per row widget rather than once per server.
+ */
+void UServerRow::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+	RowButton->OnClicked.AddDynamic(this, &UServerRow::OnClicked);
+}
+
+/**
+ * @brief Shows the given server list item in the row.
+ *
+ * @param ListItemObject The UServerListItem to show.
+ */
+void UServerRow::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+	SetServerItem(Cast<UServerListItem>(ListItemObject));
+}
+
+/**
+ * @brief Shows the given server list item in a row of the main menu's ServerList panel.
  *
- * @param InParent - The parent UMainMenu instance.
- * @param InIndex - The index of the server row.
+ * @param InParent The main menu whose server the row selects when clicked.
+ * @param Item The server list item to show, or null to stop showing one.
  */
-void UServerRow::Setup(UMainMenu* InParent, uint32 InIndex)
+void UServerRow::ShowServerItem(UMainMenu* InParent, UServerListItem* Item)
 {
 	Parent = InParent;
-	Index = InIndex;
-	RowButton->OnClicked.AddDynamic(this, &UServerRow::OnClicked);
+	SetServerItem(Item);
+}
+
+/**
+ * @brief Stops listening to the previous item, then shows and listens to the given one.
+ *
+ * @param Item The server list item to show, or null.
+ */
+void UServerRow::SetServerItem(UServerListItem* Item)
+{
+	if (UServerListItem* PreviousItem = ServerItem.Get())
+	{
+		PreviousItem->OnChanged.Remove(ServerItemChangedHandle);
+	}
+
+	ServerItem = Item;
+	if (Item != nullptr)
+	{
+		ServerItemChangedHandle = Item->OnChanged.AddUObject(this, &UServerRow::RefreshTexts);
+	}
+	RefreshTexts();
+}
+
+/**
+ * @brief Mirrors the list view's selection into the Selected flag the blueprint styles the row with.
+ *
+ * @param bIsSelected Whether the row's item is now selected.
+ */
+void UServerRow::NativeOnItemSelectionChanged(bool bIsSelected)
+{
+	IUserObjectListEntry::NativeOnItemSelectionChanged(bIsSelected);
+	Selected = bIsSelected;
+}
+
+/**
+ * @brief Stops listening to the row's item when the list view puts the row back into its pool.
+ */
+void UServerRow::NativeOnEntryReleased()
+{
+	IUserObjectListEntry::NativeOnEntryReleased();
+
+	if (UServerListItem* PreviousItem = ServerItem.Get())
+	{
+		PreviousItem->OnChanged.Remove(ServerItemChangedHandle);
+	}
+	ServerItem.Reset();
+	Selected = false;
+}
+
+/**
+ * @brief Fills in the server name, host user, connection fraction, level and ping from the row's item.
+ */
+void UServerRow::RefreshTexts()
+{
+	const UServerListItem* Item = ServerItem.Get();
+	if (Item == nullptr) return;
+
+	const FServerData& ServerData = Item->GetServerData();
+	ServerListItem->SetText(FText::FromString(ServerData.ServerName));
+	HostUser->SetText(FText::FromString(ServerData.HostUserName));
+	const FString FractionText = FString::Printf(TEXT("%d/%d"), ServerData.CurrentPlayers, ServerData.MaxPlayers);
+	ConnectionFraction->SetText(FText::FromString(FractionText));
+
+	if (ServerLevel)
+	{
+		const FString LevelText = ServerData.Level > 0
+			? FString::Printf(TEXT("Level %d"), ServerData.Level)
+			: FString(TEXT("Lobby"));
+		ServerLevel->SetText(FText::FromString(LevelText));
+	}
+	if (ServerPing)
+	{
+		ServerPing->SetText(FText::FromString(FString::Printf(TEXT("%d ms"), ServerData.PingInMs)));
+	}
 }
 
 /**
  * @brief Called when the server row is clicked.
  *
- * This method sets the selected index of the parent.
+ * This method selects the row's item in the list view that owns the row, or in the parent menu when the row is part
+ * of a ServerList panel.
  */
 void UServerRow::OnClicked()
 {
-	Parent->SetSelectedIndex(Index);
+	if (!ServerItem.IsValid()) return;
+
+	if (UListView* OwningListView = Cast<UListView>(UUserListEntryLibrary::GetOwningListView(this)))
+	{
+		OwningListView->SetSelectedItem(ServerItem.Get());
+	}
+	else if (UMainMenu* ParentMenu = Parent.Get())
+	{
+		ParentMenu->SelectServerItem(ServerItem.Get());
+	}
 }
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "ServerRow.generated.h"
 
 /**
@@ -15,13 +16,17 @@
  * server list. It contains UTextBlock widgets for displaying server details like the host user and
  * connection fraction.
  *
+ * Rows are entry widgets of the main menu's server UListView: the list view creates only as many rows as fit on
+ * screen and hands each one a UServerListItem to show, recycling the rows as the list scrolls or changes.
+ *
  * Usage:
- * - Create an instance of UServerRow.
- * - Call the Setup function to initialize the server row with the appropriate parent and index values.
- * - Bind the OnClicked event of the RowButton widget to the OnClicked function of the UServerRow.
+ * - Set WBP_ServerRow as the entry widget class of the main menu's ServerList list view.
+ * - Clicking the RowButton selects the row's item in the list view.
+ * - While the main menu's ServerList is still a plain panel, the menu creates the rows itself and hands each its
+ *   item through ShowServerItem; clicking a row then selects it through the menu.
  */
 UCLASS()
-class SIDESCROLLER_API UServerRow : public UUserWidget
+class SIDESCROLLER_API UServerRow : public UUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -57,6 +62,20 @@ public:
 	UPROPERTY(meta = (BindWidget))
 	class UTextBlock* ConnectionFraction;
 
+	/**
+	 * @brief Optional text showing the level the server is playing, or "Lobby".
+	 *
+	 * Filled in once the server's info beacon answered.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* ServerLevel;
+
+	/**
+	 * @brief Optional text showing the round trip time to the server in milliseconds.
+	 */
+	UPROPERTY(meta = (BindWidgetOptional))
+	class UTextBlock* ServerPing;
+
 	/**
 	 * @brief Variable indicating whether an object is selected or not.
 	 *
@@ -72,15 +91,50 @@ public:
 	bool Selected = false;
 
 	/**
-	 * \brief Setup function for the Server Row
-	 * \param InParent The parent menu
-	 * \param InIndex The index value
+	 * @brief Shows a server list item in a row that is not part of a list view.
+	 *
+	 * Used by UMainMenu to fill a ServerList panel. The row keeps its texts up to date while it shows the item.
+	 *
+	 * @param InParent The main menu whose server the row selects when clicked.
+	 * @param Item The server list item to show, or null to stop showing one.
+	 */
+	void ShowServerItem(class UMainMenu* InParent, class UServerListItem* Item);
+
+	/**
+	 * @brief Gets the server list item the row shows.
+	 *
+	 * @return The server list item, or null if the row shows none.
+	 */
+	UServerListItem* GetServerItem() const { return ServerItem.Get(); }
+
+protected:
+	/**
+	 * @brief Binds the RowButton's OnClicked event to UServerRow::OnClicked.
+	 */
+	virtual void NativeOnInitialized() override;
+
+	/**
+	 * @brief Called by the list view when the row is given a server to show.
+	 *
+	 * Fills in the texts from the UServerListItem and keeps them up to date while the row shows it.
+	 *
+	 * @param ListItemObject The UServerListItem to show.
+	 */
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
+	/**
+	 * @brief Called by the list view when the row's item is selected or deselected.
 	 *
-	 * This function sets up the Server Row with the given parameters. It assigns the InParent and InIndex values to
-	 * the corresponding member variables. It also binds the OnClicked event of the RowButton to the
-	 * UServerRow::OnClicked function.
+	 * @param bIsSelected Whether the row's item is now selected.
 	 */
-	void Setup(class UMainMenu* InParent, uint32 InIndex);
+	virtual void NativeOnItemSelectionChanged(bool bIsSelected) override;
+
+	/**
+	 * @brief Called by the list view when the row goes back into its pool of unused rows.
+	 *
+	 * Stops listening to the item the row was showing.
+	 */
+	virtual void NativeOnEntryReleased() override;
 
 private:
 	/**
@@ -93,35 +147,37 @@ private:
 	class UButton* RowButton;
 
 	/**
-	 * @brief Parent variable declaration.
-	 *
-	 * Parent is a pointer to the UMainMenu class, a representation of the main menu in the game.
-	 * It is declared as a UPROPERTY, indicating that it can be accessed and modified by the Unreal Engine's
-	 * reflection system.
-	 *
-	 * This variable is used to reference the parent main menu instance from submenus or other related classes,
-	 * providing a way to access and manipulate its properties and functions.
-	 *
-	 * @note Make sure the UMainMenu class has been properly defined and is accessible from the current scope.
+	 * @brief The server list item the row currently shows, or null while the row is in the list view's pool.
 	 */
-	UPROPERTY()
-	class UMainMenu* Parent;
+	TWeakObjectPtr<class UServerListItem> ServerItem;
 
 	/**
-	 * @brief Index variable
-	 *
-	 * This variable represents an unsigned 32-bit integer Index.
-	 * It can be used to store an index value or to keep track of an index value within a specific range.
+	 * @brief Handle of the row's subscription to ServerItem's OnChanged delegate.
+	 */
+	FDelegateHandle ServerItemChangedHandle;
+
+	/**
+	 * @brief The main menu that filled its ServerList panel with this row, or null for a list view entry.
+	 */
+	TWeakObjectPtr<class UMainMenu> Parent;
+
+	/**
+	 * @brief Starts showing the given item, and listening to it, instead of the previous one.
 	 *
-	 * @note Make sure to initialize the Index variable before using it to avoid undefined behavior.
+	 * @param Item The server list item to show, or null.
+	 */
+	void SetServerItem(UServerListItem* Item);
+
+	/**
+	 * @brief Fills in the row's texts from ServerItem.
 	 */
-	uint32 Index;
+	void RefreshTexts();
 
 	/**
 	 * @brief Function called when the server row is clicked.
 	 *
-	 * This function sets the selected index of the parent object to the current index.
-	 * The parent object is assumed to have a method called SetSelectedIndex with an integer parameter.
+	 * This function selects the row's server list item in the owning list view, or through the parent menu if the
+	 * row is part of a ServerList panel.
 	 */
 	UFUNCTION()
 	void OnClicked();
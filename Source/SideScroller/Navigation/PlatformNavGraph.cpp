@@ -0,0 +1,634 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PlatformNavGraph.h"
+
+#include "EngineUtils.h"
+#include "Algo/Reverse.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/PlayerStart.h"
+#include "SideScroller/Climbables/BaseClimbable.h"
+
+namespace PlatformNav
+{
+	/**
+	 * @brief The smallest Z of a floor's normal for it to be walkable, as for the character movement default.
+	 */
+	constexpr float WalkableFloorNormalZ = 0.71f;
+
+	/**
+	 * @brief The most traces made in one column, so a column through deep solid ground stays cheap.
+	 */
+	constexpr int32 MaxTracesPerColumn = 256;
+
+	/**
+	 * @struct FOpenEntry
+	 * @brief A platform waiting in the A* open list.
+	 */
+	struct FOpenEntry
+	{
+		float Priority = 0.f;
+		int32 Node = INDEX_NONE;
+
+		bool operator<(const FOpenEntry& Other) const { return this->Priority < Other.Priority; }
+	};
+
+	/**
+	 * @struct FOpenPlatform
+	 * @brief A platform that reached the previous column and may go on in the current one.
+	 */
+	struct FOpenPlatform
+	{
+		int32 Node = INDEX_NONE;
+		float LastZ = 0.f;
+	};
+}
+
+/**
+ * Gets the Z of the floor at the given X, interpolated between the ends.
+ *
+ * @param X The X to get the floor at. Clamped to the platform.
+ * @return The Z of the floor.
+ */
+float FPlatformNavNode::GetFloorZ(const float X) const
+{
+	if (this->MaxX <= this->MinX) return this->LeftZ;
+	return FMath::Lerp(this->LeftZ, this->RightZ, FMath::Clamp((X - this->MinX) / (this->MaxX - this->MinX), 0.f, 1.f));
+}
+
+/**
+ * Checks whether the agent can take the link: jumps have to be within its jump height and distance, ladders need
+ * climbing.
+ *
+ * @param Link The link to check.
+ * @return True if the agent can take it.
+ */
+bool FPlatformNavAgent::CanTake(const FPlatformNavLink& Link) const
+{
+	switch (Link.Type)
+	{
+	case EPlatformNavLinkType::Jump:
+		return Link.Height <= this->MaxJumpHeight && FMath::Abs(Link.ToX - Link.FromX) <= this->MaxJumpDistance;
+	case EPlatformNavLinkType::Ladder:
+		return this->bCanClimbLadders;
+	default:
+		return true;
+	}
+}
+
+/**
+ * Hashes the agent's abilities, rounded to 8 units so agents of the same kind share their cached paths.
+ *
+ * @return The hash.
+ */
+uint32 FPlatformNavAgent::GetProfileHash() const
+{
+	uint32 Hash = GetTypeHash(FMath::RoundToInt(this->MaxJumpHeight / 8.f));
+	Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(this->MaxJumpDistance / 8.f)));
+	return HashCombine(Hash, GetTypeHash(this->bCanClimbLadders));
+}
+
+/**
+ * Generates the graph from the static collision and the ladders of the world. The level's extent is the box around
+ * every static primitive that blocks pawns, and the plane it is played in is the one of its first player start.
+ *
+ * @param World The world to generate the graph for.
+ * @param InSettings How to generate it.
+ */
+void FPlatformNavGraph::Build(const UWorld* World, const FPlatformNavBuildSettings& InSettings)
+{
+	this->Reset();
+	this->Settings = InSettings;
+	if (World == nullptr) return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FBox Bounds(ForceInit);
+	TOptional<float> PlaneY;
+	TArray<AActor*> IgnoredActors;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (const APlayerStart* PlayerStart = Cast<APlayerStart>(Actor))
+		{
+			if (!PlaneY.IsSet()) PlaneY = PlayerStart->GetActorLocation().Y;
+			IgnoredActors.Add(Actor);
+			continue;
+		}
+		if (Actor->IsRootComponentMovable())
+		{
+			IgnoredActors.Add(Actor);
+			continue;
+		}
+
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [&Bounds](const UPrimitiveComponent* Primitive)
+		{
+			if (Primitive->IsCollisionEnabled() && Primitive->GetCollisionResponseToChannel(ECC_Pawn) == ECR_Block)
+			{
+				Bounds += Primitive->Bounds.GetBox();
+			}
+		});
+	}
+	if (!Bounds.IsValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FPlatformNavGraph::Build - %s has no static collision."), *World->GetMapName());
+		return;
+	}
+
+	const float LevelWidth = Bounds.Max.X - Bounds.Min.X;
+	const int32 MaxColumns = FMath::Max(this->Settings.MaxColumns, 1);
+	this->Settings.ColumnWidth = FMath::Max(this->Settings.ColumnWidth, LevelWidth / MaxColumns);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PlatformNavBuild), false);
+	QueryParams.AddIgnoredActors(IgnoredActors);
+	this->BuildPlaneY = PlaneY.Get(Bounds.GetCenter().Y);
+	const float Y = this->BuildPlaneY;
+
+	TArray<TArray<float>> ColumnFloors;
+	this->TraceColumnFloors(World, QueryParams, Bounds, Y, ColumnFloors);
+	this->BuildNodes(ColumnFloors, Bounds.Min.X);
+	this->BuildBuckets();
+
+	TArray<FPlatformNavLink> NewLinks;
+	this->BuildPlatformLinks(World, QueryParams, Y, NewLinks);
+	this->BuildLadderLinks(World, NewLinks);
+	this->SetLinks(MoveTemp(NewLinks));
+
+	UE_LOG(LogTemp, Display,
+		TEXT("FPlatformNavGraph::Build - %s: %i platforms, %i links from %i columns in %.1f ms."),
+		*World->GetMapName(), this->Nodes.Num(), this->Links.Num(), ColumnFloors.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0
+	);
+}
+
+/**
+ * Removes every platform and link.
+ */
+void FPlatformNavGraph::Reset()
+{
+	this->Nodes.Reset();
+	this->Links.Reset();
+	this->Buckets.Reset();
+}
+
+/**
+ * Finds the platform under a point among the platforms in the point's bucket.
+ *
+ * @param FeetLocation The point, usually the bottom of an agent's capsule.
+ * @return The index of the platform, or INDEX_NONE if there is no floor within MaxDropHeight under the point.
+ */
+int32 FPlatformNavGraph::FindNode(const FVector& FeetLocation) const
+{
+	if (this->Buckets.Num() == 0) return INDEX_NONE;
+
+	const int32 Bucket = FMath::FloorToInt((FeetLocation.X - this->BucketMinX) / this->BucketWidth);
+	if (!this->Buckets.IsValidIndex(Bucket)) return INDEX_NONE;
+
+	const float HalfColumn = this->Settings.ColumnWidth * 0.5f;
+	int32 BestNode = INDEX_NONE;
+	float BestZ = TNumericLimits<float>::Lowest();
+	for (const int32 NodeIndex : this->Buckets[Bucket])
+	{
+		const FPlatformNavNode& Node = this->Nodes[NodeIndex];
+		if (FeetLocation.X < Node.MinX - HalfColumn || FeetLocation.X > Node.MaxX + HalfColumn) continue;
+
+		const float FloorZ = Node.GetFloorZ(FeetLocation.X);
+		if (FloorZ > FeetLocation.Z + this->Settings.MaxStepHeight) continue;
+		if (FeetLocation.Z - FloorZ > this->Settings.MaxDropHeight || FloorZ <= BestZ) continue;
+
+		BestNode = NodeIndex;
+		BestZ = FloorZ;
+	}
+	return BestNode;
+}
+
+/**
+ * Finds the cheapest sequence of links with A*. Each platform is entered once, at the X its cheapest link arrives
+ * at; walking along a platform costs the distance walked, and the heuristic is the horizontal distance to the goal.
+ *
+ * @param StartNode The platform to start on.
+ * @param StartX Where on the start platform the agent is.
+ * @param GoalNode The platform to end on.
+ * @param GoalX Where on the goal platform the agent wants to go.
+ * @param Agent What the agent can do.
+ * @param OutLinks The indices of the links to take, in order. Empty if StartNode is GoalNode.
+ * @return False if the goal cannot be reached.
+ */
+bool FPlatformNavGraph::FindPath(
+	const int32 StartNode,
+	const float StartX,
+	const int32 GoalNode,
+	const float GoalX,
+	const FPlatformNavAgent& Agent,
+	TArray<int32>& OutLinks
+) const {
+	OutLinks.Reset();
+	if (!this->Nodes.IsValidIndex(StartNode) || !this->Nodes.IsValidIndex(GoalNode)) return false;
+	if (StartNode == GoalNode) return true;
+
+	const int32 NumNodes = this->Nodes.Num();
+	TArray<float> Costs;
+	TArray<float> ArrivalXs;
+	TArray<int32> ArrivalLinks;
+	TBitArray<> Closed(false, NumNodes);
+	Costs.Init(TNumericLimits<float>::Max(), NumNodes);
+	ArrivalXs.SetNumUninitialized(NumNodes);
+	ArrivalLinks.Init(INDEX_NONE, NumNodes);
+
+	TArray<PlatformNav::FOpenEntry> Open;
+	Costs[StartNode] = 0.f;
+	ArrivalXs[StartNode] = StartX;
+	Open.HeapPush({FMath::Abs(StartX - GoalX), StartNode});
+
+	while (Open.Num() > 0)
+	{
+		PlatformNav::FOpenEntry Entry;
+		Open.HeapPop(Entry);
+		if (Closed[Entry.Node]) continue;
+		Closed[Entry.Node] = true;
+		if (Entry.Node == GoalNode) break;
+
+		const FPlatformNavNode& Node = this->Nodes[Entry.Node];
+		for (int32 LinkIndex = Node.FirstLink; LinkIndex < Node.FirstLink + Node.NumLinks; ++LinkIndex)
+		{
+			const FPlatformNavLink& Link = this->Links[LinkIndex];
+			if (Closed[Link.ToNode] || !Agent.CanTake(Link)) continue;
+
+			const float Cost = Costs[Entry.Node] + FMath::Abs(ArrivalXs[Entry.Node] - Link.FromX) + Link.Cost;
+			if (Cost >= Costs[Link.ToNode]) continue;
+
+			Costs[Link.ToNode] = Cost;
+			ArrivalXs[Link.ToNode] = Link.ToX;
+			ArrivalLinks[Link.ToNode] = LinkIndex;
+			Open.HeapPush({Cost + FMath::Abs(Link.ToX - GoalX), Link.ToNode});
+		}
+	}
+
+	if (ArrivalLinks[GoalNode] == INDEX_NONE) return false;
+
+	for (int32 Node = GoalNode; Node != StartNode; Node = this->Links[ArrivalLinks[Node]].FromNode)
+	{
+		OutLinks.Add(ArrivalLinks[Node]);
+	}
+	Algo::Reverse(OutLinks);
+	return true;
+}
+
+/**
+ * Traces every column of the level from above its top down to its bottom. Each blocking hit on a walkable surface
+ * with room for an agent above it is a floor; the next trace starts just below it, so floors under floors are found
+ * too.
+ *
+ * @param World The world to trace.
+ * @param QueryParams The query parameters, ignoring movable actors.
+ * @param Bounds The box around the level's collision.
+ * @param PlaneY The Y of the plane the game is played in.
+ * @param OutColumnFloors The Z of every floor, top to bottom, for every column.
+ */
+void FPlatformNavGraph::TraceColumnFloors(
+	const UWorld* World,
+	const FCollisionQueryParams& QueryParams,
+	const FBox& Bounds,
+	const float PlaneY,
+	TArray<TArray<float>>& OutColumnFloors
+) const {
+	const float ColumnWidth = this->Settings.ColumnWidth;
+	const float AgentHeight = this->Settings.AgentHeight;
+	const int32 NumColumns = FMath::FloorToInt((Bounds.Max.X - Bounds.Min.X) / ColumnWidth) + 1;
+	const float TopZ = Bounds.Max.Z + AgentHeight;
+	const float BottomZ = Bounds.Min.Z - 1.f;
+	const FCollisionShape Headroom = FCollisionShape::MakeBox(
+		FVector(ColumnWidth * 0.25f, 1.f, AgentHeight * 0.5f - 1.f)
+	);
+
+	OutColumnFloors.SetNum(NumColumns);
+	for (int32 Column = 0; Column < NumColumns; ++Column)
+	{
+		const float X = Bounds.Min.X + Column * ColumnWidth;
+		float StartZ = TopZ;
+		for (int32 Trace = 0; Trace < PlatformNav::MaxTracesPerColumn && StartZ > BottomZ; ++Trace)
+		{
+			FHitResult Hit;
+			const FVector Start(X, PlaneY, StartZ);
+			if (!World->LineTraceSingleByChannel(Hit, Start, FVector(X, PlaneY, BottomZ), ECC_Pawn, QueryParams)) break;
+
+			if (Hit.bStartPenetrating)
+			{
+				StartZ -= this->Settings.MaxStepHeight;
+				continue;
+			}
+
+			const float FloorZ = Hit.ImpactPoint.Z;
+			const FVector HeadroomCenter(X, PlaneY, FloorZ + AgentHeight * 0.5f + 1.f);
+			if (
+				Hit.ImpactNormal.Z >= PlatformNav::WalkableFloorNormalZ &&
+				!World->OverlapBlockingTestByChannel(HeadroomCenter, FQuat::Identity, ECC_Pawn, Headroom, QueryParams)
+			) {
+				OutColumnFloors[Column].Add(FloorZ);
+			}
+			StartZ = FloorZ - 1.f;
+		}
+	}
+}
+
+/**
+ * Joins the floors of neighbouring columns into platforms. A floor continues the platform of the previous column
+ * whose last floor is closest to it, if that is within MaxStepHeight, and starts a new platform otherwise.
+ *
+ * @param ColumnFloors The floors of every column.
+ * @param MinX The X of the first column.
+ */
+void FPlatformNavGraph::BuildNodes(const TArray<TArray<float>>& ColumnFloors, const float MinX)
+{
+	TArray<PlatformNav::FOpenPlatform> OpenPlatforms;
+	TArray<PlatformNav::FOpenPlatform> NextOpenPlatforms;
+	for (int32 Column = 0; Column < ColumnFloors.Num(); ++Column)
+	{
+		const float X = MinX + Column * this->Settings.ColumnWidth;
+		NextOpenPlatforms.Reset();
+		for (const float FloorZ : ColumnFloors[Column])
+		{
+			int32 BestOpen = INDEX_NONE;
+			float BestStep = this->Settings.MaxStepHeight;
+			for (int32 OpenIndex = 0; OpenIndex < OpenPlatforms.Num(); ++OpenIndex)
+			{
+				const float Step = FMath::Abs(OpenPlatforms[OpenIndex].LastZ - FloorZ);
+				if (Step <= BestStep)
+				{
+					BestOpen = OpenIndex;
+					BestStep = Step;
+				}
+			}
+
+			if (BestOpen != INDEX_NONE)
+			{
+				const int32 NodeIndex = OpenPlatforms[BestOpen].Node;
+				this->Nodes[NodeIndex].MaxX = X;
+				this->Nodes[NodeIndex].RightZ = FloorZ;
+				NextOpenPlatforms.Add({NodeIndex, FloorZ});
+				OpenPlatforms.RemoveAtSwap(BestOpen);
+			}
+			else
+			{
+				FPlatformNavNode& Node = this->Nodes.AddDefaulted_GetRef();
+				Node.MinX = X;
+				Node.MaxX = X;
+				Node.LeftZ = FloorZ;
+				Node.RightZ = FloorZ;
+				NextOpenPlatforms.Add({this->Nodes.Num() - 1, FloorZ});
+			}
+		}
+		Swap(OpenPlatforms, NextOpenPlatforms);
+	}
+}
+
+/**
+ * Makes the links leaving both ends of every platform. Just past the end, the highest floor below is walked onto if
+ * it is within a step, and dropped onto otherwise; a drop short enough to jump gets a jump back up. Platforms that
+ * start further out are jumped to if they are within jump distance and height and the arc is clear.
+ *
+ * @param World The world to check jump arcs against.
+ * @param QueryParams The query parameters, ignoring movable actors.
+ * @param PlaneY The Y of the plane the game is played in.
+ * @param OutLinks The links, in no particular order.
+ */
+void FPlatformNavGraph::BuildPlatformLinks(
+	const UWorld* World,
+	const FCollisionQueryParams& QueryParams,
+	const float PlaneY,
+	TArray<FPlatformNavLink>& OutLinks
+) const {
+	const float ColumnWidth = this->Settings.ColumnWidth;
+	const float HalfColumn = ColumnWidth * 0.5f;
+
+	for (int32 SourceIndex = 0; SourceIndex < this->Nodes.Num(); ++SourceIndex)
+	{
+		const FPlatformNavNode& Source = this->Nodes[SourceIndex];
+		for (const float Direction : {-1.f, 1.f})
+		{
+			const float EdgeX = Direction > 0.f ? Source.MaxX : Source.MinX;
+			const float EdgeZ = Source.GetFloorZ(EdgeX);
+			const float PastEdgeX = EdgeX + Direction * ColumnWidth;
+
+			// the floor right past the edge: walked onto, dropped onto, and jumped back up from
+			int32 BelowIndex = INDEX_NONE;
+			float BelowZ = EdgeZ - this->Settings.MaxDropHeight;
+			for (int32 TargetIndex = 0; TargetIndex < this->Nodes.Num(); ++TargetIndex)
+			{
+				const FPlatformNavNode& Target = this->Nodes[TargetIndex];
+				if (TargetIndex == SourceIndex) continue;
+				if (PastEdgeX < Target.MinX - HalfColumn || PastEdgeX > Target.MaxX + HalfColumn) continue;
+
+				const float TargetZ = Target.GetFloorZ(PastEdgeX);
+				if (TargetZ <= EdgeZ + this->Settings.MaxStepHeight && TargetZ > BelowZ)
+				{
+					BelowIndex = TargetIndex;
+					BelowZ = TargetZ;
+				}
+			}
+
+			if (BelowIndex != INDEX_NONE)
+			{
+				const FPlatformNavNode& Below = this->Nodes[BelowIndex];
+				const float LandingX = FMath::Clamp(PastEdgeX, Below.MinX, Below.MaxX);
+				const float Height = BelowZ - EdgeZ;
+				FPlatformNavLink& Link = OutLinks.AddDefaulted_GetRef();
+				Link.FromNode = SourceIndex;
+				Link.ToNode = BelowIndex;
+				Link.FromX = EdgeX;
+				Link.ToX = LandingX;
+				Link.Height = Height;
+				if (Height >= -this->Settings.MaxStepHeight)
+				{
+					Link.Type = EPlatformNavLinkType::Walk;
+					Link.Cost = FMath::Abs(LandingX - EdgeX);
+				}
+				else
+				{
+					Link.Type = EPlatformNavLinkType::Drop;
+					Link.Cost = (FMath::Abs(LandingX - EdgeX) - Height * 0.5f) * this->Settings.DropCostMultiplier;
+
+					const FVector From(LandingX, PlaneY, BelowZ);
+					const float TakeOffX = EdgeX - Direction * FMath::Min(HalfColumn, Source.MaxX - Source.MinX);
+					const FVector To(TakeOffX, PlaneY, EdgeZ);
+					if (-Height <= this->Settings.MaxJumpHeight && this->IsJumpArcClear(World, QueryParams, From, To))
+					{
+						FPlatformNavLink& JumpLink = OutLinks.AddDefaulted_GetRef();
+						JumpLink.FromNode = BelowIndex;
+						JumpLink.ToNode = SourceIndex;
+						JumpLink.Type = EPlatformNavLinkType::Jump;
+						JumpLink.FromX = From.X;
+						JumpLink.ToX = To.X;
+						JumpLink.Height = -Height;
+						JumpLink.Cost = (FMath::Abs(To.X - From.X) - Height) * this->Settings.JumpCostMultiplier;
+					}
+				}
+			}
+
+			// platforms further out, across a gap
+			for (int32 TargetIndex = 0; TargetIndex < this->Nodes.Num(); ++TargetIndex)
+			{
+				const FPlatformNavNode& Target = this->Nodes[TargetIndex];
+				if (TargetIndex == SourceIndex || TargetIndex == BelowIndex) continue;
+
+				const float NearX = Direction > 0.f ? Target.MinX : Target.MaxX;
+				const float Gap = (NearX - EdgeX) * Direction;
+				if (Gap <= HalfColumn || Gap > this->Settings.MaxJumpDistance) continue;
+
+				const float LandingX = NearX + Direction * FMath::Min(HalfColumn, Target.MaxX - Target.MinX);
+				const float LandingZ = Target.GetFloorZ(LandingX);
+				const float Height = LandingZ - EdgeZ;
+				if (Height > this->Settings.MaxJumpHeight || Height < -this->Settings.MaxDropHeight) continue;
+
+				const FVector From(EdgeX, PlaneY, EdgeZ);
+				const FVector To(LandingX, PlaneY, LandingZ);
+				if (!this->IsJumpArcClear(World, QueryParams, From, To)) continue;
+
+				FPlatformNavLink& Link = OutLinks.AddDefaulted_GetRef();
+				Link.FromNode = SourceIndex;
+				Link.ToNode = TargetIndex;
+				Link.Type = EPlatformNavLinkType::Jump;
+				Link.FromX = EdgeX;
+				Link.ToX = LandingX;
+				Link.Height = Height;
+				Link.Cost = (FMath::Abs(LandingX - EdgeX) + FMath::Abs(Height)) * this->Settings.JumpCostMultiplier;
+			}
+		}
+	}
+}
+
+/**
+ * Makes a link in each direction along every ladder, between the platform at its foot and the highest platform
+ * near its top.
+ *
+ * @param World The world to find the ladders in.
+ * @param OutLinks The links, in no particular order.
+ */
+void FPlatformNavGraph::BuildLadderLinks(const UWorld* World, TArray<FPlatformNavLink>& OutLinks) const
+{
+	for (TActorIterator<ABaseClimbable> It(World); It; ++It)
+	{
+		const UBoxComponent* ClimbableBox = It->GetClimbableBox();
+		if (ClimbableBox == nullptr) continue;
+
+		const FBox Box = ClimbableBox->Bounds.GetBox();
+		const float X = Box.GetCenter().X;
+		const int32 BottomNode = this->FindNode(FVector(X, 0.f, Box.Min.Z + this->Settings.MaxStepHeight));
+		if (BottomNode == INDEX_NONE) continue;
+
+		const float BottomZ = this->Nodes[BottomNode].GetFloorZ(X);
+		int32 TopNode = INDEX_NONE;
+		float TopX = X;
+		for (const float Offset : {0.f, -2.f, 2.f})
+		{
+			TopX = X + Offset * this->Settings.ColumnWidth;
+			TopNode = this->FindNode(FVector(TopX, 0.f, Box.Max.Z + this->Settings.MaxStepHeight));
+			if (TopNode != INDEX_NONE && TopNode != BottomNode) break;
+			TopNode = INDEX_NONE;
+		}
+		if (TopNode == INDEX_NONE) continue;
+
+		const float TopZ = this->Nodes[TopNode].GetFloorZ(TopX);
+		if (TopZ - BottomZ <= this->Settings.MaxStepHeight) continue;
+
+		for (const bool bUp : {true, false})
+		{
+			FPlatformNavLink& Link = OutLinks.AddDefaulted_GetRef();
+			Link.FromNode = bUp ? BottomNode : TopNode;
+			Link.ToNode = bUp ? TopNode : BottomNode;
+			Link.Type = EPlatformNavLinkType::Ladder;
+			Link.FromX = bUp ? X : TopX;
+			Link.ToX = bUp ? TopX : X;
+			Link.Height = bUp ? TopZ - BottomZ : BottomZ - TopZ;
+			Link.Cost = (TopZ - BottomZ) * this->Settings.LadderCostMultiplier;
+		}
+	}
+}
+
+/**
+ * Checks the approximated arc of a jump: up from the take-off point to an agent's height above the higher floor,
+ * across, and down to the landing point.
+ *
+ * @param World The world to trace.
+ * @param QueryParams The query parameters, ignoring movable actors.
+ * @param From The floor the jump starts on.
+ * @param To The floor the jump lands on.
+ * @return True if the way is clear.
+ */
+bool FPlatformNavGraph::IsJumpArcClear(
+	const UWorld* World,
+	const FCollisionQueryParams& QueryParams,
+	const FVector& From,
+	const FVector& To
+) const {
+	const float Lift = this->Settings.AgentHeight * 0.5f;
+	const float ApexZ = FMath::Max(From.Z, To.Z) + this->Settings.AgentHeight;
+	const FVector Points[] = {
+		FVector(From.X, From.Y, From.Z + Lift),
+		FVector(From.X, From.Y, ApexZ),
+		FVector(To.X, To.Y, ApexZ),
+		FVector(To.X, To.Y, To.Z + Lift),
+	};
+
+	for (int32 Index = 1; Index < UE_ARRAY_COUNT(Points); ++Index)
+	{
+		if (World->LineTraceTestByChannel(Points[Index - 1], Points[Index], ECC_Pawn, QueryParams)) return false;
+	}
+	return true;
+}
+
+/**
+ * Sorts the links by the platform they leave from and fills in each platform's link range.
+ *
+ * @param NewLinks The links, in no particular order.
+ */
+void FPlatformNavGraph::SetLinks(TArray<FPlatformNavLink>&& NewLinks)
+{
+	this->Links = MoveTemp(NewLinks);
+	this->Links.StableSort([](const FPlatformNavLink& A, const FPlatformNavLink& B)
+	{
+		return A.FromNode < B.FromNode;
+	});
+
+	for (FPlatformNavNode& Node : this->Nodes)
+	{
+		Node.FirstLink = 0;
+		Node.NumLinks = 0;
+	}
+	for (int32 LinkIndex = this->Links.Num() - 1; LinkIndex >= 0; --LinkIndex)
+	{
+		FPlatformNavNode& Node = this->Nodes[this->Links[LinkIndex].FromNode];
+		Node.FirstLink = LinkIndex;
+		++Node.NumLinks;
+	}
+}
+
+/**
+ * Adds every platform to the buckets of every BucketWidth of X it spans, including the half column past each end
+ * that FindNode accepts.
+ */
+void FPlatformNavGraph::BuildBuckets()
+{
+	this->Buckets.Reset();
+	if (this->Nodes.Num() == 0) return;
+
+	const float HalfColumn = this->Settings.ColumnWidth * 0.5f;
+	float MaxX = TNumericLimits<float>::Lowest();
+	for (const FPlatformNavNode& Node : this->Nodes)
+	{
+		MaxX = FMath::Max(MaxX, Node.MaxX);
+	}
+
+	this->BucketMinX = this->Nodes[0].MinX - HalfColumn;
+	this->Buckets.SetNum(FMath::FloorToInt((MaxX + HalfColumn - this->BucketMinX) / this->BucketWidth) + 1);
+	for (int32 NodeIndex = 0; NodeIndex < this->Nodes.Num(); ++NodeIndex)
+	{
+		const FPlatformNavNode& Node = this->Nodes[NodeIndex];
+		const int32 FirstBucket = FMath::FloorToInt((Node.MinX - HalfColumn - this->BucketMinX) / this->BucketWidth);
+		const int32 LastBucket = FMath::FloorToInt((Node.MaxX + HalfColumn - this->BucketMinX) / this->BucketWidth);
+		for (int32 Bucket = FMath::Max(FirstBucket, 0); Bucket <= LastBucket && Bucket < this->Buckets.Num(); ++Bucket)
+		{
+			this->Buckets[Bucket].Add(NodeIndex);
+		}
+	}
+}
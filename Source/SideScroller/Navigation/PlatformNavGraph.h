@@ -0,0 +1,368 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCollisionQueryParams;
+
+/**
+ * @brief How an agent gets from one platform to another.
+ */
+enum class EPlatformNavLinkType : uint8
+{
+	/** Walks across a step between two platforms that touch. */
+	Walk,
+	/** Jumps from the take-off point and lands on the other platform. */
+	Jump,
+	/** Walks off the edge and falls onto a lower platform. */
+	Drop,
+	/** Climbs a ladder up or down. */
+	Ladder,
+};
+
+/**
+ * @struct FPlatformNavNode
+ * @brief A platform: a stretch of floor an agent can walk along without jumping, climbing or falling.
+ *
+ * The floor may slope or step up and down by less than the build's MaxStepHeight.
+ */
+struct FPlatformNavNode
+{
+	/**
+	 * @brief The X of the left and the right end of the platform.
+	 */
+	float MinX = 0.f;
+	float MaxX = 0.f;
+
+	/**
+	 * @brief The Z of the floor at the left and the right end of the platform.
+	 */
+	float LeftZ = 0.f;
+	float RightZ = 0.f;
+
+	/**
+	 * @brief The range of the links leaving this platform in FPlatformNavGraph::GetLinks.
+	 */
+	int32 FirstLink = 0;
+	int32 NumLinks = 0;
+
+	/**
+	 * @brief Gets the Z of the floor at the given X, interpolated between the ends.
+	 *
+	 * @param X The X to get the floor at. Clamped to the platform.
+	 * @return The Z of the floor.
+	 */
+	float GetFloorZ(float X) const;
+};
+
+/**
+ * @struct FPlatformNavLink
+ * @brief A one-way connection from one platform to another.
+ */
+struct FPlatformNavLink
+{
+	/**
+	 * @brief The indices of the platform the link leaves from and the platform it arrives at.
+	 */
+	int32 FromNode = INDEX_NONE;
+	int32 ToNode = INDEX_NONE;
+
+	/**
+	 * @brief How the link is traversed.
+	 */
+	EPlatformNavLinkType Type = EPlatformNavLinkType::Walk;
+
+	/**
+	 * @brief The X an agent has to reach on FromNode to take the link, and the X it arrives at on ToNode.
+	 */
+	float FromX = 0.f;
+	float ToX = 0.f;
+
+	/**
+	 * @brief The height gained by the link; negative for links that go down.
+	 */
+	float Height = 0.f;
+
+	/**
+	 * @brief What taking the link costs, in units of walking distance.
+	 */
+	float Cost = 0.f;
+};
+
+/**
+ * @struct FPlatformNavBuildSettings
+ * @brief How the platform graph is generated from the level's collision.
+ */
+struct FPlatformNavBuildSettings
+{
+	/**
+	 * @brief The distance between the columns the level is sampled in.
+	 */
+	float ColumnWidth = 16.f;
+
+	/**
+	 * @brief The height of the free space an agent needs to stand on a floor.
+	 */
+	float AgentHeight = 32.f;
+
+	/**
+	 * @brief The largest height difference between neighbouring columns that is walked rather than jumped.
+	 */
+	float MaxStepHeight = 12.f;
+
+	/**
+	 * @brief The highest and farthest jump links are made for. Agents that jump less skip the larger ones.
+	 */
+	float MaxJumpHeight = 128.f;
+	float MaxJumpDistance = 256.f;
+
+	/**
+	 * @brief The deepest fall drop and downward jump links are made for.
+	 */
+	float MaxDropHeight = 1024.f;
+
+	/**
+	 * @brief The extra cost of a jump, a drop and a ladder link over walking the same distance.
+	 */
+	float JumpCostMultiplier = 1.5f;
+	float DropCostMultiplier = 1.2f;
+	float LadderCostMultiplier = 2.f;
+
+	/**
+	 * @brief The most columns the level is split into. The columns are widened for levels that would need more.
+	 */
+	int32 MaxColumns = 8192;
+};
+
+/**
+ * @struct FPlatformNavAgent
+ * @brief What an agent following a platform path can do.
+ */
+struct FPlatformNavAgent
+{
+	/**
+	 * @brief The highest and farthest the agent can jump. Jump links beyond either are skipped.
+	 */
+	float MaxJumpHeight = 0.f;
+	float MaxJumpDistance = 0.f;
+
+	/**
+	 * @brief Whether the agent can take ladder links.
+	 */
+	bool bCanClimbLadders = false;
+
+	/**
+	 * @brief Checks whether the agent can take the link.
+	 *
+	 * @param Link The link to check.
+	 * @return True if the agent can take it.
+	 */
+	bool CanTake(const FPlatformNavLink& Link) const;
+
+	/**
+	 * @brief Hashes the agent's abilities, rounded so agents of the same kind share their cached paths.
+	 *
+	 * @return The hash.
+	 */
+	uint32 GetProfileHash() const;
+};
+
+/**
+ * @class FPlatformNavGraph
+ * @brief A 2D navigation graph of a side-scrolling level: its platforms and the walk, jump, drop and ladder links
+ * between them.
+ *
+ * The graph is generated from the level's static collision, in the X-Z plane the game is played in. The level is
+ * cut into columns; in each column, traces from the top of the level down find every floor an agent can stand on.
+ * Floors in neighbouring columns that are less than MaxStepHeight apart become one platform. Links are then made
+ * from the ends of every platform to the platforms that can be reached from them, checking the arc of each jump
+ * against the level's collision, and along every ladder.
+ *
+ * Agents path from platform to platform, so a search only visits a few hundred nodes even on long levels, and a
+ * path stays valid for as long as neither end changes platform.
+ */
+class SIDESCROLLER_API FPlatformNavGraph
+{
+public:
+	/**
+	 * @brief Generates the graph from the static collision and the ladders of the world, replacing the old one.
+	 *
+	 * Movable actors, such as characters and moving platforms, are ignored.
+	 *
+	 * @param World The world to generate the graph for.
+	 * @param Settings How to generate it.
+	 */
+	void Build(const UWorld* World, const FPlatformNavBuildSettings& Settings);
+
+	/**
+	 * @brief Removes every platform and link.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Finds the platform under a point: the highest one at the point's X whose floor is not above it.
+	 *
+	 * @param FeetLocation The point, usually the bottom of an agent's capsule.
+	 * @return The index of the platform, or INDEX_NONE if there is no floor within MaxDropHeight under the point.
+	 */
+	int32 FindNode(const FVector& FeetLocation) const;
+
+	/**
+	 * @brief Finds the cheapest sequence of links from one platform to another with A*.
+	 *
+	 * @param StartNode The platform to start on.
+	 * @param StartX Where on the start platform the agent is.
+	 * @param GoalNode The platform to end on.
+	 * @param GoalX Where on the goal platform the agent wants to go.
+	 * @param Agent What the agent can do.
+	 * @param OutLinks The indices of the links to take, in order. Empty if StartNode is GoalNode.
+	 * @return False if the goal cannot be reached.
+	 */
+	bool FindPath(
+		int32 StartNode,
+		float StartX,
+		int32 GoalNode,
+		float GoalX,
+		const FPlatformNavAgent& Agent,
+		TArray<int32>& OutLinks
+	) const;
+
+	/**
+	 * @brief Gets the platforms.
+	 *
+	 * @return The platforms, ordered by their left end.
+	 */
+	const TArray<FPlatformNavNode>& GetNodes() const { return this->Nodes; }
+
+	/**
+	 * @brief Gets the links.
+	 *
+	 * @return The links, grouped by the platform they leave from.
+	 */
+	const TArray<FPlatformNavLink>& GetLinks() const { return this->Links; }
+
+	/**
+	 * @brief Checks whether the graph has any platforms.
+	 *
+	 * @return True if it has.
+	 */
+	bool IsEmpty() const { return this->Nodes.Num() == 0; }
+
+	/**
+	 * @brief Gets the Y of the plane the graph was generated in.
+	 *
+	 * @return The Y of the plane.
+	 */
+	float GetPlaneY() const { return this->BuildPlaneY; }
+
+private:
+	/**
+	 * @brief Traces every column of the level for the floors an agent can stand on.
+	 *
+	 * @param World The world to trace.
+	 * @param QueryParams The query parameters, ignoring movable actors.
+	 * @param Bounds The box around the level's collision.
+	 * @param PlaneY The Y of the plane the game is played in.
+	 * @param OutColumnFloors The Z of every floor, top to bottom, for every column.
+	 */
+	void TraceColumnFloors(
+		const UWorld* World,
+		const FCollisionQueryParams& QueryParams,
+		const FBox& Bounds,
+		float PlaneY,
+		TArray<TArray<float>>& OutColumnFloors
+	) const;
+
+	/**
+	 * @brief Joins the floors of neighbouring columns into platforms.
+	 *
+	 * @param ColumnFloors The floors of every column.
+	 * @param MinX The X of the first column.
+	 */
+	void BuildNodes(const TArray<TArray<float>>& ColumnFloors, float MinX);
+
+	/**
+	 * @brief Makes the walk, drop and jump links leaving every platform.
+	 *
+	 * @param World The world to check jump arcs against.
+	 * @param QueryParams The query parameters, ignoring movable actors.
+	 * @param PlaneY The Y of the plane the game is played in.
+	 * @param OutLinks The links, in no particular order.
+	 */
+	void BuildPlatformLinks(
+		const UWorld* World,
+		const FCollisionQueryParams& QueryParams,
+		float PlaneY,
+		TArray<FPlatformNavLink>& OutLinks
+	) const;
+
+	/**
+	 * @brief Makes a link in each direction along every ladder that connects two platforms.
+	 *
+	 * @param World The world to find the ladders in.
+	 * @param OutLinks The links, in no particular order.
+	 */
+	void BuildLadderLinks(const UWorld* World, TArray<FPlatformNavLink>& OutLinks) const;
+
+	/**
+	 * @brief Checks that an agent jumping from one point to another does not hit the level on the way.
+	 *
+	 * The arc is approximated by going straight up to above the higher point, across, and down.
+	 *
+	 * @param World The world to trace.
+	 * @param QueryParams The query parameters, ignoring movable actors.
+	 * @param From The floor the jump starts on.
+	 * @param To The floor the jump lands on.
+	 * @return True if the way is clear.
+	 */
+	bool IsJumpArcClear(
+		const UWorld* World,
+		const FCollisionQueryParams& QueryParams,
+		const FVector& From,
+		const FVector& To
+	) const;
+
+	/**
+	 * @brief Sorts the links by the platform they leave from and fills in each platform's link range.
+	 *
+	 * @param NewLinks The links, in no particular order.
+	 */
+	void SetLinks(TArray<FPlatformNavLink>&& NewLinks);
+
+	/**
+	 * @brief Adds the platforms to the buckets of every BucketWidth of X they span.
+	 */
+	void BuildBuckets();
+
+	/**
+	 * @brief The settings the graph was generated with.
+	 */
+	FPlatformNavBuildSettings Settings;
+
+	/**
+	 * @brief The platforms, ordered by their left end.
+	 */
+	TArray<FPlatformNavNode> Nodes;
+
+	/**
+	 * @brief The links, grouped by the platform they leave from.
+	 */
+	TArray<FPlatformNavLink> Links;
+
+	/**
+	 * @brief The platforms overlapping each BucketWidth wide slice of the level, so FindNode only checks a few.
+	 */
+	TArray<TArray<int32>> Buckets;
+
+	/**
+	 * @brief The X the first bucket starts at, and the width of every bucket.
+	 */
+	/**
+	 * @brief The Y of the plane the graph was generated in.
+	 */
+	float BuildPlaneY = 0.f;
+
+	float BucketMinX = 0.f;
+	float BucketWidth = 512.f;
+};
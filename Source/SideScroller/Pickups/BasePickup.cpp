@@ -3,12 +3,13 @@
 
 #include "BasePickup.h"
 
-#include "Sidescroller/Characters/BasePaperCharacter.h"
+#include "SideScroller/Characters/BasePaperCharacter.h"
 #include "PaperFlipbookComponent.h"
-#include "Sidescroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "Engine/DamageEvents.h"
-#include "Sidescroller/Interfaces/PickupInterface.h"
-#include "Kismet/GameplayStatics.h"
+#include "SideScroller/Interfaces/PickupInterface.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
 /**
  * ABasePickup constructor.
@@ -51,6 +52,11 @@ void ABasePickup::BeginPlay()
 	this->PickupBox->OnComponentBeginOverlap.AddDynamic(this, &ABasePickup::OnBeginOverlapDelegate);
 	
 	PickupFlipbook->SetFlipbook(IdleAnimation);
+
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->RegisterActor(this);
+	}
 }
 
 /**
@@ -104,10 +110,11 @@ void ABasePickup::OnBeginOverlapDelegate(
 	APC_PlayerFox* OverlappingActor = dynamic_cast<APC_PlayerFox*>(OtherComp->GetOwner());
 	if (OverlappingActor == nullptr) return;
 
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->PickupSound,
 		OverlappedComponent,
-		TEXT("BasePickupSound")
+		EAudioEventCategory::Pickup
 	);
 
 	// dont allow this pickup to be taken more than once
@@ -139,7 +146,27 @@ void ABasePickup::OnBeginOverlapDelegate(
  */
 void ABasePickup::DestroyActor()
 {
+	GetWorld()->GetTimerManager().ClearTimer(this->ItemTakenTimerHandle);
+
+	// keep the pickup around so the level can be reset in place
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>();
+		LevelReset != nullptr && LevelReset->ReleaseToPool(this)
+	) {
+		UE_LOG(LogTemp, Verbose, TEXT("Pooling %s!"), *this->GetName());
+		return;
+	}
+
 	UE_LOG(LogTemp, Verbose, TEXT("Destroying %s!"), *this->GetName());
 	this->Destroy();
-	GetWorld()->GetTimerManager().ClearTimer(this->ItemTakenTimerHandle);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Makes the pickup available again after it was taken.
+ */
+void ABasePickup::ResetToInitialState()
+{
+	if (!PickupFlipbook) return;
+
+	PickupFlipbook->SetFlipbook(IdleAnimation);
+	this->PickupBox->SetGenerateOverlapEvents(true);
+}
@@ -7,6 +7,7 @@
 #include "PaperFlipbook.h"
 #include "Components/BoxComponent.h"
 #include "GameFramework/Actor.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
 #include "BasePickup.generated.h"
 
 /**
@@ -23,7 +24,7 @@
  *
  */
 UCLASS()
-class SIDESCROLLER_API ABasePickup : public AActor
+class SIDESCROLLER_API ABasePickup : public AActor, public IResettableInterface
 {
 	GENERATED_BODY()
 	
@@ -98,11 +99,19 @@ public:
 	 * @brief Destroys the actor and clears the timer handle.
 	 *
 	 * This function destroys the actor by calling the Destroy() method and clears the timer handle used to
-	 * track item taken events.
+	 * track item taken events. If the pickup is registered with the ULevelResetSubsystem it is released to its pool
+	 * instead, so it can be put back when the level is reset.
 	 */
 	UFUNCTION(BlueprintCallable)
 	virtual void DestroyActor();
 
+	/**
+	 * @brief Makes the pickup available again when the level is reset in place.
+	 *
+	 * Switches back to the idle animation and turns the pickup box's overlap events back on.
+	 */
+	virtual void ResetToInitialState() override;
+
 private:
 	/**
 	 * @brief A class member variable that represents a UPaperFlipbookComponent used for displaying a pickup object.
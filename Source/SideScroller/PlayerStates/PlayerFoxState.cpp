@@ -3,6 +3,8 @@
 
 #include "PlayerFoxState.h"
 
+#include "Net/UnrealNetwork.h"
+
 /**
  * @brief Get the value of bHasChosenCharacter.
  *
@@ -21,5 +23,51 @@ bool APlayerFoxState::GetHasChosenCharacter() const
  */
 void APlayerFoxState::SetHasChosenCharacter(const bool HasChosenChar)
 {
+	if (this->bHasChosenCharacter == HasChosenChar) return;
+
 	this->bHasChosenCharacter = HasChosenChar;
+	OnChosenCharacterChanged.Broadcast(this);
+}
+
+/**
+ * Gets the roster color of the character the player picked.
+ *
+ * @return The color, or an empty string if the player has not picked a character.
+ */
+const FString& APlayerFoxState::GetChosenCharacterColor() const
+{
+	return this->ChosenCharacterColor;
+}
+
+/**
+ * Sets the roster color of the character the player picked.
+ *
+ * @param Color The color of the picked character.
+ */
+void APlayerFoxState::SetChosenCharacterColor(const FString& Color)
+{
+	if (this->ChosenCharacterColor == Color) return;
+
+	this->ChosenCharacterColor = Color;
+	OnChosenCharacterChanged.Broadcast(this);
+}
+
+/**
+ * Notifies listeners on clients that the player's character selection changed.
+ */
+void APlayerFoxState::OnRep_ChosenCharacter()
+{
+	OnChosenCharacterChanged.Broadcast(this);
+}
+
+/**
+ * Registers the character selection for replication.
+ *
+ * @param OutLifetimeProps The replicated properties of the player state.
+ */
+void APlayerFoxState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(APlayerFoxState, bHasChosenCharacter);
+	DOREPLIFETIME(APlayerFoxState, ChosenCharacterColor);
 }
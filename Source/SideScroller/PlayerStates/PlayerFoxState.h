@@ -6,10 +6,22 @@
 #include "GameFramework/PlayerState.h"
 #include "PlayerFoxState.generated.h"
 
+class APlayerFoxState;
+
+/**
+ * @brief Broadcast on the server and on every client when a player's character selection changed.
+ *
+ * @param PlayerFoxState The player state whose selection changed.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnChosenCharacterChanged, APlayerFoxState* /*PlayerFoxState*/);
+
 /**
  * @class APlayerFoxState
  *
  * @brief A subclass of APlayerState representing the state of a player character.
+ *
+ * Replicates which roster character the player picked and whether they have picked one. A player that has chosen a
+ * character is ready to start; the lobby game mode starts its countdown once every player is.
  */
 UCLASS()
 class SIDESCROLLER_API APlayerFoxState : public APlayerState
@@ -28,13 +40,41 @@ public:
 	/**
 	 * Sets whether the player has chosen a character.
 	 *
-	 * This function is used to set the value of the variable bHasChosenCharacter.
+	 * This function is used to set the value of the variable bHasChosenCharacter. Server only; the value
+	 * replicates to every client.
 	 *
 	 * @param HasChosenChar A boolean value indicating whether the player has chosen a character.
 	 */
 	UFUNCTION(BlueprintCallable)
 	void SetHasChosenCharacter(bool HasChosenChar);
 
+	/**
+	 * @brief Gets the roster color of the character the player picked.
+	 *
+	 * @return The color, or an empty string if the player has not picked a character.
+	 */
+	UFUNCTION(BlueprintCallable)
+	const FString& GetChosenCharacterColor() const;
+
+	/**
+	 * @brief Sets the roster color of the character the player picked. Server only.
+	 *
+	 * @param Color The color of the picked character.
+	 */
+	void SetChosenCharacterColor(const FString& Color);
+
+	/**
+	 * @brief Broadcast whenever bHasChosenCharacter or ChosenCharacterColor changed.
+	 */
+	FOnChosenCharacterChanged OnChosenCharacterChanged;
+
+	/**
+	 * @brief Registers the character selection for replication.
+	 *
+	 * @param OutLifetimeProps The replicated properties of the player state.
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 private:
 	/**
 	 * @brief A flag indicating whether a character has been selected.
@@ -42,6 +82,18 @@ private:
 	 * This flag is used to track whether a character has been chosen by the player. If the flag is set to true,
 	 * it means that a character has been selected. By default, the value of this flag is false.
 	 */
-	UPROPERTY()
+	UPROPERTY(ReplicatedUsing=OnRep_ChosenCharacter)
 	bool bHasChosenCharacter = false;
+
+	/**
+	 * @brief The roster color of the character the player picked, or empty.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_ChosenCharacter)
+	FString ChosenCharacterColor;
+
+	/**
+	 * @brief Called on clients when the character selection is replicated. Broadcasts OnChosenCharacterChanged.
+	 */
+	UFUNCTION()
+	void OnRep_ChosenCharacter();
 };
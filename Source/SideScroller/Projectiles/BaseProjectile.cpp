@@ -7,9 +7,9 @@
 #include "Components/CapsuleComponent.h"
 #include "Engine/DamageEvents.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "SideScroller/Characters/BasePaperCharacter.h"
 #include "SideScroller/Interfaces/ProjectileInterface.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
 
 /**
  * Initializes the ABaseProjectile instance.
@@ -36,6 +36,10 @@ ABaseProjectile::ABaseProjectile()
 	SetRootComponent(ProjectileFlipbook);
 	
 	this->bReplicates = true;
+	// Projectiles are fast and short lived, so they never back off far.
+	this->NetUpdateFrequency = 60.f;
+	this->MinNetUpdateFrequency = 30.f;
+	this->NetPriority = 2.5f;
     ProjectileFlipbook->SetIsReplicated(true);
     ProjectileBox->SetIsReplicated(true);
     ProjectileMovementComp->SetIsReplicated(true);
@@ -54,6 +58,11 @@ void ABaseProjectile::BeginPlay()
 
 	ProjectileMovementComp->InitialSpeed = MovementSpeed;
 	ProjectileMovementComp->MaxSpeed = MovementSpeed;
+
+	if (Cast<ABasePaperCharacter>(GetOwner()) != nullptr)
+	{
+		PlayProjectileSpawnSound();
+	}
 }
 
 /**
@@ -91,12 +100,13 @@ UPaperFlipbookComponent* ABaseProjectile::GetProjectileFlipbook() const
 /**
  * Plays the sound effect when the projectile is spawned.
  */
-void ABaseProjectile::PlayProjectileSpawnSound_Implementation()
+void ABaseProjectile::PlayProjectileSpawnSound()
 {
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->LaunchSound,
 		this->ProjectileFlipbook,
-		TEXT("ProjectileLaunch")
+		EAudioEventCategory::Projectile
 	);
 }
 
@@ -115,8 +125,6 @@ void ABaseProjectile::PlayProjectileSpawnSound_Implementation()
  *
  * The lifespan of the projectile will be set to the value specified by the ProjectileInLifespan property.
  *
- * The LaunchSound will be played and attached to the ProjectileFlipbook, with the tag "ProjectileLaunch".
- *
  * A verbose log message will be outputted indicating the name of the projectile and its owner.
  */
 void ABaseProjectile::LaunchProjectile(const float Direction)
@@ -138,8 +146,6 @@ void ABaseProjectile::LaunchProjectile(const float Direction)
 	const ABasePaperCharacter* BaseChar = dynamic_cast<ABasePaperCharacter*>(MyOwner);
 	if (BaseChar == nullptr) return;
 
-	PlayProjectileSpawnSound();
-	
 	this->SetLifeSpan(ProjectileInLifespan);
 
 	if (MyOwner->GetClass()->ImplementsInterface(UProjectileInterface::StaticClass()))
@@ -228,7 +234,7 @@ void ABaseProjectile::DoCollisionAnimAndSound(const AActor* MyOwner, ABasePaperC
 		false
 	);
 		
-	UGameplayStatics::PlaySoundAtLocation(this, HitSound, GetActorLocation());
+	UAudioPoolSubsystem::PlayAtLocation(this, HitSound, GetActorLocation(), EAudioEventCategory::Projectile);
 	OtherBasePaperActor->TakeDamage(
 		Damage,
 		FDamageEvent(UDamageType::StaticClass()),
@@ -85,11 +85,10 @@ public:
 	/**
 	 * Plays the sound effect for when a projectile is spawned.
 	 *
-	 * This method is declared as a UFUNCTION to be accessible in Blueprint graphs.
-	 * It is also declared as NetMulticast and Reliable to ensure that the sound effect is played on
-	 * all clients reliably.
+	 * Called from BeginPlay on every machine the projectile replicates to, so the spawn of the replicated projectile
+	 * is the cue and no RPC is needed.
 	 */
-	UFUNCTION(Blueprintable, NetMulticast, Reliable)
+	UFUNCTION(BlueprintCallable)
 	void PlayProjectileSpawnSound();
 
 private:
@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "InputRecording.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/**
+	 * @brief Tag written at the start of every input recording ('SSIR').
+	 */
+	constexpr uint32 InputRecordingFileMagic = 0x53534952;
+}
+
+/**
+ * Serializes the frame: its time step, both axes and the button bits.
+ *
+ * @param Ar The archive to read from or write to.
+ */
+void FRecordedInputFrame::Serialize(FArchive& Ar)
+{
+	Ar << DeltaSeconds;
+	Ar << MoveRight;
+	Ar << ClimbUp;
+	Ar << Buttons;
+}
+
+/**
+ * Serializes the recording in the layout of the given version.
+ *
+ * @param Ar The archive to read from or write to.
+ * @param Version The layout version of the data in Ar.
+ */
+void FInputRecording::Serialize(FArchive& Ar, uint16 Version)
+{
+	Ar << MapName;
+	Ar << RandomSeed;
+	Ar << EndStateChecksum;
+
+	int32 NumFrames = Frames.Num();
+	Ar << NumFrames;
+	if (Ar.IsLoading())
+	{
+		if (NumFrames < 0 || NumFrames > Ar.TotalSize())
+		{
+			Ar.SetError();
+			return;
+		}
+		Frames.SetNum(NumFrames);
+	}
+	for (FRecordedInputFrame& Frame : Frames)
+	{
+		Frame.Serialize(Ar);
+	}
+}
+
+/**
+ * Gets the path of a recording, in <Saved>/InputRecordings unless a path was given.
+ *
+ * @param Name The name of the recording, or a path to it.
+ * @return The absolute path of the recording.
+ */
+FString FInputRecordingFile::GetFilePath(const FString& Name)
+{
+	if (!FPaths::IsRelative(Name)) return Name;
+
+	const FString FileName = FPaths::GetExtension(Name).IsEmpty() ? Name + TEXT(".bin") : Name;
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("InputRecordings") / FileName);
+}
+
+/**
+ * Writes the magic tag, the layout version and the recording to a file.
+ *
+ * @param Recording The recording to write.
+ * @param FilePath The path of the file.
+ * @return True if the recording ended up on disk.
+ */
+bool FInputRecordingFile::Save(const FInputRecording& Recording, const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = InputRecordingFileMagic;
+	uint16 Version = CurrentVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	FInputRecording RecordingCopy = Recording;
+	RecordingCopy.Serialize(Writer, Version);
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FInputRecordingFile::Save - Could not write %s."), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Reads a recording from a file, rejecting foreign, newer or truncated data.
+ *
+ * @param FilePath The path of the file.
+ * @param OutRecording The recording read from the file.
+ * @return True if a recording was read.
+ */
+bool FInputRecordingFile::Load(const FString& FilePath, FInputRecording& OutRecording)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FInputRecordingFile::Load - Could not read %s."), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+
+	if (Reader.IsError() || Magic != InputRecordingFileMagic)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FInputRecordingFile::Load - %s is not an input recording."), *FilePath);
+		return false;
+	}
+
+	if (Version == 0 || Version > CurrentVersion)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("FInputRecordingFile::Load - Unsupported input recording version %i in %s."), Version, *FilePath
+		);
+		return false;
+	}
+
+	FInputRecording Recording;
+	Recording.Serialize(Reader, Version);
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FInputRecordingFile::Load - %s is truncated."), *FilePath);
+		return false;
+	}
+
+	OutRecording = MoveTemp(Recording);
+	return true;
+}
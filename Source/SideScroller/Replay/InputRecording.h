@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief The buttons a player can press during a recorded frame, as bits of FRecordedInputFrame::Buttons.
+ */
+namespace ERecordedInputButton
+{
+	enum Type : uint8
+	{
+		Jump = 1 << 0,
+		Shoot = 1 << 1,
+		Use = 1 << 2,
+		RunPressed = 1 << 3,
+		RunReleased = 1 << 4,
+	};
+}
+
+/**
+ * @struct FRecordedInputFrame
+ * @brief The gameplay input of the local player during one frame, and how long that frame was.
+ */
+struct FRecordedInputFrame
+{
+	/**
+	 * @brief The length of the frame in seconds. The replay runs each frame with exactly this time step.
+	 */
+	float DeltaSeconds = 0.f;
+
+	/**
+	 * @brief The value of the MoveRight axis.
+	 */
+	float MoveRight = 0.f;
+
+	/**
+	 * @brief The value of the ClimbUp axis.
+	 */
+	float ClimbUp = 0.f;
+
+	/**
+	 * @brief The ERecordedInputButton bits of the buttons pressed or released during the frame.
+	 */
+	uint8 Buttons = 0;
+
+	/**
+	 * @brief Serializes the frame. Axis values are kept at full precision, so the replay feeds the exact same input.
+	 *
+	 * @param Ar The archive to read from or write to.
+	 */
+	void Serialize(FArchive& Ar);
+};
+
+/**
+ * @struct FInputRecording
+ * @brief Everything needed to play a level again exactly as it was recorded.
+ *
+ * The level is started from the same map with the same random seed, then fed the same input with the same frame
+ * times. Once the last frame has played, the checksum of the level's end state has to match EndStateChecksum.
+ */
+struct FInputRecording
+{
+	/**
+	 * @brief The name of the map the recording was made on.
+	 */
+	FString MapName;
+
+	/**
+	 * @brief The seed of the level's random stream during the recording.
+	 */
+	int32 RandomSeed = 0;
+
+	/**
+	 * @brief The recorded frames, in order.
+	 */
+	TArray<FRecordedInputFrame> Frames;
+
+	/**
+	 * @brief The checksum of the level's state after the last frame.
+	 */
+	uint32 EndStateChecksum = 0;
+
+	/**
+	 * @brief Serializes the recording in the layout of the given version.
+	 *
+	 * @param Ar The archive to read from or write to.
+	 * @param Version The layout version of the data in Ar.
+	 */
+	void Serialize(FArchive& Ar, uint16 Version);
+};
+
+/**
+ * @brief Reads and writes FInputRecording files.
+ *
+ * The files use a compact, versioned binary layout like the progression record, 13 bytes per frame, so an hour of
+ * play at 60 frames per second stays under 3 MB. They are written once, when a recording stops.
+ */
+class SIDESCROLLER_API FInputRecordingFile
+{
+public:
+	/**
+	 * @brief The current version of the binary layout. Bump it whenever fields are added to FInputRecording.
+	 */
+	static constexpr uint16 CurrentVersion = 1;
+
+	/**
+	 * @brief Gets the path of a recording.
+	 *
+	 * @param Name The name of the recording, or a path to it. Absolute paths are returned as they are.
+	 * @return The absolute path of the recording, in <Saved>/InputRecordings unless a path was given.
+	 */
+	static FString GetFilePath(const FString& Name);
+
+	/**
+	 * @brief Writes the recording to a file.
+	 *
+	 * @param Recording The recording to write.
+	 * @param FilePath The path of the file.
+	 * @return True if the recording ended up on disk.
+	 */
+	static bool Save(const FInputRecording& Recording, const FString& FilePath);
+
+	/**
+	 * @brief Reads a recording from a file.
+	 *
+	 * @param FilePath The path of the file.
+	 * @param OutRecording The recording read from the file.
+	 * @return False if the file is missing, not a recording, written by a newer version, or truncated.
+	 */
+	static bool Load(const FString& FilePath, FInputRecording& OutRecording);
+};
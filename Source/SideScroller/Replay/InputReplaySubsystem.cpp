@@ -0,0 +1,502 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "InputReplaySubsystem.h"
+
+#include "EngineUtils.h"
+#include "Components/InputComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerInput.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "SideScroller/Characters/BasePaperCharacter.h"
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/GameStates/LevelGameState.h"
+
+namespace InputReplay
+{
+	/**
+	 * @brief Whether the replay already opened the recorded map, so a map that fails to load does not loop forever.
+	 */
+	static bool bOpenedRecordedMap = false;
+
+	/**
+	 * Checks whether any key bound to an action went down, or up, during the frame.
+	 *
+	 * @param PlayerController The player controller to check.
+	 * @param ActionName The name of the input action.
+	 * @param bReleased Whether to check for release instead of press.
+	 * @return True if one of the action's keys was pressed, or released, during the frame.
+	 */
+	static bool WasActionJustUsed(
+		const APlayerController* PlayerController,
+		const FName ActionName,
+		const bool bReleased
+	)
+	{
+		for (const FInputActionKeyMapping& Mapping : PlayerController->PlayerInput->GetKeysForAction(ActionName))
+		{
+			if (bReleased
+				? PlayerController->WasInputKeyJustReleased(Mapping.Key)
+				: PlayerController->WasInputKeyJustPressed(Mapping.Key))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Handles the "SideScroller.StopInputRecording" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleStopInputRecordingCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInputReplaySubsystem* ReplaySubsystem = World ? World->GetSubsystem<UInputReplaySubsystem>() : nullptr)
+		{
+			ReplaySubsystem->StopRecording();
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs StopInputRecordingCommand(
+		TEXT("SideScroller.StopInputRecording"),
+		TEXT("Stops the input recording started with -RecordInput=<Name> and writes it, with the checksum of the "
+			"level's current state, to Saved/InputRecordings."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleStopInputRecordingCommand)
+	);
+}
+
+/**
+ * Starts recording or replaying if the command line asks for it. Both wait for the local player's pawn, so they line
+ * up on the same frame however long the pawn takes to spawn.
+ *
+ * @param InWorld The world that began play.
+ */
+void UInputReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FString Name;
+	if (FParse::Value(FCommandLine::Get(), TEXT("InputReplay="), Name))
+	{
+		if (!this->StartReplay(Name, true))
+		{
+			FPlatformMisc::RequestExitWithStatus(false, 1);
+		}
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("RecordInput="), Name))
+	{
+		this->StartRecording(Name);
+	}
+}
+
+/**
+ * Removes the frame handlers and gives the engine its own time step back.
+ */
+void UInputReplaySubsystem::Deinitialize()
+{
+	if (this->bIsReplaying)
+	{
+		FApp::SetUseFixedTimeStep(this->bWasUsingFixedTimeStep);
+		FApp::SetFixedDeltaTime(this->PreviousFixedDeltaTime);
+		this->bIsReplaying = false;
+	}
+	this->bIsRecording = false;
+	this->RemoveFrameHandlers();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Starts recording the local player's input, from the first frame the local player has a pawn on, along with the
+ * level's map and random seed.
+ *
+ * @param Name The name of the recording, or a path to it.
+ * @return False if a recording or replay is already running, or the world is not a level.
+ */
+bool UInputReplaySubsystem::StartRecording(const FString& Name)
+{
+	const UWorld* World = this->GetWorld();
+	const ALevelGameState* LevelGameState = World ? World->GetGameState<ALevelGameState>() : nullptr;
+	if (this->bIsRecording || this->bIsReplaying || LevelGameState == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("UInputReplaySubsystem::StartRecording - Can only record one level at a time, not %s."),
+			World ? *World->GetMapName() : TEXT("no world")
+		);
+		return false;
+	}
+
+	this->Recording = FInputRecording();
+	this->Recording.MapName = World->GetMapName();
+	this->Recording.RandomSeed = LevelGameState->GetRandomSeed();
+	this->RecordingPath = FInputRecordingFile::GetFilePath(Name);
+	this->bHasLocalPawn = false;
+	this->LocalPawn.Reset();
+	this->bIsRecording = true;
+	this->AddFrameHandlers();
+
+	UE_LOG(LogTemp, Display, TEXT("UInputReplaySubsystem::StartRecording - Recording %s with seed %i to %s."),
+		*this->Recording.MapName, this->Recording.RandomSeed, *this->RecordingPath
+	);
+	return true;
+}
+
+/**
+ * Stops the running recording and writes it, with the checksum of the level's current state, to disk.
+ */
+void UInputReplaySubsystem::StopRecording()
+{
+	if (!this->bIsRecording) return;
+
+	this->bIsRecording = false;
+	this->RemoveFrameHandlers();
+	this->Recording.EndStateChecksum = this->ComputeStateChecksum();
+
+	if (FInputRecordingFile::Save(this->Recording, this->RecordingPath))
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UInputReplaySubsystem::StopRecording - Wrote %i frames with end state checksum %08x to %s."),
+			this->Recording.Frames.Num(), this->Recording.EndStateChecksum, *this->RecordingPath
+		);
+	}
+}
+
+/**
+ * Loads a recording and plays it back from the first frame the local player has a pawn on. On another map it opens
+ * the recorded map instead, whose subsystem then starts the replay from the command line.
+ *
+ * @param Name The name of the recording, or a path to it.
+ * @param bExitWhenDone Whether to exit with the result as exit code once the replay is done.
+ * @return False if the recording could not be loaded or a recording or replay is already running.
+ */
+bool UInputReplaySubsystem::StartReplay(const FString& Name, const bool bExitWhenDone)
+{
+	UWorld* World = this->GetWorld();
+	if (this->bIsRecording || this->bIsReplaying || World == nullptr) return false;
+
+	this->RecordingPath = FInputRecordingFile::GetFilePath(Name);
+	if (!FInputRecordingFile::Load(this->RecordingPath, this->Recording)) return false;
+
+	if (World->GetMapName() != this->Recording.MapName)
+	{
+		if (InputReplay::bOpenedRecordedMap)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UInputReplaySubsystem::StartReplay - Could not open %s, ended up on %s."),
+				*this->Recording.MapName, *World->GetMapName()
+			);
+			return false;
+		}
+
+		InputReplay::bOpenedRecordedMap = true;
+		UGameplayStatics::OpenLevel(World, FName(*this->Recording.MapName));
+		return true;
+	}
+
+	ALevelGameState* LevelGameState = World->GetGameState<ALevelGameState>();
+	if (LevelGameState == nullptr || this->Recording.Frames.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UInputReplaySubsystem::StartReplay - Nothing to replay from %s on %s."),
+			*this->RecordingPath, *World->GetMapName()
+		);
+		return false;
+	}
+	LevelGameState->SetRandomSeed(this->Recording.RandomSeed);
+
+	this->bWasUsingFixedTimeStep = FApp::UseFixedTimeStep();
+	this->PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(this->Recording.Frames[0].DeltaSeconds);
+
+	this->ReplayFrameIndex = 0;
+	this->bHasLocalPawn = false;
+	this->LocalPawn.Reset();
+	this->ReplayStartTime = FPlatformTime::Seconds();
+	this->bExitWhenReplayDone = bExitWhenDone;
+	this->bIsReplaying = true;
+	this->AddFrameHandlers();
+
+	UE_LOG(LogTemp, Display, TEXT("UInputReplaySubsystem::StartReplay - Replaying %i frames of %s with seed %i."),
+		this->Recording.Frames.Num(), *this->Recording.MapName, this->Recording.RandomSeed
+	);
+	return true;
+}
+
+/**
+ * Computes a checksum of the level's gameplay state. Characters are visited by name so the order of the actor list
+ * does not matter, and locations are rounded to a millimeter.
+ *
+ * @return The checksum.
+ */
+uint32 UInputReplaySubsystem::ComputeStateChecksum() const
+{
+	const UWorld* World = this->GetWorld();
+	if (World == nullptr) return 0;
+
+	TArray<const ABasePaperCharacter*> Characters;
+	for (TActorIterator<ABasePaperCharacter> It(World); It; ++It)
+	{
+		Characters.Add(*It);
+	}
+	Characters.Sort([](const ABasePaperCharacter& A, const ABasePaperCharacter& B)
+	{
+		return A.GetName() < B.GetName();
+	});
+
+	FString State;
+	for (const ABasePaperCharacter* Character : Characters)
+	{
+		const FVector Location = Character->GetActorLocation();
+		State += FString::Printf(TEXT("%s %.1f %.1f %.1f %.1f %i;"),
+			*Character->GetName(), Location.X, Location.Y, Location.Z, Character->GetHealth(), Character->IsDead()
+		);
+
+		if (const APC_PlayerFox* Player = Cast<APC_PlayerFox>(Character))
+		{
+			State += FString::Printf(TEXT("%i %i %i %i;"),
+				Player->GetAccumulatedPoints(), Player->GetNumberOfLives(),
+				Player->GetCherryCount(), Player->GetMoneyCount()
+			);
+		}
+	}
+
+	if (ALevelGameState* LevelGameState = World->GetGameState<ALevelGameState>())
+	{
+		State += FString::Printf(TEXT("%i"), LevelGameState->GetRandomStream().GetCurrentSeed());
+	}
+
+	return FCrc::StrCrc32(*State);
+}
+
+/**
+ * Waits for the local player's pawn before the first frame is recorded or replayed, and feeds the current replay
+ * frame to it before any actor ticks, so the player's movement consumes it during the same frame it did while
+ * recording. A replay turns off the live input of every pawn the local player gets, so only the recorded input moves
+ * it. Once started, a frame still counts if the player is dead or waiting to respawn.
+ *
+ * @param TickedWorld The world about to tick.
+ * @param TickType The kind of tick.
+ * @param DeltaSeconds The length of the frame.
+ */
+void UInputReplaySubsystem::OnPreActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if ((!this->bIsRecording && !this->bIsReplaying) || TickedWorld != this->GetWorld()) return;
+
+	APlayerController* PlayerController = this->GetLocalPlayerController();
+	APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (Pawn && Pawn != this->LocalPawn.Get())
+	{
+		if (!this->bHasLocalPawn)
+		{
+			UE_LOG(LogTemp, Display, TEXT("UInputReplaySubsystem::OnPreActorTick - %s %s from frame %llu on."),
+				this->bIsReplaying ? TEXT("Replaying") : TEXT("Recording"), *Pawn->GetName(), GFrameCounter
+			);
+		}
+		if (this->bIsReplaying)
+		{
+			Pawn->DisableInput(PlayerController);
+		}
+		this->LocalPawn = Pawn;
+		this->bHasLocalPawn = true;
+	}
+	if (!this->bIsReplaying || !this->bHasLocalPawn) return;
+	if (!this->Recording.Frames.IsValidIndex(this->ReplayFrameIndex)) return;
+
+	if (APC_PlayerFox* Player = Cast<APC_PlayerFox>(Pawn))
+	{
+		Player->ApplyRecordedInput(this->Recording.Frames[this->ReplayFrameIndex]);
+	}
+}
+
+/**
+ * Records the frame's input, or moves the replay on to the next frame and its time step, once every actor has
+ * ticked.
+ *
+ * @param TickedWorld The world that ticked.
+ * @param TickType The kind of tick.
+ * @param DeltaSeconds The length of the frame.
+ */
+void UInputReplaySubsystem::OnPostActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (TickedWorld != this->GetWorld() || !this->bHasLocalPawn) return;
+
+	if (this->bIsRecording)
+	{
+		this->Recording.Frames.Add(this->CaptureFrame(DeltaSeconds));
+	}
+	else if (this->bIsReplaying)
+	{
+		++this->ReplayFrameIndex;
+		if (this->Recording.Frames.IsValidIndex(this->ReplayFrameIndex))
+		{
+			FApp::SetFixedDeltaTime(this->Recording.Frames[this->ReplayFrameIndex].DeltaSeconds);
+		}
+		else
+		{
+			this->FinishReplay();
+		}
+	}
+}
+
+/**
+ * Stops a running recording while the level's actors still exist, so the checksum covers the level's last frame.
+ *
+ * @param TornDownWorld The world being torn down.
+ */
+void UInputReplaySubsystem::OnWorldBeginTearDown(UWorld* TornDownWorld)
+{
+	if (TornDownWorld == this->GetWorld())
+	{
+		this->StopRecording();
+	}
+}
+
+/**
+ * Reads the local player's input of the frame that just ticked: the axis values the pawn's input component received
+ * and the gameplay actions whose keys went down, or for running also up, during the frame.
+ *
+ * @param DeltaSeconds The length of the frame.
+ * @return The recorded frame.
+ */
+FRecordedInputFrame UInputReplaySubsystem::CaptureFrame(const float DeltaSeconds) const
+{
+	FRecordedInputFrame Frame;
+	Frame.DeltaSeconds = DeltaSeconds;
+
+	const APlayerController* PlayerController = this->GetLocalPlayerController();
+	const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (Pawn && Pawn->InputComponent)
+	{
+		Frame.MoveRight = Pawn->InputComponent->GetAxisValue(TEXT("MoveRight"));
+		Frame.ClimbUp = Pawn->InputComponent->GetAxisValue(TEXT("ClimbUp"));
+	}
+
+	if (PlayerController && PlayerController->PlayerInput)
+	{
+		using namespace ERecordedInputButton;
+		Frame.Buttons |= InputReplay::WasActionJustUsed(PlayerController, TEXT("Jump"), false) ? Jump : 0;
+		Frame.Buttons |= InputReplay::WasActionJustUsed(PlayerController, TEXT("Shoot"), false) ? Shoot : 0;
+		Frame.Buttons |= InputReplay::WasActionJustUsed(PlayerController, TEXT("Use"), false) ? Use : 0;
+		Frame.Buttons |= InputReplay::WasActionJustUsed(PlayerController, TEXT("Run"), false) ? RunPressed : 0;
+		Frame.Buttons |= InputReplay::WasActionJustUsed(PlayerController, TEXT("Run"), true) ? RunReleased : 0;
+	}
+
+	return Frame;
+}
+
+/**
+ * Compares the end state with the recording, logs how much faster than real time the replay ran, appends the result
+ * to the replay's CSV file and, for a headless run, exits with 0 on a match and 1 otherwise. Otherwise the player
+ * gets the pawn's live input back.
+ */
+void UInputReplaySubsystem::FinishReplay()
+{
+	this->bIsReplaying = false;
+	this->RemoveFrameHandlers();
+	if (APawn* Pawn = this->LocalPawn.Get())
+	{
+		Pawn->EnableInput(this->GetLocalPlayerController());
+	}
+	FApp::SetUseFixedTimeStep(this->bWasUsingFixedTimeStep);
+	FApp::SetFixedDeltaTime(this->PreviousFixedDeltaTime);
+
+	const double WallSeconds = FPlatformTime::Seconds() - this->ReplayStartTime;
+	double SimulatedSeconds = 0.0;
+	for (const FRecordedInputFrame& Frame : this->Recording.Frames)
+	{
+		SimulatedSeconds += Frame.DeltaSeconds;
+	}
+	const int32 NumFrames = this->Recording.Frames.Num();
+	const double FrameMs = WallSeconds * 1000.0 / NumFrames;
+	const double Speedup = WallSeconds > 0.0 ? SimulatedSeconds / WallSeconds : 0.0;
+
+	const uint32 Checksum = this->ComputeStateChecksum();
+	const bool bMatches = Checksum == this->Recording.EndStateChecksum;
+	if (bMatches)
+	{
+		UE_LOG(LogTemp, Display,
+			TEXT("UInputReplaySubsystem::FinishReplay - PASS %s: %i frames, %.2f s simulated in %.2f s "
+				"(%.3f ms per frame, %.1fx real time)."),
+			*this->RecordingPath, NumFrames, SimulatedSeconds, WallSeconds, FrameMs, Speedup
+		);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error,
+			TEXT("UInputReplaySubsystem::FinishReplay - FAIL %s: end state checksum %08x, recorded %08x, after %i "
+				"frames (%.3f ms per frame, %.1fx real time)."),
+			*this->RecordingPath, Checksum, this->Recording.EndStateChecksum, NumFrames, FrameMs, Speedup
+		);
+	}
+
+	const FString CsvPath = FPaths::Combine(
+		FPaths::ProfilingDir(),
+		TEXT("InputReplay"),
+		FString::Printf(TEXT("InputReplay-%s.csv"), *FPaths::GetBaseFilename(this->RecordingPath))
+	);
+	FString Csv = IFileManager::Get().FileExists(*CsvPath)
+		? FString()
+		: TEXT("Time,Map,Frames,SimulatedSeconds,WallSeconds,FrameMs,Speedup,Checksum,RecordedChecksum,Match\n");
+	Csv += FString::Printf(TEXT("%s,%s,%i,%.3f,%.3f,%.4f,%.2f,%08x,%08x,%i\n"),
+		*FDateTime::Now().ToString(), *this->Recording.MapName, NumFrames, SimulatedSeconds, WallSeconds, FrameMs,
+		Speedup, Checksum, this->Recording.EndStateChecksum, bMatches
+	);
+	if (!FFileHelper::SaveStringToFile(
+		Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UInputReplaySubsystem::FinishReplay - Could not write %s."), *CsvPath);
+	}
+
+	if (this->bExitWhenReplayDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bMatches ? 0 : 1);
+	}
+}
+
+/**
+ * Gets the first local player's controller.
+ *
+ * @return The player controller, or nullptr if there is no local player.
+ */
+APlayerController* UInputReplaySubsystem::GetLocalPlayerController() const
+{
+	const UWorld* World = this->GetWorld();
+	return World ? World->GetFirstPlayerController() : nullptr;
+}
+
+/**
+ * Adds the frame handlers to the world delegates.
+ */
+void UInputReplaySubsystem::AddFrameHandlers()
+{
+	this->RemoveFrameHandlers();
+	this->PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(
+		this, &UInputReplaySubsystem::OnPreActorTick
+	);
+	this->PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UInputReplaySubsystem::OnPostActorTick
+	);
+	this->BeginTearDownHandle = FWorldDelegates::OnWorldBeginTearDown.AddUObject(
+		this, &UInputReplaySubsystem::OnWorldBeginTearDown
+	);
+}
+
+/**
+ * Removes the frame handlers from the world delegates.
+ */
+void UInputReplaySubsystem::RemoveFrameHandlers()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(this->PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(this->PostActorTickHandle);
+	FWorldDelegates::OnWorldBeginTearDown.Remove(this->BeginTearDownHandle);
+	this->PreActorTickHandle.Reset();
+	this->PostActorTickHandle.Reset();
+	this->BeginTearDownHandle.Reset();
+}
@@ -0,0 +1,195 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputRecording.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputReplaySubsystem.generated.h"
+
+class APawn;
+
+/**
+ * @class UInputReplaySubsystem
+ * @brief Records the local player's input on a level and plays it back headless, for regression runs.
+ *
+ * Recording is started with -RecordInput=<Name> on the command line and captures every frame of the level from the
+ * first one the local player has a pawn on: the frame time, the MoveRight and ClimbUp axes and the gameplay buttons,
+ * together with the level's random seed. It stops with "SideScroller.StopInputRecording" or when the level is torn
+ * down, and is then written to <Saved>/InputRecordings/<Name>.bin with a checksum of the level's end state.
+ *
+ * Playback is started with -InputReplay=<Name>, typically in a headless run:
+ *   UnrealEditor-Cmd SideScroller.uproject -game -nullrhi -nosound -unattended -InputReplay=<Name>
+ * The runner opens the recorded map, restarts the level's random stream from the recorded seed and, from the first
+ * frame the local player has a pawn on, feeds every recorded frame to the player, with the engine on a fixed time
+ * step of the recorded frame time. The pawn's own input is turned off while it runs, so keys pressed on the machine
+ * doing the replay do not mix with the recorded ones. Nothing waits on the wall clock, so the replay runs as fast as
+ * the machine can simulate. After the last frame it compares the end state checksum with the recorded one, appends
+ * the result and timings to <ProfilingDir>/InputReplay/InputReplay-<Name>.csv and exits with 0 if they match and 1
+ * if they do not.
+ */
+UCLASS()
+class SIDESCROLLER_API UInputReplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Starts recording or replaying if the command line asks for it.
+	 *
+	 * @param InWorld The world that began play.
+	 */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/**
+	 * @brief Removes the frame handlers and gives the engine its own time step back.
+	 */
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Starts recording the local player's input, from the first frame the local player has a pawn on.
+	 *
+	 * @param Name The name of the recording, or a path to it.
+	 * @return False if a recording or replay is already running, or the world is not a level.
+	 */
+	bool StartRecording(const FString& Name);
+
+	/**
+	 * @brief Stops the running recording and writes it, with the checksum of the level's current state, to disk.
+	 */
+	void StopRecording();
+
+	/**
+	 * @brief Loads a recording and plays it back, opening the recorded map first if this is not it.
+	 *
+	 * @param Name The name of the recording, or a path to it.
+	 * @param bExitWhenDone Whether to exit with the result as exit code once the replay is done.
+	 * @return False if the recording could not be loaded or a recording or replay is already running.
+	 */
+	bool StartReplay(const FString& Name, bool bExitWhenDone);
+
+	/**
+	 * @brief Computes a checksum of the level's gameplay state.
+	 *
+	 * Covers the location, health and death of every character, the points, lives, cherries and money of every
+	 * player, and how far the level's random stream has advanced.
+	 *
+	 * @return The checksum.
+	 */
+	uint32 ComputeStateChecksum() const;
+
+private:
+	/**
+	 * @brief Waits for the local pawn, then feeds the current replay frame to the player before any actor ticks.
+	 *
+	 * @param TickedWorld The world about to tick.
+	 * @param TickType The kind of tick.
+	 * @param DeltaSeconds The length of the frame.
+	 */
+	void OnPreActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * @brief Records the frame's input, or moves the replay on to the next frame, once every actor has ticked.
+	 *
+	 * @param TickedWorld The world that ticked.
+	 * @param TickType The kind of tick.
+	 * @param DeltaSeconds The length of the frame.
+	 */
+	void OnPostActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * @brief Stops a running recording before the level's actors are torn down.
+	 *
+	 * @param TornDownWorld The world being torn down.
+	 */
+	void OnWorldBeginTearDown(UWorld* TornDownWorld);
+
+	/**
+	 * @brief Reads the local player's input of the frame that just ticked.
+	 *
+	 * @param DeltaSeconds The length of the frame.
+	 * @return The recorded frame.
+	 */
+	FRecordedInputFrame CaptureFrame(float DeltaSeconds) const;
+
+	/**
+	 * @brief Compares the end state, reports and stores the result, and exits if the replay was started headless.
+	 */
+	void FinishReplay();
+
+	/**
+	 * @brief Gets the first local player's controller.
+	 *
+	 * @return The player controller, or nullptr if there is no local player.
+	 */
+	APlayerController* GetLocalPlayerController() const;
+
+	/**
+	 * @brief Adds the frame handlers to the world delegates.
+	 */
+	void AddFrameHandlers();
+
+	/**
+	 * @brief Removes the frame handlers from the world delegates.
+	 */
+	void RemoveFrameHandlers();
+
+	/**
+	 * @brief The recording being captured or replayed.
+	 */
+	FInputRecording Recording;
+
+	/**
+	 * @brief The path the recording is written to or was read from.
+	 */
+	FString RecordingPath;
+
+	/**
+	 * @brief Whether a recording is running.
+	 */
+	bool bIsRecording = false;
+
+	/**
+	 * @brief Whether a replay is running.
+	 */
+	bool bIsReplaying = false;
+
+	/**
+	 * @brief Whether to exit with the result as exit code once the replay is done.
+	 */
+	bool bExitWhenReplayDone = false;
+
+	/**
+	 * @brief Whether the local player has had a pawn since the recording or replay started. Until then no frame is
+	 * recorded or replayed.
+	 */
+	bool bHasLocalPawn = false;
+
+	/**
+	 * @brief The last local pawn the recording or replay saw, whose live input a replay turned off.
+	 */
+	TWeakObjectPtr<APawn> LocalPawn;
+
+	/**
+	 * @brief The index of the frame being replayed.
+	 */
+	int32 ReplayFrameIndex = 0;
+
+	/**
+	 * @brief FPlatformTime::Seconds when the replay started.
+	 */
+	double ReplayStartTime = 0.0;
+
+	/**
+	 * @brief Whether the engine was on a fixed time step before the replay, and which, to restore it afterwards.
+	 */
+	bool bWasUsingFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	/**
+	 * @brief The handles of the frame handlers on the world delegates.
+	 */
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+	FDelegateHandle BeginTearDownHandle;
+};
@@ -0,0 +1,372 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MatchReplaySubsystem.h"
+
+#include "NetworkReplayStreaming.h"
+#include "Engine/DemoNetDriver.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/NetworkVersion.h"
+
+namespace MatchReplay
+{
+	/**
+	 * @brief The replay streaming module recordings are written and read with, whatever the platform default is.
+	 */
+	static const TCHAR* LocalFileStreamerName = TEXT("LocalFileNetworkReplayStreaming");
+
+	/**
+	 * @brief The URL option that makes the demo net driver use the local file streamer.
+	 */
+	static const TCHAR* LocalFileStreamerOption = TEXT("ReplayStreamerOverride=LocalFileNetworkReplayStreaming");
+
+	/**
+	 * @brief The prefix of the recordings this subsystem makes. Only these are ever deleted.
+	 */
+	static const TCHAR* MatchReplayPrefix = TEXT("Match-");
+
+	/**
+	 * @brief How long a seek waits for the replay it was started with to load before giving up.
+	 */
+	static constexpr double MaxPendingSeekWaitSeconds = 60.0;
+
+	/**
+	 * Gets the match replay subsystem of the world's game instance.
+	 *
+	 * @param World The world a console command was run in.
+	 * @return The subsystem, or nullptr if the world has no game instance.
+	 */
+	static UMatchReplaySubsystem* GetSubsystem(const UWorld* World)
+	{
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UMatchReplaySubsystem>() : nullptr;
+	}
+
+	/**
+	 * Handles the "SideScroller.Replay.List" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleListCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UMatchReplaySubsystem* Subsystem = GetSubsystem(World);
+		if (Subsystem == nullptr) return;
+
+		Subsystem->FindMatchReplays(FOnMatchReplaysFound::CreateLambda([](const TArray<FMatchReplayInfo>& Replays)
+		{
+			UE_LOG(LogTemp, Display, TEXT("MatchReplay - %i recordings:"), Replays.Num());
+			for (const FMatchReplayInfo& Replay : Replays)
+			{
+				UE_LOG(LogTemp, Display, TEXT("  %s  %8.1f s  %8.1f KB  %s"),
+					*Replay.Name, Replay.LengthInSeconds, Replay.SizeInBytes / 1024.0, *Replay.FriendlyName
+				);
+			}
+		}));
+	}
+
+	/**
+	 * Handles the "SideScroller.Replay.Play <Name> [StartSeconds]" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandlePlayCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UMatchReplaySubsystem* Subsystem = GetSubsystem(World);
+		if (Subsystem == nullptr || Args.Num() == 0) return;
+
+		Subsystem->PlayMatchReplay(Args[0], Args.Num() > 1 ? FCString::Atof(*Args[1]) : 0.f);
+	}
+
+	/**
+	 * Handles the "SideScroller.Replay.Seek <Seconds>" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleSeekCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UMatchReplaySubsystem* Subsystem = GetSubsystem(World);
+		if (Subsystem == nullptr || Args.Num() == 0) return;
+
+		if (!Subsystem->SeekMatchReplay(FCString::Atof(*Args[0])))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("MatchReplay - No replay is playing."));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs ListCommand(
+		TEXT("SideScroller.Replay.List"),
+		TEXT("Logs the match recordings on disk, newest first."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleListCommand)
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs PlayCommand(
+		TEXT("SideScroller.Replay.Play"),
+		TEXT("Plays the match recording with the given name, optionally starting at StartSeconds."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandlePlayCommand)
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs SeekCommand(
+		TEXT("SideScroller.Replay.Seek"),
+		TEXT("Jumps the match replay that is playing to the given time in seconds, by loading the nearest checkpoint "
+			"before it."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleSeekCommand)
+	);
+}
+
+/**
+ * Stops a pending seek and releases the replay streamer.
+ */
+void UMatchReplaySubsystem::Deinitialize()
+{
+	if (this->PendingSeekHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(this->PendingSeekHandle);
+		this->PendingSeekHandle.Reset();
+	}
+	this->ReplayStreamer.Reset();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Starts recording the server's world into a file named after its map and the current time, then drops the oldest
+ * recordings beyond MaxStoredReplays.
+ */
+void UMatchReplaySubsystem::StartMatchRecording()
+{
+	UGameInstance* GameInstance = this->GetGameInstance();
+	const UWorld* World = GameInstance->GetWorld();
+	if (!this->bRecordMatches || World == nullptr || World->GetNetMode() == NM_Client) return;
+	if (World->IsPlayingReplay() || World->IsRecordingReplay()) return;
+
+	const FString MapName = World->GetMapName();
+	const FDateTime Now = FDateTime::Now();
+	const FString Name = FString::Printf(TEXT("%s%s-%s"), MatchReplay::MatchReplayPrefix, *MapName, *Now.ToString());
+	const FString FriendlyName = FString::Printf(TEXT("%s %s"), *MapName, *Now.ToString(TEXT("%Y-%m-%d %H:%M")));
+	GameInstance->StartRecordingReplay(Name, FriendlyName, {MatchReplay::LocalFileStreamerOption});
+
+	UE_LOG(LogTemp, Display, TEXT("UMatchReplaySubsystem::StartMatchRecording - Recording %s."), *Name);
+	this->FindMatchReplays(FOnMatchReplaysFound::CreateUObject(this, &UMatchReplaySubsystem::PruneMatchReplays));
+}
+
+/**
+ * Finishes the running recording, if any, which writes its last checkpoint and closes the file.
+ */
+void UMatchReplaySubsystem::StopMatchRecording()
+{
+	UGameInstance* GameInstance = this->GetGameInstance();
+	const UWorld* World = GameInstance->GetWorld();
+	if (World == nullptr || !World->IsRecordingReplay()) return;
+
+	GameInstance->StopRecordingReplay();
+}
+
+/**
+ * Looks for the match recordings on disk that were made by a compatible build, and hands them over newest first.
+ *
+ * @param OnFound Called with the recordings once the search is done. May be called right away.
+ */
+void UMatchReplaySubsystem::FindMatchReplays(const FOnMatchReplaysFound& OnFound)
+{
+	INetworkReplayStreamer* Streamer = this->GetReplayStreamer();
+	if (Streamer == nullptr)
+	{
+		OnFound.ExecuteIfBound(TArray<FMatchReplayInfo>());
+		return;
+	}
+
+	Streamer->EnumerateStreams(
+		FNetworkVersion::GetReplayVersion(),
+		INDEX_NONE,
+		FString(),
+		TArray<FString>(),
+		FEnumerateStreamsCallback::CreateLambda([OnFound](const FEnumerateStreamsResult& Result)
+		{
+			TArray<FMatchReplayInfo> Replays;
+			for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+			{
+				FMatchReplayInfo& Replay = Replays.AddDefaulted_GetRef();
+				Replay.Name = StreamInfo.Name;
+				Replay.FriendlyName = StreamInfo.FriendlyName.IsEmpty() ? StreamInfo.Name : StreamInfo.FriendlyName;
+				Replay.Timestamp = StreamInfo.Timestamp;
+				Replay.LengthInSeconds = StreamInfo.LengthInMS / 1000.f;
+				Replay.SizeInBytes = StreamInfo.SizeInBytes;
+			}
+			Replays.Sort([](const FMatchReplayInfo& A, const FMatchReplayInfo& B)
+			{
+				return A.Timestamp > B.Timestamp;
+			});
+			OnFound.ExecuteIfBound(Replays);
+		})
+	);
+}
+
+/**
+ * Plays a match recording as a client of the demo net driver, and seeks to the start time once it has loaded.
+ *
+ * @param Name The name of the recording.
+ * @param StartSeconds The time to seek to once the recording has loaded, 0 to play it from the start.
+ * @return False if the replay could not be started.
+ */
+bool UMatchReplaySubsystem::PlayMatchReplay(const FString& Name, const float StartSeconds)
+{
+	if (this->PendingSeekHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(this->PendingSeekHandle);
+		this->PendingSeekHandle.Reset();
+	}
+
+	if (!this->GetGameInstance()->PlayReplay(Name, nullptr, {MatchReplay::LocalFileStreamerOption}))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UMatchReplaySubsystem::PlayMatchReplay - Could not play %s."), *Name);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UMatchReplaySubsystem::PlayMatchReplay - Playing %s from %.1f s."),
+		*Name, StartSeconds
+	);
+	if (StartSeconds > 0.f)
+	{
+		this->PendingSeekSeconds = StartSeconds;
+		this->SeekStartTime = FPlatformTime::Seconds();
+		this->PendingSeekHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UMatchReplaySubsystem::TickPendingSeek)
+		);
+	}
+	return true;
+}
+
+/**
+ * Jumps to the given time of the replay that is playing. The demo net driver loads the nearest checkpoint before
+ * the time and fast-forwards from there.
+ *
+ * @param Seconds The time to jump to. Clamped to the length of the replay.
+ * @return False if no replay is playing.
+ */
+bool UMatchReplaySubsystem::SeekMatchReplay(const float Seconds)
+{
+	UDemoNetDriver* DemoNetDriver = this->GetPlayingDemoNetDriver();
+	if (DemoNetDriver == nullptr) return false;
+
+	const float TargetSeconds = FMath::Clamp(Seconds, 0.f, DemoNetDriver->GetDemoTotalTime());
+	this->SeekStartTime = FPlatformTime::Seconds();
+	DemoNetDriver->GotoTimeInSeconds(
+		TargetSeconds, FOnGotoTimeDelegate::CreateUObject(this, &UMatchReplaySubsystem::OnSeekComplete)
+	);
+	return true;
+}
+
+/**
+ * Gets the time of the replay that is playing.
+ *
+ * @return The current time in seconds, or 0 if no replay is playing.
+ */
+float UMatchReplaySubsystem::GetMatchReplayTime() const
+{
+	const UDemoNetDriver* DemoNetDriver = this->GetPlayingDemoNetDriver();
+	return DemoNetDriver ? DemoNetDriver->GetDemoCurrentTime() : 0.f;
+}
+
+/**
+ * Gets the length of the replay that is playing.
+ *
+ * @return The length in seconds, or 0 if no replay is playing.
+ */
+float UMatchReplaySubsystem::GetMatchReplayLength() const
+{
+	const UDemoNetDriver* DemoNetDriver = this->GetPlayingDemoNetDriver();
+	return DemoNetDriver ? DemoNetDriver->GetDemoTotalTime() : 0.f;
+}
+
+/**
+ * Gets the demo net driver of the current world if it is playing a replay.
+ *
+ * @return The demo net driver, or nullptr if no replay is playing.
+ */
+UDemoNetDriver* UMatchReplaySubsystem::GetPlayingDemoNetDriver() const
+{
+	const UWorld* World = this->GetGameInstance()->GetWorld();
+	UDemoNetDriver* DemoNetDriver = World ? World->GetDemoNetDriver() : nullptr;
+	return DemoNetDriver && DemoNetDriver->IsPlaying() ? DemoNetDriver : nullptr;
+}
+
+/**
+ * Gets the local file replay streamer, creating it on first use.
+ *
+ * @return The streamer, or nullptr if the local file streaming module is not available.
+ */
+INetworkReplayStreamer* UMatchReplaySubsystem::GetReplayStreamer()
+{
+	if (!this->ReplayStreamer.IsValid())
+	{
+		this->ReplayStreamer = FNetworkReplayStreaming::Get()
+			.GetFactory(MatchReplay::LocalFileStreamerName)
+			.CreateReplayStreamer();
+	}
+	return this->ReplayStreamer.Get();
+}
+
+/**
+ * Deletes this subsystem's oldest finished recordings beyond MaxStoredReplays. The recording that was just started
+ * is the newest, so it is never among them.
+ *
+ * @param Replays The recordings on disk, newest first.
+ */
+void UMatchReplaySubsystem::PruneMatchReplays(const TArray<FMatchReplayInfo>& Replays)
+{
+	INetworkReplayStreamer* Streamer = this->GetReplayStreamer();
+	if (Streamer == nullptr) return;
+
+	int32 NumKept = 0;
+	for (const FMatchReplayInfo& Replay : Replays)
+	{
+		if (!Replay.Name.StartsWith(MatchReplay::MatchReplayPrefix)) continue;
+		if (++NumKept <= this->MaxStoredReplays) continue;
+
+		UE_LOG(LogTemp, Display, TEXT("UMatchReplaySubsystem::PruneMatchReplays - Deleting %s."), *Replay.Name);
+		Streamer->DeleteFinishedStream(Replay.Name, INDEX_NONE, FDeleteFinishedStreamCallback());
+	}
+}
+
+/**
+ * Seeks to PendingSeekSeconds once the replay that was started has loaded its header, which is when its length is
+ * known.
+ *
+ * @param DeltaTime The time since the last tick.
+ * @return True to keep waiting, false once the seek has been started or waiting is pointless.
+ */
+bool UMatchReplaySubsystem::TickPendingSeek(float DeltaTime)
+{
+	const UDemoNetDriver* DemoNetDriver = this->GetPlayingDemoNetDriver();
+	if (DemoNetDriver == nullptr || DemoNetDriver->GetDemoTotalTime() <= 0.f)
+	{
+		if (FPlatformTime::Seconds() - this->SeekStartTime < MatchReplay::MaxPendingSeekWaitSeconds) return true;
+
+		UE_LOG(LogTemp, Warning, TEXT("UMatchReplaySubsystem::TickPendingSeek - The replay never started playing."));
+		this->PendingSeekHandle.Reset();
+		return false;
+	}
+
+	this->PendingSeekHandle.Reset();
+	this->SeekMatchReplay(this->PendingSeekSeconds);
+	this->PendingSeekSeconds = -1.f;
+	return false;
+}
+
+/**
+ * Logs how long a seek took, which is dominated by loading the checkpoint and fast-forwarding from it.
+ *
+ * @param bSucceeded Whether the demo net driver reached the wanted time.
+ */
+void UMatchReplaySubsystem::OnSeekComplete(const bool bSucceeded)
+{
+	UE_LOG(LogTemp, Display, TEXT("UMatchReplaySubsystem::OnSeekComplete - %s at %.1f s after %.1f ms."),
+		bSucceeded ? TEXT("Arrived") : TEXT("Failed to arrive"),
+		this->GetMatchReplayTime(),
+		(FPlatformTime::Seconds() - this->SeekStartTime) * 1000.0
+	);
+}
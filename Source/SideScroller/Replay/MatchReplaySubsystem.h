@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "MatchReplaySubsystem.generated.h"
+
+class INetworkReplayStreamer;
+
+/**
+ * @struct FMatchReplayInfo
+ * @brief A match recording found on disk.
+ */
+struct FMatchReplayInfo
+{
+	/**
+	 * @brief The name the recording is stored and played under.
+	 */
+	FString Name;
+
+	/**
+	 * @brief The map and time the recording was made on, for showing in the menu.
+	 */
+	FString FriendlyName;
+
+	/**
+	 * @brief When the recording was made.
+	 */
+	FDateTime Timestamp;
+
+	/**
+	 * @brief The length of the recording in seconds.
+	 */
+	float LengthInSeconds = 0.f;
+
+	/**
+	 * @brief The size of the recording on disk.
+	 */
+	int64 SizeInBytes = 0;
+};
+
+/**
+ * @brief Called with the match recordings found on disk, newest first.
+ */
+DECLARE_DELEGATE_OneParam(FOnMatchReplaysFound, const TArray<FMatchReplayInfo>&);
+
+/**
+ * @class UMatchReplaySubsystem
+ * @brief Records the levels of hosted matches through the demo net driver, and plays them back with seeking.
+ *
+ * The server starts a recording when a level begins play and finishes it when the level ends, so every level of a
+ * match becomes its own file in <Saved>/Demos, written by the local file replay streamer. The demo net driver
+ * records the replicated state at demo.RecordHz and stores a checkpoint of the whole world every
+ * demo.CheckpointUploadDelayInSeconds (both set in DefaultEngine.ini). Only the newest MaxStoredReplays recordings
+ * are kept.
+ *
+ * Playback loads the recorded map as a client of the demo net driver, so it costs what a client's game costs and
+ * can be profiled like one. Seeking loads the nearest checkpoint before the wanted time and fast-forwards from
+ * there, so it takes at most one checkpoint interval of simulation however far the jump is.
+ *
+ * Usage:
+ * - The main menu's replay page lists the recordings and plays the selected one from a chosen start time.
+ * - The SideScroller.Replay.List, SideScroller.Replay.Play <Name> [Start] and SideScroller.Replay.Seek <Seconds>
+ *   console commands list, play and seek recordings, for profiling sessions.
+ */
+UCLASS(Config = Game)
+class SIDESCROLLER_API UMatchReplaySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Stops a pending seek and releases the replay streamer.
+	 */
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Starts recording the server's world, unless it is a client, a replay or recording is turned off.
+	 *
+	 * Called by the level game mode when a level begins play. Also drops the oldest recordings beyond
+	 * MaxStoredReplays.
+	 */
+	void StartMatchRecording();
+
+	/**
+	 * @brief Finishes the running recording, if any. Called by the level game mode when a level ends.
+	 */
+	void StopMatchRecording();
+
+	/**
+	 * @brief Looks for the match recordings on disk that this build can play.
+	 *
+	 * @param OnFound Called with the recordings, newest first, once the search is done. May be called right away.
+	 */
+	void FindMatchReplays(const FOnMatchReplaysFound& OnFound);
+
+	/**
+	 * @brief Plays a match recording, starting at the given time.
+	 *
+	 * @param Name The name of the recording.
+	 * @param StartSeconds The time to seek to once the recording has loaded, 0 to play it from the start.
+	 * @return False if the replay could not be started.
+	 */
+	bool PlayMatchReplay(const FString& Name, float StartSeconds = 0.f);
+
+	/**
+	 * @brief Jumps to the given time of the replay that is playing.
+	 *
+	 * Loads the nearest checkpoint before the time and fast-forwards from there.
+	 *
+	 * @param Seconds The time to jump to. Clamped to the length of the replay.
+	 * @return False if no replay is playing.
+	 */
+	bool SeekMatchReplay(float Seconds);
+
+	/**
+	 * @brief Gets the time of the replay that is playing.
+	 *
+	 * @return The current time in seconds, or 0 if no replay is playing.
+	 */
+	float GetMatchReplayTime() const;
+
+	/**
+	 * @brief Gets the length of the replay that is playing.
+	 *
+	 * @return The length in seconds, or 0 if no replay is playing.
+	 */
+	float GetMatchReplayLength() const;
+
+private:
+	/**
+	 * @brief Gets the demo net driver of the current world if it is playing a replay.
+	 *
+	 * @return The demo net driver, or nullptr if no replay is playing.
+	 */
+	class UDemoNetDriver* GetPlayingDemoNetDriver() const;
+
+	/**
+	 * @brief Gets the local file replay streamer, creating it on first use.
+	 *
+	 * @return The streamer, or nullptr if the local file streaming module is not available.
+	 */
+	INetworkReplayStreamer* GetReplayStreamer();
+
+	/**
+	 * @brief Deletes the oldest match recordings beyond MaxStoredReplays.
+	 *
+	 * @param Replays The recordings on disk, newest first.
+	 */
+	void PruneMatchReplays(const TArray<FMatchReplayInfo>& Replays);
+
+	/**
+	 * @brief Seeks to PendingSeekSeconds once the replay that was started has loaded its header.
+	 *
+	 * @param DeltaTime The time since the last tick.
+	 * @return True to keep waiting, false once the seek has been started or the replay is gone.
+	 */
+	bool TickPendingSeek(float DeltaTime);
+
+	/**
+	 * @brief Logs how long a seek took.
+	 *
+	 * @param bSucceeded Whether the demo net driver reached the wanted time.
+	 */
+	void OnSeekComplete(bool bSucceeded);
+
+	/**
+	 * @brief Whether hosted matches are recorded.
+	 */
+	UPROPERTY(Config)
+	bool bRecordMatches = true;
+
+	/**
+	 * @brief How many match recordings are kept on disk. The oldest are deleted when a new recording starts.
+	 */
+	UPROPERTY(Config)
+	int32 MaxStoredReplays = 20;
+
+	/**
+	 * @brief The streamer used to find and delete recordings. Recording and playback use their own.
+	 */
+	TSharedPtr<INetworkReplayStreamer> ReplayStreamer;
+
+	/**
+	 * @brief The time to seek to once the replay that was started has loaded, or a negative value for none.
+	 */
+	float PendingSeekSeconds = -1.f;
+
+	/**
+	 * @brief The ticker waiting for the replay to load before seeking.
+	 */
+	FTSTicker::FDelegateHandle PendingSeekHandle;
+
+	/**
+	 * @brief FPlatformTime::Seconds when the running seek started.
+	 */
+	double SeekStartTime = 0.0;
+};
@@ -0,0 +1,492 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SideScrollerReplicationGraph.h"
+
+#include "Engine/NetDriver.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/Mechanics/PlatformBlocks/MovingPlatform.h"
+#include "SideScroller/Projectiles/BaseProjectile.h"
+#include "UObject/UObjectIterator.h"
+
+namespace SideScrollerReplicationGraph
+{
+	/** Whether newly created game net drivers use the replication graph. Read when a game is hosted. */
+	static int32 EnableRepGraph = 1;
+
+	static FAutoConsoleVariableRef EnableRepGraphCVar(
+		TEXT("SideScroller.RepGraph.Enable"),
+		EnableRepGraph,
+		TEXT("1 to replicate hosted games through the X-axis replication graph, 0 for the default net driver "
+			"relevancy. Takes effect the next time a game is hosted.")
+	);
+}
+
+/**
+ * Makes the graph call PrepareForReplication once per replication frame, to move dynamic actors between cells.
+ */
+UReplicationGraphNode_XAxisGrid::UReplicationGraphNode_XAxisGrid()
+{
+	this->bRequiresPrepareForReplicationCall = true;
+}
+
+/**
+ * Adds the actor as a dynamic actor, which is always correct, if not the cheapest, for an actor of unknown kind.
+ *
+ * @param ActorInfo The actor being added.
+ */
+void UReplicationGraphNode_XAxisGrid::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	this->AddActor_Dynamic(ActorInfo);
+}
+
+/**
+ * Removes the actor from its cell, looking it up in the static actors first and the dynamic actors second.
+ *
+ * @param ActorInfo The actor being removed.
+ * @param bWarnIfNotFound Whether to log a warning if the actor is not in the grid.
+ * @return True if the actor was found and removed.
+ */
+bool UReplicationGraphNode_XAxisGrid::NotifyRemoveNetworkActor(
+	const FNewReplicatedActorInfo& ActorInfo,
+	const bool bWarnIfNotFound
+)
+{
+	int32 CellIndex = INDEX_NONE;
+	if (this->StaticActorCells.RemoveAndCopyValue(ActorInfo.Actor, CellIndex)
+		|| this->DynamicActorCells.RemoveAndCopyValue(ActorInfo.Actor, CellIndex))
+	{
+		if (FActorRepListRefView* Cell = this->Cells.Find(CellIndex))
+		{
+			Cell->RemoveFast(ActorInfo.Actor);
+		}
+		return true;
+	}
+
+	if (bWarnIfNotFound)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("UReplicationGraphNode_XAxisGrid::NotifyRemoveNetworkActor - %s is not in the grid."),
+			*GetNameSafe(ActorInfo.Actor)
+		);
+	}
+	return false;
+}
+
+/**
+ * Empties every cell and forgets which cell each actor was in.
+ */
+void UReplicationGraphNode_XAxisGrid::NotifyResetAllNetworkActors()
+{
+	Super::NotifyResetAllNetworkActors();
+
+	this->Cells.Reset();
+	this->StaticActorCells.Reset();
+	this->DynamicActorCells.Reset();
+}
+
+/**
+ * Moves each dynamic actor whose X location crossed into another cell since the last replication frame.
+ */
+void UReplicationGraphNode_XAxisGrid::PrepareForReplication()
+{
+	for (TPair<FActorRepListType, int32>& DynamicActorCell : this->DynamicActorCells)
+	{
+		AActor* Actor = DynamicActorCell.Key;
+		const int32 NewCellIndex = this->GetCellIndex(Actor->GetActorLocation().X);
+		if (NewCellIndex == DynamicActorCell.Value) continue;
+
+		if (FActorRepListRefView* OldCell = this->Cells.Find(DynamicActorCell.Value))
+		{
+			OldCell->RemoveFast(Actor);
+		}
+		this->Cells.FindOrAdd(NewCellIndex).Add(Actor);
+		DynamicActorCell.Value = NewCellIndex;
+	}
+}
+
+/**
+ * Gathers the cells around each viewer of the connection. Off-screen cells are only gathered on every
+ * OffScreenGatherPeriod-th frame, staggered by connection so they do not all land on the same frame.
+ *
+ * A connection whose pawn spectates another player also gathers the cells around that player. The server normally
+ * learns the spectator's camera location from the client, but that lags behind while the camera blends over, and the
+ * spectated player must be replicated before the client's camera can follow it at all.
+ *
+ * @param Params The connection's viewers and the lists to gather into.
+ */
+void UReplicationGraphNode_XAxisGrid::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	const uint32 ConnectionStagger = PointerHash(&Params.ConnectionManager);
+	const uint32 GatherPeriod = static_cast<uint32>(FMath::Max(this->OffScreenGatherPeriod, 1));
+	const double HalfWidth = (Params.ReplicationFrameNum + ConnectionStagger) % GatherPeriod == 0
+		? this->ViewHalfWidth
+		: FMath::Min(this->ScreenHalfWidth, this->ViewHalfWidth);
+
+	TArray<const FActorRepListRefView*> GatheredLists;
+	TArray<int32, TInlineAllocator<16>> GatheredCells;
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		this->GatherCellsAround(Viewer.ViewLocation.X, HalfWidth, GatheredLists, GatheredCells);
+
+		const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer);
+		const APC_PlayerFox* PlayerFox = PlayerController ? Cast<APC_PlayerFox>(PlayerController->GetPawn()) : nullptr;
+		if (PlayerFox == nullptr) continue;
+
+		if (const APC_PlayerFox* SpectatedPlayer = PlayerFox->GetPlayerBeingSpectated())
+		{
+			this->GatherCellsAround(SpectatedPlayer->GetActorLocation().X, HalfWidth, GatheredLists, GatheredCells);
+		}
+	}
+
+	for (const FActorRepListRefView* GatheredList : GatheredLists)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(*GatheredList);
+	}
+}
+
+/**
+ * Puts the actor into the cell of its spawn location for good.
+ *
+ * @param ActorInfo The actor being added.
+ */
+void UReplicationGraphNode_XAxisGrid::AddActor_Static(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const int32 CellIndex = this->GetCellIndex(ActorInfo.Actor->GetActorLocation().X);
+	this->Cells.FindOrAdd(CellIndex).Add(ActorInfo.Actor);
+	this->StaticActorCells.Add(ActorInfo.Actor, CellIndex);
+}
+
+/**
+ * Puts the actor into the cell of its current location and tracks it, so PrepareForReplication can move it.
+ *
+ * @param ActorInfo The actor being added.
+ */
+void UReplicationGraphNode_XAxisGrid::AddActor_Dynamic(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const int32 CellIndex = this->GetCellIndex(ActorInfo.Actor->GetActorLocation().X);
+	this->Cells.FindOrAdd(CellIndex).Add(ActorInfo.Actor);
+	this->DynamicActorCells.Add(ActorInfo.Actor, CellIndex);
+}
+
+/**
+ * Collects the non-empty cells that overlap [X - HalfWidth, X + HalfWidth] and were not gathered yet.
+ *
+ * @param X The X location of the viewer.
+ * @param HalfWidth How far to either side of X to gather.
+ * @param OutLists The actor lists of the newly gathered cells are appended to this array.
+ * @param InOutGatheredCells The indices of the cells gathered so far.
+ */
+void UReplicationGraphNode_XAxisGrid::GatherCellsAround(
+	const double X,
+	const double HalfWidth,
+	TArray<const FActorRepListRefView*>& OutLists,
+	TArray<int32, TInlineAllocator<16>>& InOutGatheredCells
+) const
+{
+	const int32 FirstCellIndex = this->GetCellIndex(X - HalfWidth);
+	const int32 LastCellIndex = this->GetCellIndex(X + HalfWidth);
+	for (int32 CellIndex = FirstCellIndex; CellIndex <= LastCellIndex; ++CellIndex)
+	{
+		if (InOutGatheredCells.Contains(CellIndex)) continue;
+		InOutGatheredCells.Add(CellIndex);
+
+		const FActorRepListRefView* Cell = this->Cells.Find(CellIndex);
+		if (Cell != nullptr && Cell->Num() > 0)
+		{
+			OutLists.Add(Cell);
+		}
+	}
+}
+
+/**
+ * Gets the index of the cell the given X location falls into.
+ *
+ * @param X The X location.
+ * @return The cell index.
+ */
+int32 UReplicationGraphNode_XAxisGrid::GetCellIndex(const double X) const
+{
+	return FMath::FloorToInt32(X / this->CellSize);
+}
+
+/**
+ * Binds the replication driver factory, so the game net driver of every hosted game gets a replication graph.
+ */
+void USideScrollerReplicationGraph::RegisterReplicationDriver()
+{
+	UReplicationDriver::CreateReplicationDriverDelegate().BindLambda(
+		[](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+		{
+			if (ForNetDriver == nullptr || ForNetDriver->NetDriverName != NAME_GameNetDriver) return nullptr;
+			if (SideScrollerReplicationGraph::EnableRepGraph == 0) return nullptr;
+
+			return NewObject<USideScrollerReplicationGraph>(GetTransientPackage());
+		}
+	);
+}
+
+/**
+ * Sets up the replication frequency, starvation priority and routing policy of every replicated actor class that is
+ * loaded. The NetPriority of a class scales how fast its actors climb the priority order while they are starved.
+ *
+ * Classes loaded later, like most Blueprints, are looked up through their parent classes. No cull distance is set:
+ * the X-axis grid already decides which actors are near a connection, and a distance cull from the connection's own
+ * view location would drop the actors around the player it is spectating.
+ */
+void USideScrollerReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	FClassReplicationInfo DefaultClassInfo;
+	DefaultClassInfo.ReplicationPeriodFrame = this->GetReplicationPeriodFrameForFrequency(
+		GetDefault<AActor>()->NetUpdateFrequency
+	);
+	this->GlobalActorReplicationInfoMap.SetClassInfo(AActor::StaticClass(), DefaultClassInfo);
+	this->ClassRepPolicies.Set(AActor::StaticClass(), ESideScrollerClassRepPolicy::Spatialize_Dynamic);
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (ActorCDO == nullptr || !ActorCDO->GetIsReplicated()) continue;
+
+		// Skip the skeleton and reinstanced classes the editor keeps around while compiling Blueprints.
+		const FString ClassName = Class->GetName();
+		if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_"))) continue;
+
+		this->ClassRepPolicies.Set(Class, GetClassRepPolicy(ActorCDO));
+
+		FClassReplicationInfo ClassInfo;
+		ClassInfo.ReplicationPeriodFrame = this->GetReplicationPeriodFrameForFrequency(ActorCDO->NetUpdateFrequency);
+		ClassInfo.StarvedPriorityScale = ActorCDO->NetPriority;
+		this->GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+/**
+ * Creates the X-axis grid, configured from DefaultGame.ini, and the list of actors relevant to all connections.
+ */
+void USideScrollerReplicationGraph::InitGlobalGraphNodes()
+{
+	Super::InitGlobalGraphNodes();
+
+	this->XAxisGridNode = this->CreateNewNode<UReplicationGraphNode_XAxisGrid>();
+	this->XAxisGridNode->CellSize = FMath::Max(this->XAxisCellSize, 1.f);
+	this->XAxisGridNode->ViewHalfWidth = FMath::Max(this->XAxisViewHalfWidth, 0.f);
+	this->XAxisGridNode->ScreenHalfWidth = FMath::Max(this->XAxisScreenHalfWidth, 0.f);
+	this->XAxisGridNode->OffScreenGatherPeriod = FMath::Clamp(this->XAxisOffScreenGatherPeriod, 1, 3);
+	this->AddGlobalGraphNode(this->XAxisGridNode);
+
+	this->AlwaysRelevantNode = this->CreateNewNode<UReplicationGraphNode_ActorList>();
+	this->AddGlobalGraphNode(this->AlwaysRelevantNode);
+}
+
+/**
+ * Adds the node that keeps the connection's own player controller, pawn and view target relevant to it.
+ *
+ * @param ConnectionManager The new connection.
+ */
+void USideScrollerReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager)
+{
+	Super::InitConnectionGraphNodes(ConnectionManager);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode =
+		this->CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	this->AddConnectionGraphNode(AlwaysRelevantForConnectionNode, ConnectionManager);
+}
+
+/**
+ * Adds the actor to the always relevant list or the X-axis grid, depending on its routing policy. Spatialized actors
+ * also get an adaptive replication rate.
+ *
+ * @param ActorInfo The actor being added.
+ * @param GlobalInfo The actor's global replication info.
+ */
+void USideScrollerReplicationGraph::RouteAddNetworkActorToNodes(
+	const FNewReplicatedActorInfo& ActorInfo,
+	FGlobalActorReplicationInfo& GlobalInfo
+)
+{
+	const ESideScrollerClassRepPolicy RepPolicy = this->GetRepPolicy(ActorInfo.Actor);
+	switch (RepPolicy)
+	{
+	case ESideScrollerClassRepPolicy::NotRouted:
+		break;
+	case ESideScrollerClassRepPolicy::RelevantAllConnections:
+		this->AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case ESideScrollerClassRepPolicy::Spatialize_Static:
+		this->XAxisGridNode->AddActor_Static(ActorInfo);
+		break;
+	case ESideScrollerClassRepPolicy::Spatialize_Dynamic:
+		this->XAxisGridNode->AddActor_Dynamic(ActorInfo);
+		break;
+	}
+
+	if (RepPolicy == ESideScrollerClassRepPolicy::Spatialize_Static
+		|| RepPolicy == ESideScrollerClassRepPolicy::Spatialize_Dynamic)
+	{
+		FAdaptiveRateState& AdaptiveRateState = this->AdaptiveRateStates.Add(ActorInfo.Actor);
+		AdaptiveRateState.LastLocation = ActorInfo.Actor->GetActorLocation();
+		AdaptiveRateState.LastChangeTime = GetWorld()->GetTimeSeconds();
+	}
+}
+
+/**
+ * Removes the actor from the node its routing policy added it to.
+ *
+ * @param ActorInfo The actor being removed.
+ */
+void USideScrollerReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (this->GetRepPolicy(ActorInfo.Actor))
+	{
+	case ESideScrollerClassRepPolicy::NotRouted:
+		break;
+	case ESideScrollerClassRepPolicy::RelevantAllConnections:
+		this->AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case ESideScrollerClassRepPolicy::Spatialize_Static:
+	case ESideScrollerClassRepPolicy::Spatialize_Dynamic:
+		this->XAxisGridNode->NotifyRemoveNetworkActor(ActorInfo);
+		this->AdaptiveRateStates.Remove(ActorInfo.Actor);
+		break;
+	}
+}
+
+/**
+ * Adapts the replication period of each actor before the frame's replication.
+ *
+ * @param DeltaSeconds Time since the last replication frame.
+ * @return The number of actors replicated.
+ */
+int32 USideScrollerReplicationGraph::ServerReplicateActors(const float DeltaSeconds)
+{
+	this->UpdateAdaptiveReplicationPeriods();
+	return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+/**
+ * Resets the nodes and forgets the adaptive rate state of the actors they held.
+ */
+void USideScrollerReplicationGraph::ResetGameWorldState()
+{
+	Super::ResetGameWorldState();
+	this->AdaptiveRateStates.Reset();
+}
+
+/**
+ * Returns the X-axis grid node.
+ *
+ * @return The grid node, or nullptr before the global nodes were created.
+ */
+const UReplicationGraphNode_XAxisGrid* USideScrollerReplicationGraph::GetXAxisGridNode() const
+{
+	return this->XAxisGridNode;
+}
+
+/**
+ * Lerps the replication frequency of each awake spatialized actor from its NetUpdateFrequency down to its
+ * MinNetUpdateFrequency while it stays idle, and snaps it back up when it moves or forces a net update.
+ *
+ * A new period is written to the actor's global info, for connections that open a channel to it later, and to the
+ * per-connection info of every connection that already has one. When the rate goes up, a connection waiting on the
+ * old, longer period is pulled in to the new one.
+ */
+void USideScrollerReplicationGraph::UpdateAdaptiveReplicationPeriods()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (TPair<FActorRepListType, FAdaptiveRateState>& AdaptiveRateState : this->AdaptiveRateStates)
+	{
+		AActor* Actor = AdaptiveRateState.Key;
+		FAdaptiveRateState& State = AdaptiveRateState.Value;
+		if (Actor->NetDormancy > DORM_Awake) continue;
+
+		FGlobalActorReplicationInfo* GlobalInfo = this->GlobalActorReplicationInfoMap.Find(Actor);
+		if (GlobalInfo == nullptr) continue;
+
+		const FVector Location = Actor->GetActorLocation();
+		if (GlobalInfo->ForceNetUpdateFrame != State.LastForceNetUpdateFrame
+			|| !Location.Equals(State.LastLocation, this->AdaptiveMovementTolerance))
+		{
+			State.LastChangeTime = Now;
+		}
+		State.LastLocation = Location;
+		State.LastForceNetUpdateFrame = GlobalInfo->ForceNetUpdateFrame;
+
+		const double IdleTime = Now - State.LastChangeTime - this->AdaptiveIdleDelay;
+		const double BackoffAlpha = this->AdaptiveBackoffSeconds > 0.f
+			? FMath::Clamp(IdleTime / this->AdaptiveBackoffSeconds, 0.0, 1.0)
+			: (IdleTime > 0.0 ? 1.0 : 0.0);
+		const float MinFrequency = FMath::Min(Actor->MinNetUpdateFrequency, Actor->NetUpdateFrequency);
+		const float Frequency = FMath::Lerp(Actor->NetUpdateFrequency, MinFrequency, static_cast<float>(BackoffAlpha));
+
+		const uint16 Period = this->GetReplicationPeriodFrameForFrequency(Frequency);
+		if (Period == GlobalInfo->Settings.ReplicationPeriodFrame) continue;
+
+		const bool bSpeedUp = Period < GlobalInfo->Settings.ReplicationPeriodFrame;
+		GlobalInfo->Settings.ReplicationPeriodFrame = Period;
+		for (UNetReplicationGraphConnection* Connection : this->Connections)
+		{
+			FConnectionReplicationActorInfo* ConnectionInfo = Connection->ActorInfoMap.Find(Actor);
+			if (ConnectionInfo == nullptr) continue;
+
+			ConnectionInfo->ReplicationPeriodFrame = Period;
+			if (bSpeedUp)
+			{
+				ConnectionInfo->NextReplicationFrameNum = FMath::Min(
+					ConnectionInfo->NextReplicationFrameNum,
+					ConnectionInfo->LastRepFrameNum + Period
+				);
+			}
+		}
+	}
+}
+
+/**
+ * Picks the routing policy of the actor, letting its own relevancy flags win over the policy of its class.
+ *
+ * @param Actor The actor being routed.
+ * @return The actor's routing policy.
+ */
+ESideScrollerClassRepPolicy USideScrollerReplicationGraph::GetRepPolicy(const AActor* Actor)
+{
+	if (Actor->bAlwaysRelevant) return ESideScrollerClassRepPolicy::RelevantAllConnections;
+	if (Actor->bOnlyRelevantToOwner) return ESideScrollerClassRepPolicy::NotRouted;
+
+	const ESideScrollerClassRepPolicy* ClassRepPolicy = this->ClassRepPolicies.Get(Actor->GetClass());
+	return ClassRepPolicy != nullptr ? *ClassRepPolicy : ESideScrollerClassRepPolicy::Spatialize_Dynamic;
+}
+
+/**
+ * Picks the routing policy of a class:
+ * - Game state, player states and always relevant classes are relevant to all connections.
+ * - Owner-only classes, like player controllers, are not routed to a global node.
+ * - Pawns, projectiles, moving platforms and anything else that replicates movement is spatialized dynamically.
+ * - Everything else is spatialized statically.
+ *
+ * @param ActorCDO The class default object.
+ * @return The class's routing policy.
+ */
+ESideScrollerClassRepPolicy USideScrollerReplicationGraph::GetClassRepPolicy(const AActor* ActorCDO)
+{
+	if (ActorCDO->bAlwaysRelevant || ActorCDO->IsA<AGameStateBase>() || ActorCDO->IsA<APlayerState>())
+	{
+		return ESideScrollerClassRepPolicy::RelevantAllConnections;
+	}
+	if (ActorCDO->bOnlyRelevantToOwner || ActorCDO->IsA<APlayerController>())
+	{
+		return ESideScrollerClassRepPolicy::NotRouted;
+	}
+	if (ActorCDO->IsA<APawn>() || ActorCDO->IsA<ABaseProjectile>() || ActorCDO->IsA<AMovingPlatform>()
+		|| ActorCDO->IsReplicatingMovement())
+	{
+		return ESideScrollerClassRepPolicy::Spatialize_Dynamic;
+	}
+	return ESideScrollerClassRepPolicy::Spatialize_Static;
+}
@@ -0,0 +1,371 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "SideScrollerReplicationGraph.generated.h"
+
+/**
+ * @enum ESideScrollerClassRepPolicy
+ * @brief How USideScrollerReplicationGraph routes the actors of a class to its nodes.
+ */
+UENUM()
+enum class ESideScrollerClassRepPolicy : uint8
+{
+	/** Not added to a global node. Owner-only actors like player controllers reach their connection on their own. */
+	NotRouted,
+
+	/** Replicated to every connection, wherever it is: game state, player states and always relevant actors. */
+	RelevantAllConnections,
+
+	/** Bucketed once into the X-axis cell it was spawned in: pickups, interactables, climbables, triggers. */
+	Spatialize_Static,
+
+	/** Re-bucketed every replication frame as it moves: characters, projectiles and moving platforms. */
+	Spatialize_Dynamic,
+};
+
+/**
+ * @class UReplicationGraphNode_XAxisGrid
+ * @brief A 1D spatial grid that buckets actors into cells along the X axis.
+ *
+ * Every level plays out on the X-Z plane and is many times wider than it is tall, so a 2D grid would put almost all
+ * of a level in one row. This node instead cuts the level into CellSize wide slices along X. Static actors are put in
+ * their cell once, dynamic actors are moved between cells in PrepareForReplication, and each connection only gathers
+ * the cells within ViewHalfWidth of its viewers. A connection whose pawn is spectating another player also gathers
+ * the cells around the spectated player, so the world around the camera stays replicated while its own dead pawn
+ * lies somewhere else.
+ *
+ * Cells within ScreenHalfWidth of a viewer are on screen and gathered every replication frame. The cells further out
+ * are only gathered every OffScreenGatherPeriod frames, staggered between connections, so a connection's bandwidth
+ * goes to what its player can see first while off-screen actors keep their channels open.
+ *
+ * @see USideScrollerReplicationGraph
+ */
+UCLASS()
+class SIDESCROLLER_API UReplicationGraphNode_XAxisGrid : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Makes the graph call PrepareForReplication once per replication frame.
+	 */
+	UReplicationGraphNode_XAxisGrid();
+
+	/**
+	 * @brief Adds the actor as a dynamic actor. Use AddActor_Static for actors that never move.
+	 *
+	 * @param ActorInfo The actor being added.
+	 */
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	/**
+	 * @brief Removes the actor from the cell it is in, whether it was added as static or dynamic.
+	 *
+	 * @param ActorInfo The actor being removed.
+	 * @param bWarnIfNotFound Whether to log a warning if the actor is not in the grid.
+	 * @return True if the actor was found and removed.
+	 */
+	virtual bool NotifyRemoveNetworkActor(
+		const FNewReplicatedActorInfo& ActorInfo,
+		bool bWarnIfNotFound = true
+	) override;
+
+	/**
+	 * @brief Empties every cell.
+	 */
+	virtual void NotifyResetAllNetworkActors() override;
+
+	/**
+	 * @brief Moves the dynamic actors that crossed a cell border into their new cell.
+	 */
+	virtual void PrepareForReplication() override;
+
+	/**
+	 * @brief Adds the cells around each viewer of the connection, and around the player it spectates, to the lists.
+	 *
+	 * @param Params The connection's viewers and the lists to gather into.
+	 */
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/**
+	 * @brief Puts an actor that does not move into the cell of its spawn location.
+	 *
+	 * @param ActorInfo The actor being added.
+	 */
+	void AddActor_Static(const FNewReplicatedActorInfo& ActorInfo);
+
+	/**
+	 * @brief Puts a moving actor into the cell of its current location and keeps it updated as it moves.
+	 *
+	 * @param ActorInfo The actor being added.
+	 */
+	void AddActor_Dynamic(const FNewReplicatedActorInfo& ActorInfo);
+
+	/**
+	 * @brief Collects the cells within HalfWidth of the given X location.
+	 *
+	 * Cells already in InOutGatheredCells are skipped, so viewers that see overlapping cells gather each cell once.
+	 *
+	 * @param X The X location of the viewer.
+	 * @param HalfWidth How far to either side of X to gather.
+	 * @param OutLists The actor lists of the newly gathered cells are appended to this array.
+	 * @param InOutGatheredCells The indices of the cells gathered so far.
+	 */
+	void GatherCellsAround(
+		double X,
+		double HalfWidth,
+		TArray<const FActorRepListRefView*>& OutLists,
+		TArray<int32, TInlineAllocator<16>>& InOutGatheredCells
+	) const;
+
+	/**
+	 * @brief The width of one cell along X, in Unreal units.
+	 */
+	float CellSize = 2048.f;
+
+	/**
+	 * @brief How far along X, to either side of a viewer, actors are relevant to it.
+	 */
+	float ViewHalfWidth = 4096.f;
+
+	/**
+	 * @brief How far along X, to either side of a viewer, actors are on screen and gathered every frame.
+	 */
+	float ScreenHalfWidth = 1024.f;
+
+	/**
+	 * @brief Every how many replication frames the off-screen cells are gathered. Kept below the number of frames
+	 * after which the graph closes the channel of an actor that is no longer gathered.
+	 */
+	int32 OffScreenGatherPeriod = 2;
+
+private:
+	/**
+	 * @brief Gets the index of the cell the given X location falls into.
+	 *
+	 * @param X The X location.
+	 * @return The cell index. Negative X locations get negative indices.
+	 */
+	int32 GetCellIndex(double X) const;
+
+	/**
+	 * @brief The actors in each cell, keyed by cell index. Cells are only created once an actor lands in them.
+	 */
+	TMap<int32, FActorRepListRefView> Cells;
+
+	/**
+	 * @brief The cell each static actor was put into.
+	 */
+	TMap<FActorRepListType, int32> StaticActorCells;
+
+	/**
+	 * @brief The cell each dynamic actor was in during the last PrepareForReplication.
+	 */
+	TMap<FActorRepListType, int32> DynamicActorCells;
+};
+
+/**
+ * @class USideScrollerReplicationGraph
+ * @brief The replication graph of the game net driver.
+ *
+ * Without a replication graph the net driver asks every replicated actor whether it is relevant to every connection,
+ * every frame, which grows with actors times connections. This graph routes each actor once when it is added:
+ * - Game state, player states and always relevant actors go to a list that every connection gathers.
+ * - Owner-only actors, like player controllers, are gathered by their own connection only.
+ * - Everything else goes into a UReplicationGraphNode_XAxisGrid, so a connection only gathers the few cells around
+ *   its view (or around the player it spectates) instead of the whole level.
+ *
+ * Replication rates adapt per actor. Each awake spatialized actor replicates at its NetUpdateFrequency while it moves
+ * or calls ForceNetUpdate, and backs off to its MinNetUpdateFrequency once it has been idle for a while. Its
+ * NetPriority scales how quickly it climbs the priority order while it is starved of bandwidth. Dormant actors are
+ * left alone; they only replicate when they flush their dormancy. The bandwidth of each connection is capped by the
+ * net driver's MaxClientRate and MaxInternetClientRate in DefaultEngine.ini; once a connection is saturated, the rest
+ * of its actors wait for a later frame in priority order, with on-screen actors gathered first.
+ *
+ * The graph is only created for the game net driver; the server info beacons share its net driver class but keep
+ * the default replication. The grid and adaptive rate settings are read from the
+ * [/Script/SideScroller.SideScrollerReplicationGraph] section of DefaultGame.ini, and "SideScroller.RepGraph.Enable 0"
+ * falls back to the default replication for games hosted after it is set.
+ *
+ * @see FRepGraphBenchmark
+ */
+UCLASS(Transient, Config = Game)
+class SIDESCROLLER_API USideScrollerReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Has every game net driver created from now on use this replication graph.
+	 *
+	 * Called once by the game instance. Net drivers that are not the game net driver are left alone.
+	 */
+	static void RegisterReplicationDriver();
+
+	/**
+	 * @brief Sets the replication frequency of every replicated actor class and which node its actors go to.
+	 */
+	virtual void InitGlobalActorClassSettings() override;
+
+	/**
+	 * @brief Creates the X-axis grid and the list of actors relevant to all connections.
+	 */
+	virtual void InitGlobalGraphNodes() override;
+
+	/**
+	 * @brief Creates the node that gathers the connection's own always relevant actors.
+	 *
+	 * @param ConnectionManager The new connection.
+	 */
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager) override;
+
+	/**
+	 * @brief Adds a newly replicated actor to the node its policy routes it to.
+	 *
+	 * @param ActorInfo The actor being added.
+	 * @param GlobalInfo The actor's global replication info.
+	 */
+	virtual void RouteAddNetworkActorToNodes(
+		const FNewReplicatedActorInfo& ActorInfo,
+		FGlobalActorReplicationInfo& GlobalInfo
+	) override;
+
+	/**
+	 * @brief Removes an actor that stopped replicating from the node its policy routed it to.
+	 *
+	 * @param ActorInfo The actor being removed.
+	 */
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	/**
+	 * @brief Adapts the replication rate of each actor to its recent changes, then replicates to all connections.
+	 *
+	 * @param DeltaSeconds Time since the last replication frame.
+	 * @return The number of actors replicated.
+	 */
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	/**
+	 * @brief Forgets every actor's adaptive rate state along with the nodes' actors, e.g. on seamless travel.
+	 */
+	virtual void ResetGameWorldState() override;
+
+	/**
+	 * @brief Gets the X-axis grid node, e.g. for the replication graph benchmark.
+	 *
+	 * @return The grid node, or nullptr before the global nodes were created.
+	 */
+	const UReplicationGraphNode_XAxisGrid* GetXAxisGridNode() const;
+
+protected:
+	/**
+	 * @brief The width of one X-axis grid cell, in Unreal units.
+	 */
+	UPROPERTY(Config)
+	float XAxisCellSize = 2048.f;
+
+	/**
+	 * @brief How far along X, to either side of a viewer, spatialized actors are relevant to it.
+	 */
+	UPROPERTY(Config)
+	float XAxisViewHalfWidth = 4096.f;
+
+	/**
+	 * @brief How far along X, to either side of a viewer, spatialized actors are on screen.
+	 */
+	UPROPERTY(Config)
+	float XAxisScreenHalfWidth = 1024.f;
+
+	/**
+	 * @brief Every how many replication frames the off-screen cells are gathered, from 1 to 3.
+	 */
+	UPROPERTY(Config)
+	int32 XAxisOffScreenGatherPeriod = 2;
+
+	/**
+	 * @brief Seconds an actor has to be idle before its replication rate starts backing off.
+	 */
+	UPROPERTY(Config)
+	float AdaptiveIdleDelay = 0.5f;
+
+	/**
+	 * @brief Seconds it takes an idle actor to back off from its NetUpdateFrequency to its MinNetUpdateFrequency.
+	 */
+	UPROPERTY(Config)
+	float AdaptiveBackoffSeconds = 2.f;
+
+	/**
+	 * @brief How far, in Unreal units, an actor has to move between replication frames to count as changed.
+	 */
+	UPROPERTY(Config)
+	float AdaptiveMovementTolerance = 1.f;
+
+private:
+	/**
+	 * @struct FAdaptiveRateState
+	 * @brief What the adaptive replication rate of one actor is based on.
+	 */
+	struct FAdaptiveRateState
+	{
+		/** The actor's location during the last replication frame. */
+		FVector LastLocation = FVector::ZeroVector;
+
+		/** The ForceNetUpdateFrame of the actor's global replication info during the last replication frame. */
+		uint32 LastForceNetUpdateFrame = 0;
+
+		/** World time at which the actor last moved or forced a net update. */
+		double LastChangeTime = 0.0;
+	};
+
+	/**
+	 * @brief Sets the replication period of every awake spatialized actor from how long it has been idle.
+	 *
+	 * An actor that changed goes back to its NetUpdateFrequency at once, and connections that were waiting out a
+	 * longer period get it on the next frame that period allows.
+	 */
+	void UpdateAdaptiveReplicationPeriods();
+
+	/**
+	 * @brief Picks the node the given actor is routed to.
+	 *
+	 * Per-actor flags like bAlwaysRelevant, which Blueprints may change from their native class, win over the
+	 * policy of the class.
+	 *
+	 * @param Actor The actor being routed.
+	 * @return The actor's routing policy.
+	 */
+	ESideScrollerClassRepPolicy GetRepPolicy(const AActor* Actor);
+
+	/**
+	 * @brief Picks the routing policy of a class from its class default object.
+	 *
+	 * @param ActorCDO The class default object.
+	 * @return The class's routing policy.
+	 */
+	static ESideScrollerClassRepPolicy GetClassRepPolicy(const AActor* ActorCDO);
+
+	/**
+	 * @brief The routing policy of each replicated class, looked up through the class hierarchy.
+	 */
+	TClassMap<ESideScrollerClassRepPolicy> ClassRepPolicies;
+
+	/**
+	 * @brief The adaptive rate state of every spatialized actor.
+	 */
+	TMap<FActorRepListType, FAdaptiveRateState> AdaptiveRateStates;
+
+	/**
+	 * @brief The X-axis grid that spatialized actors are bucketed into.
+	 */
+	UPROPERTY()
+	UReplicationGraphNode_XAxisGrid* XAxisGridNode;
+
+	/**
+	 * @brief The actors replicated to every connection.
+	 */
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+};
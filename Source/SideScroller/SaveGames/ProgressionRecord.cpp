@@ -0,0 +1,224 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ProgressionRecord.h"
+
+#include <atomic>
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/**
+	 * @brief Tag written at the start of every progression file ('SSPR').
+	 */
+	constexpr uint32 ProgressionFileMagic = 0x53535052;
+
+	/**
+	 * @brief Guards the temp file write and move so that only one progression write touches the disk at a time.
+	 */
+	FCriticalSection ProgressionWriteLock;
+
+	/**
+	 * @brief Sequence number handed out to every SaveAsync call.
+	 */
+	std::atomic<uint64> ProgressionWriteSequence{0};
+
+	/**
+	 * @brief Sequence number of the newest write that made it to disk. Only accessed under ProgressionWriteLock.
+	 */
+	uint64 LastWrittenSequence = 0;
+
+	/**
+	 * @brief Serializes a counter as a packed unsigned integer. Counters are never negative.
+	 *
+	 * @param Ar The archive to read from or write to.
+	 * @param Value The counter to serialize.
+	 */
+	void SerializeCounter(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = static_cast<uint32>(FMath::Max(Value, 0));
+		Ar.SerializeIntPacked(Packed);
+		Value = static_cast<int32>(FMath::Min<uint32>(Packed, MAX_int32));
+	}
+}
+
+/**
+ * Serializes the record in the layout of the given version.
+ *
+ * @param Ar The archive to read from or write to.
+ * @param Version The layout version of the data in Ar.
+ */
+void FProgressionRecord::Serialize(FArchive& Ar, uint16 Version)
+{
+	SerializeCounter(Ar, Points);
+	SerializeCounter(Ar, Lives);
+	SerializeCounter(Ar, Cherries);
+	SerializeCounter(Ar, Money);
+
+	uint8 LevelByte = static_cast<uint8>(FMath::Clamp(Level, 0, 255));
+	Ar << LevelByte;
+	Level = LevelByte;
+
+	uint8 HasCheckpointByte = bHasCheckpoint ? 1 : 0;
+	Ar << HasCheckpointByte;
+	bHasCheckpoint = HasCheckpointByte != 0;
+	if (bHasCheckpoint)
+	{
+		// level coordinates are far inside float precision, so there is no need to store doubles
+		FVector3f CompactCheckpoint(Checkpoint);
+		Ar << CompactCheckpoint;
+		Checkpoint = FVector(CompactCheckpoint);
+	}
+}
+
+/**
+ * Gets the path of the progression file for a profile slot, next to the profile's own save game file.
+ *
+ * @param ProfileSlot The name of the player profile save game slot.
+ * @return The absolute path of the progression file.
+ */
+FString FProgressionRecordFile::GetFilePath(const FString& ProfileSlot)
+{
+	return FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectSavedDir() / TEXT("SaveGames") / ProfileSlot + TEXT("_Progression.bin")
+	);
+}
+
+/**
+ * Writes the record to memory: the magic tag, the layout version, then the record itself.
+ *
+ * @param Record The record to write.
+ * @param OutBytes The bytes to write the record into.
+ */
+void FProgressionRecordFile::WriteToBytes(const FProgressionRecord& Record, TArray<uint8>& OutBytes)
+{
+	FMemoryWriter Writer(OutBytes);
+	uint32 Magic = ProgressionFileMagic;
+	uint16 Version = CurrentVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	FProgressionRecord RecordCopy = Record;
+	RecordCopy.Serialize(Writer, Version);
+}
+
+/**
+ * Reads a record from bytes written by WriteToBytes, rejecting foreign, newer or truncated data.
+ *
+ * @param Bytes The bytes to read.
+ * @param OutRecord The record read from Bytes.
+ * @return True if a record was read.
+ */
+bool FProgressionRecordFile::ReadFromBytes(const TArray<uint8>& Bytes, FProgressionRecord& OutRecord)
+{
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+
+	if (Reader.IsError() || Magic != ProgressionFileMagic)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FProgressionRecordFile::ReadFromBytes - Not a progression record."));
+		return false;
+	}
+
+	if (Version == 0 || Version > CurrentVersion)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("FProgressionRecordFile::ReadFromBytes - Unsupported progression record version %i."), Version
+		);
+		return false;
+	}
+
+	FProgressionRecord Record;
+	Record.Serialize(Reader, Version);
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FProgressionRecordFile::ReadFromBytes - Progression record is truncated."));
+		return false;
+	}
+
+	OutRecord = Record;
+	return true;
+}
+
+/**
+ * Serializes and writes the record on the thread pool, through a temporary file that is moved into place.
+ *
+ * @param Record The record to write.
+ * @param FilePath The path of the progression file.
+ * @return A future that is set to whether the record ended up on disk.
+ */
+TFuture<bool> FProgressionRecordFile::SaveAsync(const FProgressionRecord& Record, const FString& FilePath)
+{
+	const uint64 Sequence = ++ProgressionWriteSequence;
+
+	return Async(EAsyncExecution::ThreadPool, [Record, FilePath, Sequence]()
+	{
+		TArray<uint8> Bytes;
+		WriteToBytes(Record, Bytes);
+
+		FScopeLock Lock(&ProgressionWriteLock);
+		if (Sequence < LastWrittenSequence)
+		{
+			// a newer record is already on disk
+			return false;
+		}
+
+		const FString TempFilePath = FilePath + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilePath))
+		{
+			UE_LOG(LogTemp, Warning,
+				TEXT("FProgressionRecordFile::SaveAsync - Could not write %s."), *TempFilePath
+			);
+			return false;
+		}
+
+		if (!IFileManager::Get().Move(*FilePath, *TempFilePath, true, true))
+		{
+			UE_LOG(LogTemp, Warning,
+				TEXT("FProgressionRecordFile::SaveAsync - Could not move %s into place."), *TempFilePath
+			);
+			IFileManager::Get().Delete(*TempFilePath);
+			return false;
+		}
+
+		LastWrittenSequence = Sequence;
+		return true;
+	});
+}
+
+/**
+ * Reads and deserializes the record on the thread pool.
+ *
+ * @param FilePath The path of the progression file.
+ * @return A future holding the record, or an unset optional if there is no valid record on disk.
+ */
+TFuture<TOptional<FProgressionRecord>> FProgressionRecordFile::LoadAsync(const FString& FilePath)
+{
+	return Async(EAsyncExecution::ThreadPool, [FilePath]() -> TOptional<FProgressionRecord>
+	{
+		TArray<uint8> Bytes;
+		{
+			FScopeLock Lock(&ProgressionWriteLock);
+			if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+			{
+				return {};
+			}
+		}
+
+		FProgressionRecord Record;
+		if (!ReadFromBytes(Bytes, Record))
+		{
+			return {};
+		}
+		return Record;
+	});
+}
@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "ProgressionRecord.generated.h"
+
+/**
+ * @brief A snapshot of a player's progress through the game.
+ *
+ * The record is kept deliberately small and is written to disk in a compact, versioned binary layout by
+ * FProgressionRecordFile (see Serialize below), rather than through the tagged property serialization that
+ * USaveGame uses. It is stored next to the player profile, one file per profile slot.
+ */
+USTRUCT(BlueprintType)
+struct FProgressionRecord
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The points the player has accumulated.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	int32 Points = 0;
+
+	/**
+	 * @brief The number of lives the player has left.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	int32 Lives = 0;
+
+	/**
+	 * @brief The number of cherries in the player's stash.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	int32 Cherries = 0;
+
+	/**
+	 * @brief The amount of money in the player's stash.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	int32 Money = 0;
+
+	/**
+	 * @brief The level the player is on (or is about to start, when saved on level completion).
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	int32 Level = 0;
+
+	/**
+	 * @brief Whether Checkpoint holds a checkpoint location; false means the player starts at the level start.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	bool bHasCheckpoint = false;
+
+	/**
+	 * @brief The location of the last checkpoint the player reached in Level.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Progression")
+	FVector Checkpoint = FVector::ZeroVector;
+
+	/**
+	 * @brief Serializes the record in its compact binary layout.
+	 *
+	 * Counters are written as packed unsigned integers, the level and flags as single bytes and the checkpoint as a
+	 * single precision vector, so a typical record is only a couple of dozen bytes. Fields added in later layout
+	 * versions must only be serialized when Version is new enough to contain them.
+	 *
+	 * @param Ar The archive to read from or write to.
+	 * @param Version The layout version of the data in Ar.
+	 */
+	void Serialize(FArchive& Ar, uint16 Version);
+};
+
+/**
+ * @brief Reads and writes FProgressionRecord files.
+ *
+ * Writes are handed to the thread pool: the record is copied on the calling thread, and the serialization and file
+ * I/O happen on a worker, so saving never stalls the game thread. Every write goes to a temporary file first which
+ * is then moved over the real file, so a crash or power loss mid-write leaves the previous record intact. Writes
+ * are ordered; if an older write finishes after a newer one it is discarded instead of overwriting newer progress.
+ */
+class SIDESCROLLER_API FProgressionRecordFile
+{
+public:
+	/**
+	 * @brief The current version of the binary layout. Bump it whenever fields are added to FProgressionRecord.
+	 */
+	static constexpr uint16 CurrentVersion = 1;
+
+	/**
+	 * @brief Gets the path of the progression file belonging to the given profile slot.
+	 *
+	 * @param ProfileSlot The name of the player profile save game slot.
+	 * @return The absolute path of the progression file.
+	 */
+	static FString GetFilePath(const FString& ProfileSlot);
+
+	/**
+	 * @brief Serializes and writes the record on a worker thread.
+	 *
+	 * @param Record The record to write. It is copied before this function returns.
+	 * @param FilePath The path of the progression file.
+	 * @return A future that is set to whether the record ended up on disk.
+	 */
+	static TFuture<bool> SaveAsync(const FProgressionRecord& Record, const FString& FilePath);
+
+	/**
+	 * @brief Reads and deserializes the record on a worker thread.
+	 *
+	 * @param FilePath The path of the progression file.
+	 * @return A future holding the record, or an unset optional if there is no valid record on disk.
+	 */
+	static TFuture<TOptional<FProgressionRecord>> LoadAsync(const FString& FilePath);
+
+	/**
+	 * @brief Writes the record to memory in the versioned binary layout.
+	 *
+	 * @param Record The record to write.
+	 * @param OutBytes The bytes to write the record into.
+	 */
+	static void WriteToBytes(const FProgressionRecord& Record, TArray<uint8>& OutBytes);
+
+	/**
+	 * @brief Reads a record from bytes written by WriteToBytes.
+	 *
+	 * @param Bytes The bytes to read.
+	 * @param OutRecord The record read from Bytes.
+	 * @return False if the bytes are not a progression record, were written by a newer version, or are truncated.
+	 */
+	static bool ReadFromBytes(const TArray<uint8>& Bytes, FProgressionRecord& OutRecord);
+};
@@ -11,10 +11,11 @@ public class SideScroller : ModuleRules
 		bEnableExceptions = true;
 		
 		PublicDependencyModuleNames.AddRange(new string[] {
-			"Core", "CoreUObject", "Engine", "InputCore", "UMG", "AIModule", "OnlineSubsystem", "OnlineSubsystemSteam"
+			"Core", "CoreUObject", "Engine", "InputCore", "UMG", "AIModule", "OnlineSubsystem", "OnlineSubsystemSteam",
+			"OnlineSubsystemUtils", "ReplicationGraph"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore", "NetworkReplayStreaming" });
 		
 		// Uncomment if you are using online features
 		// PrivateDependencyModuleNames.Add("OnlineSubsystem");
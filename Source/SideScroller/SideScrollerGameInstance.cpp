@@ -7,16 +7,23 @@
 
 #include "OnlineSessionSettings.h"
 #include "OnlineSubsystem.h"
+#include "Async/Async.h"
+#include "Beacons/ServerInfoBeaconClient.h"
 #include "Blueprint/UserWidget.h"
+#include "DataAssets/CharacterRoster.h"
+#include "Engine/AssetManager.h"
 #include "Engine/Engine.h"
 #include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerState.h"
 #include "GameModes/LevelGameMode.h"
 #include "Interfaces/OnlineSessionInterface.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/PackageName.h"
 #include "MenuSystem/MainMenu.h"
 #include "MenuSystem/MenuWidget.h"
 #include "Online/OnlineSessionNames.h"
-#include "UObject/ConstructorHelpers.h"
+#include "Replication/SideScrollerReplicationGraph.h"
+#include "TimerManager.h"
 
 /**
  * @brief The name of the game session.
@@ -42,39 +49,45 @@ const static FName SERVER_NAME_SESSION_KEY = TEXT("CustomServerName");
 
 /**
  * Constructor for the USideScrollerGameInstance class.
- * Initializes the class by finding and setting the class references for various UserWidgets used in the game.
+ * Initializes the class by pointing the soft class references at the UserWidgets used in the game. The classes are
+ * loaded on first use by ShowMenu. The fallback character roster points at the player blueprints the same way.
  */
 USideScrollerGameInstance::USideScrollerGameInstance(const FObjectInitializer & ObjectInitializer)
 {
-	ConstructorHelpers::FClassFinder<UUserWidget> MainMenuBPClass(TEXT("/Game/MenuSystem/WBP_MainMenu"));
-	if (!MainMenuBPClass.Class) return;
-	MainMenuClass = MainMenuBPClass.Class;
-
-	ConstructorHelpers::FClassFinder<UUserWidget> InGameMenuBPClass(TEXT("/Game/MenuSystem/WBP_InGameMenu"));
-	if (!InGameMenuBPClass.Class) return;
-	InGameMenuClass = InGameMenuBPClass.Class;
-
-	ConstructorHelpers::FClassFinder<UUserWidget> RespawnMenuBPClass(TEXT("/Game/MenuSystem/WBP_RespawnMenu"));
-	if (!RespawnMenuBPClass.Class) return;
-	RespawnMenuClass = RespawnMenuBPClass.Class;
-
-	ConstructorHelpers::FClassFinder<UUserWidget> GameOverMenuBPClass(TEXT("/Game/MenuSystem/WBP_GameOverMenu"));
-	if (!GameOverMenuBPClass.Class) return;
-	GameOverMenuClass = GameOverMenuBPClass.Class;
-
-	ConstructorHelpers::FClassFinder<UUserWidget> GameCompleteCreditsBPClass(
-		TEXT("/Game/MenuSystem/WBP_GameCompleteCredits")
+	MainMenuClass = TSoftClassPtr<UUserWidget>(FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_MainMenu.WBP_MainMenu_C")));
+	InGameMenuClass = TSoftClassPtr<UUserWidget>(
+		FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_InGameMenu.WBP_InGameMenu_C"))
 	);
-	if (!GameCompleteCreditsBPClass.Class) return;
-	GameCompleteCreditsClass = GameCompleteCreditsBPClass.Class;
-
-	ConstructorHelpers::FClassFinder<UUserWidget> SelectCharacterMenuBPClass(
-		TEXT("/Game/MenuSystem/WBP_SelectCharacterMenu")
+	RespawnMenuClass = TSoftClassPtr<UUserWidget>(
+		FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_RespawnMenu.WBP_RespawnMenu_C"))
+	);
+	GameOverMenuClass = TSoftClassPtr<UUserWidget>(
+		FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_GameOverMenu.WBP_GameOverMenu_C"))
+	);
+	GameCompleteCreditsClass = TSoftClassPtr<UUserWidget>(
+		FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_GameCompleteCredits.WBP_GameCompleteCredits_C"))
 	);
-	if (!SelectCharacterMenuBPClass.Class) return;
-	SelectCharacterMenuClass = SelectCharacterMenuBPClass.Class;
+	SelectCharacterMenuClass = TSoftClassPtr<UUserWidget>(
+		FSoftObjectPath(TEXT("/Game/MenuSystem/WBP_SelectCharacterMenu.WBP_SelectCharacterMenu_C"))
+	);
+	CharacterRosterId = FPrimaryAssetId(UCharacterRoster::PrimaryAssetType, TEXT("DA_CharacterRoster"));
 
-	LoadGame();
+	FallbackCharacterRoster = CreateDefaultSubobject<UCharacterRoster>(TEXT("FallbackCharacterRoster"));
+	for (const TPair<const TCHAR*, const TCHAR*>& Character : {
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Pink"), TEXT("BP_PC_PlayerFox_Pink")),
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Orange"), TEXT("BP_PC_PlayerFox")),
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Yellow"), TEXT("BP_PC_PlayerFox_Yellow")),
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Green"), TEXT("BP_PC_PlayerFox_Green")),
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Blue"), TEXT("BP_PC_PlayerFox_Blue")),
+		TPair<const TCHAR*, const TCHAR*>(TEXT("Black"), TEXT("BP_PC_PlayerFox_Black"))
+	})
+	{
+		FCharacterRosterEntry& Entry = FallbackCharacterRoster->Characters.AddDefaulted_GetRef();
+		Entry.Color = Character.Key;
+		Entry.CharacterClass = TSoftClassPtr<APC_PlayerFox>(FSoftObjectPath(FString::Printf(
+			TEXT("/Game/Blueprints/Characters/Players/%s.%s_C"), Character.Value, Character.Value
+		)));
+	}
 }
 
 /**
@@ -82,6 +95,11 @@ USideScrollerGameInstance::USideScrollerGameInstance(const FObjectInitializer &
  */
 void USideScrollerGameInstance::Init()
 {
+	LoadGame();
+	LoadProgression();
+	LoadCharacterRoster();
+	USideScrollerReplicationGraph::RegisterReplicationDriver();
+
 	IOnlineSubsystem* Subsystem = IOnlineSubsystem::Get();
 	if (!Subsystem)
 	{
@@ -119,6 +137,7 @@ void USideScrollerGameInstance::LoadMainMenu()
 	APlayerController* PlayerController = GetFirstLocalPlayerController();
 	if (!PlayerController) return;
 	
+	ReleaseCharacterClasses();
 	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::LoadMainMenu - Loading MainMenu map."));
 	PlayerController->ClientTravel("/Game/Maps/Map_MainMenu", ETravelType::TRAVEL_Absolute);
 }
@@ -130,7 +149,8 @@ void USideScrollerGameInstance::LoadMainMenu()
  * from the current level to the Game Over menu. It first gets the current game mode using the
  * GetGameMode() function from the UGameplayStatics class and casts it to the AGameModeBase class.
  * If the cast is successful and the game mode is an instance of the ALevelGameMode class, it proceeds
- * to load the Game Over menu by calling the TravelToGameOverMenu() method of the LevelGameMode instance.
+ * to show the Game Over menu by calling the ShowGameOverMenu() method of the LevelGameMode instance. The level stays
+ * loaded so that restarting can reset it in place.
  * If the cast fails or the game mode is not a level game mode, a warning message is logged.
  *
  * @param None
@@ -145,8 +165,9 @@ void USideScrollerGameInstance::LoadGameOverMenu()
 		ALevelGameMode* LevelGameMode = Cast<ALevelGameMode>(CurrentGameMode);
 		if (LevelGameMode != nullptr)
 		{
-			UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::LoadGameOverMenu - Loading GameOver map."));
-			LevelGameMode->TravelToGameOverMenu();
+			UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::LoadGameOverMenu - Showing GameOver menu."));
+			ReleasePreloadedLevel();
+			LevelGameMode->ShowGameOverMenu();
 		} else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("USideScrollerGameInstance::LoadGameOverMenu - GameMode is not a level."));
@@ -178,6 +199,7 @@ void USideScrollerGameInstance::LoadGameCompleteCredits()
 			UE_LOG(LogTemp, Display,
 				TEXT("USideScrollerGameInstance::LoadGameCompleteCredits - Loading GameCompleteCredits map.")
 			);
+			ReleasePreloadedLevel();
 			LevelGameMode->TravelToGameCompleteCredits();
 		}
 		else
@@ -208,6 +230,12 @@ void USideScrollerGameInstance::RefreshServerList()
 		return;
 	}
 	
+	if (GameSessionSearch.IsValid() && GameSessionSearch->SearchState == EOnlineAsyncTaskState::InProgress)
+	{
+		UE_LOG(LogTemp, Display, TEXT("A session search is already running, not starting another one."));
+		return;
+	}
+
 	GameSessionSearch = MakeShareable(new FOnlineSessionSearch());
 	if (!GameSessionSearch.IsValid())
 	{
@@ -215,10 +243,23 @@ void USideScrollerGameInstance::RefreshServerList()
 		return;
 	}
 	// GameSessionSearch->bIsLanQuery = true;
-	GameSessionSearch->MaxSearchResults = 10000;
+	GameSessionSearch->MaxSearchResults = MaxServerSearchResults;
 	GameSessionSearch->QuerySettings.Set(SEARCH_PRESENCE, true, EOnlineComparisonOp::Equals); 
 	UE_LOG(LogTemp, Display, TEXT("Starting session search."));
-	SessionInterface->FindSessions(0, GameSessionSearch.ToSharedRef());
+	PublishedSearchResultCount = 0;
+	if (!SessionInterface->FindSessions(0, GameSessionSearch.ToSharedRef()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not start the session search."));
+		return;
+	}
+
+	// show servers as they answer rather than only when the whole search is done
+	GetTimerManager().SetTimer(
+		ServerSearchPollTimerHandle,
+		FTimerDelegate::CreateUObject(this, &USideScrollerGameInstance::PublishServerSearchResults, false),
+		ServerSearchPollInterval,
+		true
+	);
 }
 
 /**
@@ -229,6 +270,7 @@ void USideScrollerGameInstance::RefreshServerList()
 void USideScrollerGameInstance::Host(FString ServerName)
 {
 	DesiredServerName = ServerName;
+	bContinueSavedProgression = false;
 	if (!SessionInterface.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("There is no SessionInterface, exiting Host func early."));
@@ -242,6 +284,43 @@ void USideScrollerGameInstance::Host(FString ServerName)
 	SessionInterface->DestroySession(SESSION_NAME);
 }
 
+/**
+ * Hosts a game session that the lobby starts at the level of the saved progression.
+ *
+ * @param ServerName The name of the server for the game session.
+ */
+void USideScrollerGameInstance::HostSavedProgression(FString ServerName)
+{
+	if (!bHasSavedProgression)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("USideScrollerGameInstance::HostSavedProgression - No saved progression. Starting a new game.")
+		);
+	}
+
+	Host(ServerName);
+	bContinueSavedProgression = bHasSavedProgression;
+}
+
+/**
+ * Gets the level the lobby starts the game at. The continue request stays set until the host's player resumes the
+ * level with ConsumeSavedProgression, unless the level's map is gone and the game starts over.
+ *
+ * @return The level of the saved progression when continuing and its map exists, otherwise 1.
+ */
+int USideScrollerGameInstance::ConsumeStartLevel()
+{
+	// a record saved after the last level points past the maps there are
+	if (bContinueSavedProgression && bHasSavedProgression && FPackageName::DoesPackageExist(
+		FString::Printf(TEXT("/Game/Maps/Map_Level%i"), SavedProgression.Level)
+	))
+	{
+		return SavedProgression.Level;
+	}
+	bContinueSavedProgression = false;
+	return 1;
+}
+
 /**
  * Joins the game session at the given IP address.
  *
@@ -254,6 +333,8 @@ void USideScrollerGameInstance::Host(FString ServerName)
  */
 void USideScrollerGameInstance::JoinIP(FString& IpAddress)
 {
+	// the host's game is played, not this profile's saved progression
+	bContinueSavedProgression = false;
 	UEngine* Engine = GetEngine();
 	if (!Engine) return;
 	Engine->AddOnScreenDebugMessage(0,5,FColor::Green,
@@ -265,25 +346,38 @@ void USideScrollerGameInstance::JoinIP(FString& IpAddress)
 }
 
 /**
- * Joins a session with the specified index.
+ * Joins a session with the specified session ID.
  *
- * @param Index The index of the session to join.
+ * @param SessionId The ID of the session to join.
  *
  * @return void
  *
- * This method joins a game session using the specified index. It first checks if the session interface is valid.
- * If it is, it checks if the game session search object is also valid. If it is, the method calls the JoinSession
- * function of the session interface with the parameters 0, SESSION_NAME, and the search results at the specified index.
- * If the game session search object is not valid, an error message is logged and the method returns. If the session
- * interface is not valid, an error message is logged and the method returns.
+ * This method joins a game session using the specified session ID. It first checks if the session interface is valid.
+ * If it is, it checks if the game session search object is also valid. If it is, the method looks up the search
+ * result with the given session ID and calls the JoinSession function of the session interface with the parameters
+ * 0, SESSION_NAME, and that search result. If the game session search object is not valid or the session is not among
+ * its results, an error message is logged and the method returns. If the session interface is not valid, an error
+ * message is logged and the method returns.
  */
-void USideScrollerGameInstance::Join(uint32 Index)
+void USideScrollerGameInstance::Join(const FString& SessionId)
 {
+	bContinueSavedProgression = false;
 	if (SessionInterface.IsValid())
 	{
 		if (GameSessionSearch.IsValid())
 		{
-			SessionInterface->JoinSession(0, SESSION_NAME, GameSessionSearch->SearchResults[Index]);
+			const FOnlineSessionSearchResult* SearchResult = GameSessionSearch->SearchResults.FindByPredicate(
+				[&SessionId](const FOnlineSessionSearchResult& Result)
+				{
+					return Result.GetSessionIdStr() == SessionId;
+				}
+			);
+			if (SearchResult == nullptr)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Session %s is not in the search results, cant join it."), *SessionId);
+				return;
+			}
+			SessionInterface->JoinSession(0, SESSION_NAME, *SearchResult);
 		}
 		else
 		{
@@ -299,6 +393,49 @@ void USideScrollerGameInstance::Join(uint32 Index)
 
 }
 
+/**
+ * Queries a listed server's live state through a server info beacon.
+ *
+ * @param SessionId The ID of the session to query.
+ */
+void USideScrollerGameInstance::RefreshServerInfo(const FString& SessionId)
+{
+	if (!SessionInterface.IsValid() || !GameSessionSearch.IsValid()) return;
+
+	if (const TWeakObjectPtr<AServerInfoBeaconClient>* PendingBeacon = ServerInfoBeacons.Find(SessionId);
+		PendingBeacon != nullptr && PendingBeacon->IsValid()
+	) return;  // still waiting for the last answer
+
+	const FOnlineSessionSearchResult* SearchResult = GameSessionSearch->SearchResults.FindByPredicate(
+		[&SessionId](const FOnlineSessionSearchResult& Result)
+		{
+			return Result.GetSessionIdStr() == SessionId;
+		}
+	);
+	if (SearchResult == nullptr) return;
+
+	FString ConnectString;
+	if (!SessionInterface->GetResolvedConnectString(*SearchResult, NAME_BeaconPort, ConnectString))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Could not resolve the beacon address of session %s."), *SessionId);
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+	AServerInfoBeaconClient* Beacon = World->SpawnActor<AServerInfoBeaconClient>();
+	if (!Beacon) return;
+
+	Beacon->OnServerInfoReceived.BindUObject(this, &USideScrollerGameInstance::OnServerInfoReceived);
+	Beacon->OnServerInfoFailed.BindUObject(this, &USideScrollerGameInstance::OnServerInfoFailed);
+	if (!Beacon->QueryServerInfo(SessionId, ConnectString))
+	{
+		Beacon->Destroy();
+		return;
+	}
+	ServerInfoBeacons.Add(SessionId, Beacon);
+}
+
 /**
  * Loads and sets up the main menu widget.
  *
@@ -307,34 +444,20 @@ void USideScrollerGameInstance::Join(uint32 Index)
  */
 void USideScrollerGameInstance::LoadMenu()
 {
-	if (MainMenuClass)
+	ShowMenu(MainMenuClass, [this](UMenuWidget* MenuWidget)
 	{
-		UE_LOG(LogTemp, Display, TEXT("Found Main Menu blueprint class %s."), *MainMenuClass->GetName());
-		Menu = CreateWidget<UMainMenu>(this, MainMenuClass);
-		if (Menu)
+		Menu = Cast<UMainMenu>(MenuWidget);
+		if (!Menu)
 		{
-			Menu->Setup();
-			Menu->SetMenuInterface(this);
+			UE_LOG(LogTemp, Error, TEXT("Main menu blueprint class is not a UMainMenu."));
 		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Cant create UMainMenu Menu from main menu blueprint class."));
-			return;
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the Main Menu blueprint class."));
-		return;
-	}
-	
+	});
 }
 
 /**
  * @brief Function to load the in-game menu widget.
  *
- * This function checks if the in-game menu class is set. If it is,
- * it creates an instance of the menu widget and sets up the menu interface.
+ * Shows the cached in-game menu, creating it on first use.
  *
  * @param None
  *
@@ -342,73 +465,28 @@ void USideScrollerGameInstance::LoadMenu()
  */
 void USideScrollerGameInstance::InGameLoadMenu()
 {
-	if (InGameMenuClass)
-	{
-		UE_LOG(LogTemp, Display, TEXT("Found InGame Menu blueprint class %s."), *InGameMenuClass->GetName());
-		if (UMenuWidget* InGameMenu = CreateWidget<UMenuWidget>(this, InGameMenuClass))
-		{
-			InGameMenu->Setup();
-			InGameMenu->SetMenuInterface(this);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Cant create UMenuWidget Menu from InGame menu blueprint class."));
-			return;
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the InGame Menu blueprint class."));
-		return;
-	}
+	ShowMenu(InGameMenuClass);
 }
 
 /**
  * @brief Respawn and load the menu.
  *
- * This method is responsible for respawning the player character and loading the respawn menu.
- * If the respawn menu blueprint class is found, it creates an instance of the UMenuWidget and sets up the menu
- * interface. If the respawn menu blueprint class is not found, an error message will be logged.
+ * This method is responsible for loading the respawn menu. The cached respawn menu is shown again if there is one;
+ * otherwise its blueprint class is loaded and the menu is created.
  *
  * @param None.
  * @return None.
  */
 void USideScrollerGameInstance::RespawnLoadMenu()
 {
-	if (RespawnMenuClass)
-	{
-		UE_LOG(LogTemp, Display,
-			TEXT("USideScrollerGameInstance::RespawnLoadMenu - Found Respawn Menu blueprint class %s."),
-			*RespawnMenuClass->GetName()
-		);
-		if (UMenuWidget* RespawnMenu = CreateWidget<UMenuWidget>(this, RespawnMenuClass))
-		{
-			RespawnMenu->Setup();
-			RespawnMenu->SetMenuInterface(this);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error,
-				TEXT("USideScrollerGameInstance::RespawnLoadMenu - Cant create UMenuWidget Menu from "
-					"Respawn menu blueprint class.")
-			)
-			return;
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error,
-			TEXT("USideScrollerGameInstance::RespawnLoadMenu - Cant find the Respawn Menu blueprint class.")
-		)
-		return;
-	}
+	ShowMenu(RespawnMenuClass);
 }
 
 /**
  * Selects the character load menu.
  *
- * The method creates a SelectCharacterMenu widget and sets up its properties.
- * It also assigns this instance as the menu interface for the SelectCharacterMenu.
+ * The method shows the SelectCharacterMenu widget, creating it on first use, with this instance as its menu
+ * interface.
  *
  * @param none
  *
@@ -416,61 +494,38 @@ void USideScrollerGameInstance::RespawnLoadMenu()
  */
 void USideScrollerGameInstance::SelectCharacterLoadMenu()
 {
-	if (SelectCharacterMenuClass)
-	{
-		UE_LOG(LogTemp, Display,
-			TEXT("Found SelectCharacter Menu blueprint class %s."),
-			*SelectCharacterMenuClass->GetName()
-		);
-		if (UMenuWidget* SelectCharacterMenu = CreateWidget<UMenuWidget>(this, SelectCharacterMenuClass))
-		{
-			SelectCharacterMenu->Setup();
-			SelectCharacterMenu->SetMenuInterface(this);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Cant create UMenuWidget Menu from SelectCharacter menu blueprint class."));
-			return;
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the SelectCharacter Menu blueprint class."));
-		return;
-	}
+	ShowMenu(SelectCharacterMenuClass);
 }
 
 /**
  * Load the game over menu.
  *
- * If the GameOverMenuClass is set, this method will create an instance of the UMenuWidget using the GameOverMenuClass
- * and set it up by calling its Setup() method. It will also set the UMenuInterface of the GameOverMenu to this
- * game instance.
+ * If the GameOverMenuClass is set, this method will show the game over menu (creating it on first use) and remember
+ * it as the active game over menu so GameOverUnloadMenu can take it down again.
  *
  * @param None
  * @return None
  */
 void USideScrollerGameInstance::GameOverLoadMenu()
 {
-	if (GameOverMenuClass)
-	{
-		UE_LOG(LogTemp, Display, TEXT("Found GameOver Menu blueprint class %s."), *GameOverMenuClass->GetName());
-		if (UMenuWidget* GameOverMenu = CreateWidget<UMenuWidget>(this, GameOverMenuClass))
-		{
-			GameOverMenu->Setup();
-			GameOverMenu->SetMenuInterface(this);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Cant create UMenuWidget Menu from GameOver menu blueprint class."));
-			return;
-		}
-	}
-	else
+	if (ActiveGameOverMenu != nullptr && ActiveGameOverMenu->IsInViewport()) return;
+
+	ShowMenu(GameOverMenuClass, [this](UMenuWidget* MenuWidget)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the GameOver Menu blueprint class."));
-		return;
-	}
+		ActiveGameOverMenu = MenuWidget;
+	});
+}
+
+/**
+ * Removes the game over menu from the viewport and switches the input mode back to the game.
+ */
+void USideScrollerGameInstance::GameOverUnloadMenu()
+{
+	if (ActiveGameOverMenu == nullptr) return;
+
+	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::GameOverUnloadMenu - Removing GameOver menu."));
+	ActiveGameOverMenu->OnLevelRemovedFromWorld();
+	ActiveGameOverMenu = nullptr;
 }
 
 /**
@@ -478,25 +533,81 @@ void USideScrollerGameInstance::GameOverLoadMenu()
  */
 void USideScrollerGameInstance::GameCompleteLoadCredits()
 {
-	if (GameCompleteCreditsClass)
+	ShowMenu(GameCompleteCreditsClass);
+}
+
+/**
+ * Shows a cached menu, or loads its class asynchronously and creates it on first use.
+ *
+ * @param MenuClass The soft class of the menu to show.
+ * @param OnMenuShown Called with the menu widget once it is showing.
+ */
+void USideScrollerGameInstance::ShowMenu(
+	const TSoftClassPtr<UUserWidget>& MenuClass,
+	TFunction<void(UMenuWidget*)> OnMenuShown
+) {
+	if (MenuClass.IsNull())
+	{
+		UE_LOG(LogTemp, Error, TEXT("USideScrollerGameInstance::ShowMenu - No menu blueprint class set."));
+		return;
+	}
+
+	if (UClass* LoadedMenuClass = MenuClass.Get())
 	{
-		UE_LOG(LogTemp, Display, TEXT("Found GameComplete Credits blueprint class %s."), *GameCompleteCreditsClass->GetName());
-		if (UMenuWidget* GameCompleteCredits = CreateWidget<UMenuWidget>(this, GameCompleteCreditsClass))
+		UMenuWidget* MenuWidget = MenuWidgetCache.FindRef(LoadedMenuClass);
+		if (MenuWidget == nullptr)
 		{
-			GameCompleteCredits->Setup();
-			GameCompleteCredits->SetMenuInterface(this);
+			UE_LOG(LogTemp, Display,
+				TEXT("USideScrollerGameInstance::ShowMenu - Creating %s."), *LoadedMenuClass->GetName()
+			);
+			MenuWidget = CreateWidget<UMenuWidget>(this, LoadedMenuClass);
+			if (MenuWidget == nullptr)
+			{
+				UE_LOG(LogTemp, Error,
+					TEXT("USideScrollerGameInstance::ShowMenu - Cant create UMenuWidget Menu from %s."),
+					*LoadedMenuClass->GetName()
+				);
+				return;
+			}
+			MenuWidgetCache.Add(LoadedMenuClass, MenuWidget);
 		}
-		else
+
+		if (!MenuWidget->IsInViewport())
 		{
-			UE_LOG(LogTemp, Error, TEXT("Cant create UMenuWidget Menu from GameComplete Credits blueprint class."));
-			return;
+			MenuWidget->Setup();
 		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Cant find the GameComplete Credits blueprint class."));
+		MenuWidget->SetMenuInterface(this);
+		if (OnMenuShown) OnMenuShown(MenuWidget);
 		return;
 	}
+
+	const FSoftObjectPath MenuClassPath = MenuClass.ToSoftObjectPath();
+	if (PendingMenuLoads.Contains(MenuClassPath)) return;  // already on its way
+	PendingMenuLoads.Add(MenuClassPath);
+
+	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::ShowMenu - Loading %s."), *MenuClassPath.ToString());
+	const TWeakObjectPtr<UWorld> RequestingWorld = GetWorld();
+	UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MenuClassPath,
+		FStreamableDelegate::CreateWeakLambda(this, [this, MenuClass, RequestingWorld, OnMenuShown]()
+		{
+			PendingMenuLoads.Remove(MenuClass.ToSoftObjectPath());
+			if (MenuClass.Get() == nullptr)
+			{
+				UE_LOG(LogTemp, Error,
+					TEXT("USideScrollerGameInstance::ShowMenu - Cant load the menu blueprint class %s."),
+					*MenuClass.ToString()
+				);
+				return;
+			}
+			if (RequestingWorld.Get() != GetWorld())
+			{
+				// the menu belonged to a map that is gone; it will be created when it is asked for again
+				return;
+			}
+			ShowMenu(MenuClass, OnMenuShown);
+		})
+	);
 }
 
 /**
@@ -510,47 +621,72 @@ int USideScrollerGameInstance::GetNumPlayersToStartGame() const
 }
 
 /**
- * Retrieves the chosen character for the given player controller.
+ * @brief Returns the name the host gave the server.
+ *
+ * @return The server name, or an empty string if the server was not named.
+ */
+const FString& USideScrollerGameInstance::GetServerName() const
+{
+	return DesiredServerName;
+}
+
+/**
+ * Writes the beacon port into the hosted session's settings so clients can resolve the beacon address.
+ *
+ * @param BeaconPort The port the beacon host is listening on.
+ */
+void USideScrollerGameInstance::AdvertiseBeaconPort(const int32 BeaconPort)
+{
+	if (!SessionInterface.IsValid()) return;
+
+	FOnlineSessionSettings* SessionSettings = SessionInterface->GetSessionSettings(SESSION_NAME);
+	if (SessionSettings == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No hosted session to advertise the beacon port %i in."), BeaconPort);
+		return;
+	}
+
+	int32 AdvertisedPort = 0;
+	if (SessionSettings->Get(SETTING_BEACONPORT, AdvertisedPort) && AdvertisedPort == BeaconPort) return;
+
+	UE_LOG(LogTemp, Display, TEXT("Advertising beacon port %i."), BeaconPort);
+	SessionSettings->Set(SETTING_BEACONPORT, BeaconPort, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionInterface->UpdateSession(SESSION_NAME, *SessionSettings);
+}
+
+/**
+ * Retrieves the chosen character for the given player controller, by the unique net ID of its player.
  *
  * @param PlayerController The player controller for which to retrieve the chosen character.
  *
  * @return The TSubclassOf<APC_PlayerFox> representing the chosen character for the player controller.
- *         Returns nullptr if either the PlayerControllerChosenCharMap is empty, the player pawn is not a PlayerFox,
- *         or the player could not be found in the PlayerControllerChosenCharMap.
+ *         Returns nullptr if the player has no unique net ID or has not chosen a character.
  */
 TSubclassOf<APC_PlayerFox> USideScrollerGameInstance::GetChosenCharacter(APlayerController* PlayerController)
 {
-	if (PlayerControllerChosenCharMap.empty())
+	const APlayerState* PlayerState = PlayerController ? PlayerController->PlayerState : nullptr;
+	if (PlayerState == nullptr || !PlayerState->GetUniqueId().IsValid())
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("USideScrollerGameInstance::GetChosenCharacter - Player has no PlayerState or unique net ID.")
+		)
+		return nullptr;
+	}
+
+	const TSubclassOf<APC_PlayerFox>* ChosenCharacter = ChosenCharacters.Find(PlayerState->GetUniqueId());
+	if (ChosenCharacter == nullptr)
 	{
 		UE_LOG(LogTemp, Display,
-			TEXT("USideScrollerGameInstance::GetChosenCharacter - PlayerControllerChosenCharMap is empty.")
+			TEXT("USideScrollerGameInstance::GetChosenCharacter - %s has not chosen a character."),
+			*PlayerState->GetPlayerName()
 		)
-	} else {
-		const APC_PlayerFox* PlayerFox = Cast<APC_PlayerFox>(PlayerController->GetPawn());
-		if (PlayerFox == nullptr)
-		{
-			UE_LOG(LogTemp, Warning,
-				TEXT("USideScrollerGameInstance::GetChosenCharacter - PlayerPawn is not a PlayerFox.")
-			)
-			return nullptr;
-		}
-		
-		const auto ChosenCharacter = PlayerControllerChosenCharMap.find(PlayerFox->GetPlayerName().ToString());
-		if (ChosenCharacter == PlayerControllerChosenCharMap.end())
-		{
-			UE_LOG(LogTemp, Display,
-				TEXT("USideScrollerGameInstance::GetChosenCharacter - Cant find Player, %s, in the map."),
-				*PlayerFox->GetPlayerName().ToString()
-			)
-			return nullptr;
-		}
-		return ChosenCharacter->second;
+		return nullptr;
 	}
-	return nullptr;
+	return *ChosenCharacter;
 }
 
 /**
- * Sets the chosen character for a given player controller.
+ * Sets the chosen character for a given player controller, by the unique net ID of its player.
  *
  * @param PlayerController The player controller for which to set the chosen character.
  * @param ChosenCharacter The class of the chosen character.
@@ -559,65 +695,138 @@ void USideScrollerGameInstance::SetChosenCharacter(
 	APlayerController* PlayerController,
 	TSubclassOf<APC_PlayerFox> ChosenCharacter
 ) {
-	const APC_PlayerFox* PlayerFox = Cast<APC_PlayerFox>(PlayerController->GetPawn());
-	if (PlayerFox == nullptr)
+	const APlayerState* PlayerState = PlayerController ? PlayerController->PlayerState : nullptr;
+	if (PlayerState == nullptr || !PlayerState->GetUniqueId().IsValid())
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("USideScrollerGameInstance::SetChosenCharacter - PlayerPawn is not a PlayerFox.")
+			TEXT("USideScrollerGameInstance::SetChosenCharacter - Player has no PlayerState or unique net ID.")
 		)
 		return;
 	}
 
 	UE_LOG(LogTemp, Display,
 		TEXT("USideScrollerGameInstance::SetChosenCharacter - Setting %s's chosen character as %s."),
-		*PlayerFox->GetPlayerName().ToString(),
+		*PlayerState->GetPlayerName(),
 		*ChosenCharacter->GetName()
 	)
-	
-	this->PlayerControllerChosenCharMap.insert({PlayerFox->GetPlayerName().ToString(), ChosenCharacter});
+	ChosenCharacters.Add(PlayerState->GetUniqueId(), ChosenCharacter);
 }
 
 /**
- * @brief Checks if every player has chosen a character.
+ * Streams in the blueprint class of the roster character with the given color, keeping it loaded afterwards.
  *
- * @return True if every player has chosen a character, false otherwise.
+ * @param Color The color the character is picked by.
+ * @param OnLoaded Called with the loaded class, or with nullptr if the roster has no such character.
+ */
+void USideScrollerGameInstance::LoadCharacterClass(
+	const FString& Color,
+	TFunction<void(TSubclassOf<APC_PlayerFox>)> OnLoaded
+) {
+	const UCharacterRoster* Roster = GetCharacterRoster();
+	const FCharacterRosterEntry* RosterEntry = Roster ? Roster->FindCharacter(Color) : nullptr;
+	if (RosterEntry == nullptr || RosterEntry->CharacterClass.IsNull())
+	{
+		UE_LOG(LogTemp, Error,
+			TEXT("USideScrollerGameInstance::LoadCharacterClass - No %s character in the %sroster."),
+			*Color,
+			CharacterRoster ? TEXT("") : TEXT("fallback ")
+		);
+		if (OnLoaded) OnLoaded(nullptr);
+		return;
+	}
+
+	const TSoftClassPtr<APC_PlayerFox> CharacterClass = RosterEntry->CharacterClass;
+	if (CharacterClass.Get() != nullptr && CharacterClassHandles.Contains(Color))
+	{
+		if (OnLoaded) OnLoaded(CharacterClass.Get());
+		return;
+	}
+
+	UE_LOG(LogTemp, Display,
+		TEXT("USideScrollerGameInstance::LoadCharacterClass - Loading the %s character, %s."),
+		*Color,
+		*CharacterClass.ToString()
+	);
+	const TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		CharacterClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [CharacterClass, OnLoaded]()
+		{
+			if (CharacterClass.Get() == nullptr)
+			{
+				UE_LOG(LogTemp, Error,
+					TEXT("USideScrollerGameInstance::LoadCharacterClass - Cant load the character class %s."),
+					*CharacterClass.ToString()
+				);
+			}
+			if (OnLoaded) OnLoaded(CharacterClass.Get());
+		}),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+	CharacterClassHandles.Add(Color, Handle);
+}
+
+/**
+ * Gets the character roster.
  *
- * @param None.
+ * @return The loaded roster, or the fallback roster until the asset manager loaded it.
  */
-bool USideScrollerGameInstance::IsEveryPlayersCharacterChosen() const
+const UCharacterRoster* USideScrollerGameInstance::GetCharacterRoster() const
 {
-	return (this->PlayerControllerChosenCharMap.size() >= GetNumPlayersToStartGame()) ? true : false;
+	return CharacterRoster != nullptr ? CharacterRoster : FallbackCharacterRoster;
 }
 
 /**
- * \brief Sets the flag indicating whether the game is ready to start
- *
- * This method sets the flag indicating whether the game is ready to start.
- * When the game is ready to start, the flag is set to true; otherwise, it
- * is set to false.
- *
- * \param bCond The value to set the flag to. Pass true to indicate that
- *              the game is ready to start, or false to indicate that it
- *              is not.
- *
- * \remarks This method should be called when the game is ready to transition
- *          from the lobby or preparation phase to the actual gameplay phase.
- *          The flag should be set to true when all necessary initialization
- *          has been completed and the game is in a suitable state to start.
+ * Asks the asset manager to load the character roster. Its soft references are not followed, so none of the
+ * characters are loaded with it.
  */
-void USideScrollerGameInstance::SetReadyToStartGame(bool bCond)
+void USideScrollerGameInstance::LoadCharacterRoster()
 {
-	this->bReadyToStartGame = bCond;
+	UAssetManager* AssetManager = UAssetManager::GetIfValid();
+	if (AssetManager == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("USideScrollerGameInstance::LoadCharacterRoster - Cant find the AssetManager."));
+		return;
+	}
+
+	AssetManager->LoadPrimaryAsset(
+		CharacterRosterId,
+		TArray<FName>(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, AssetManager]()
+		{
+			CharacterRoster = AssetManager->GetPrimaryAssetObject<UCharacterRoster>(CharacterRosterId);
+			if (CharacterRoster == nullptr)
+			{
+				UE_LOG(LogTemp, Error,
+					TEXT("USideScrollerGameInstance::LoadCharacterRoster - Cant load the character roster %s. "
+						"Using the fallback roster."),
+					*CharacterRosterId.ToString()
+				);
+				return;
+			}
+			UE_LOG(LogTemp, Display,
+				TEXT("USideScrollerGameInstance::LoadCharacterRoster - Loaded %s with %i characters."),
+				*CharacterRosterId.ToString(),
+				CharacterRoster->Characters.Num()
+			);
+		})
+	);
 }
 
 /**
- * @brief Checks if the game is ready to start.
- *
- * @return true if the game is ready to start, false otherwise.
+ * Releases the handles of every loaded character class and forgets the characters chosen for the last game, so a
+ * new game starts with only the roster loaded.
  */
-bool USideScrollerGameInstance::IsReadyToStartGame()
+void USideScrollerGameInstance::ReleaseCharacterClasses()
 {
-	return this->bReadyToStartGame;
+	for (const TPair<FString, TSharedPtr<FStreamableHandle>>& CharacterClassHandle : CharacterClassHandles)
+	{
+		if (CharacterClassHandle.Value.IsValid())
+		{
+			CharacterClassHandle.Value->ReleaseHandle();
+		}
+	}
+	CharacterClassHandles.Empty();
+	ChosenCharacters.Empty();
 }
 
 /**
@@ -673,6 +882,8 @@ void USideScrollerGameInstance::OnDestroySessionComplete(FName SessionName, bool
 void USideScrollerGameInstance::OnFindSessionsComplete(bool Success)
 {
 	UE_LOG(LogTemp, Display, TEXT("Finding sessions is complete."));
+	GetTimerManager().ClearTimer(ServerSearchPollTimerHandle);
+
 	if (Success)
 	{
 		if (!GameSessionSearch.IsValid())
@@ -680,71 +891,93 @@ void USideScrollerGameInstance::OnFindSessionsComplete(bool Success)
 			UE_LOG(LogTemp, Error, TEXT("GameSessionSearch is not valid. Cant get find session results."));
 			return;
 		}
-		TArray<FOnlineSessionSearchResult> SessionSearchResults = GameSessionSearch->SearchResults;
-		if (SessionSearchResults.Num() > 0)
-		{
-			TArray<FServerData> ServerData;
-			for (const FOnlineSessionSearchResult& SessionSearchResult : SessionSearchResults)
-			{
-				UE_LOG(LogTemp, Display, TEXT("Found session, %s with ping: %i ms."),
-					*SessionSearchResult.GetSessionIdStr(), SessionSearchResult.PingInMs);
-				FServerData Data;
-				Data.MaxPlayers = SessionSearchResult.Session.SessionSettings.NumPublicConnections;
-				Data.CurrentPlayers = Data.MaxPlayers - SessionSearchResult.Session.NumOpenPublicConnections;
-				Data.HostUserName = SessionSearchResult.Session.OwningUserName;
-				FString CustomServerName;
-				if (SessionSearchResult.Session.SessionSettings.Get(SERVER_NAME_SESSION_KEY, CustomServerName))
-				{
-					if (CustomServerName.IsEmpty())
-					{
-						UE_LOG(LogTemp, Display, TEXT("Did not find custom server name, using default."));
-						Data.ServerName = SessionSearchResult.GetSessionIdStr();
-					}
-					else
-					{
-						UE_LOG(LogTemp, Display, TEXT("Found custom server name, %s."), *CustomServerName);
-						Data.ServerName = CustomServerName;
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Display, TEXT("Did not find custom server name, using default."));
-					Data.ServerName = SessionSearchResult.GetSessionIdStr();
-				}
-				ServerData.Add(Data);
-			}
 
-			//FServerData Data1, Data2, Data3;
+		UE_LOG(LogTemp, Display, TEXT("Found %i game sessions in the find session search."),
+			GameSessionSearch->SearchResults.Num());
+		PublishServerSearchResults(true);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Game session search was not successful."));
+	}
+}
 
-			//Data1.ServerName = "Test Server 1";
-			//Data1.MaxPlayers = 3;
-			//Data1.CurrentPlayers = Data1.MaxPlayers - 3;
-			//Data1.HostUserName = "rando_name_1";
-			//ServerData.Add(Data1);
+/**
+ * Hands the search results to the main menu's server list: the new ones while the search runs, all of them once it
+ * is complete.
+ *
+ * @param bSearchComplete Whether the session search has finished.
+ */
+void USideScrollerGameInstance::PublishServerSearchResults(const bool bSearchComplete)
+{
+	if (!GameSessionSearch.IsValid()) return;
 
-			//Data2.ServerName = "Test Server 2";
-			//Data2.MaxPlayers = 3;
-			//Data2.CurrentPlayers = Data2.MaxPlayers - 3;
-			//Data2.HostUserName = "some_other_player_name";
-			//ServerData.Add(Data2);
+	const TArray<FOnlineSessionSearchResult>& SessionSearchResults = GameSessionSearch->SearchResults;
+	const int32 FirstResult = bSearchComplete ? 0 : PublishedSearchResultCount;
+	if (!bSearchComplete && FirstResult >= SessionSearchResults.Num()) return;  // nothing new yet
 
-			//Data3.ServerName = "Test Server 3";
-			//Data3.MaxPlayers = 3;
-			//Data3.CurrentPlayers = Data3.MaxPlayers - 3;
-			//Data3.HostUserName = "Yo Momma";
-			//ServerData.Add(Data3);
+	TArray<FServerData> ServerData;
+	ServerData.Reserve(SessionSearchResults.Num() - FirstResult);
+	for (int32 ResultIndex = FirstResult; ResultIndex < SessionSearchResults.Num(); ++ResultIndex)
+	{
+		const FOnlineSessionSearchResult& SessionSearchResult = SessionSearchResults[ResultIndex];
+		UE_LOG(LogTemp, Verbose, TEXT("Found session, %s with ping: %i ms."),
+			*SessionSearchResult.GetSessionIdStr(), SessionSearchResult.PingInMs);
 
-			Menu->SetServerList(ServerData);
+		FServerData Data;
+		Data.SessionId = SessionSearchResult.GetSessionIdStr();
+		Data.PingInMs = SessionSearchResult.PingInMs;
+		Data.MaxPlayers = SessionSearchResult.Session.SessionSettings.NumPublicConnections;
+		Data.CurrentPlayers = Data.MaxPlayers - SessionSearchResult.Session.NumOpenPublicConnections;
+		Data.HostUserName = SessionSearchResult.Session.OwningUserName;
+		FString CustomServerName;
+		if (SessionSearchResult.Session.SessionSettings.Get(SERVER_NAME_SESSION_KEY, CustomServerName) &&
+			!CustomServerName.IsEmpty()
+		) {
+			Data.ServerName = CustomServerName;
 		}
 		else
 		{
-			UE_LOG(LogTemp, Display, TEXT("There were 0 game sessions found in the find session search."));
+			UE_LOG(LogTemp, Verbose, TEXT("Did not find custom server name, using default."));
+			Data.ServerName = Data.SessionId;
 		}
+		ServerData.Add(Data);
 	}
-	else
+	PublishedSearchResultCount = SessionSearchResults.Num();
+
+	if (Menu == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Game session search was not successful."));
+		UE_LOG(LogTemp, Warning, TEXT("No main menu to show the server list in."));
+		return;
 	}
+	Menu->UpdateServerList(ServerData, bSearchComplete);
+}
+
+/**
+ * Hands a server info beacon's answer to the main menu.
+ *
+ * @param SessionId The ID of the session that was queried.
+ * @param ServerInfo The server's live state.
+ * @param PingInMs The round trip time of the query in milliseconds.
+ */
+void USideScrollerGameInstance::OnServerInfoReceived(
+	const FString& SessionId,
+	const FServerBeaconInfo& ServerInfo,
+	const int32 PingInMs
+) {
+	ServerInfoBeacons.Remove(SessionId);
+	if (Menu == nullptr) return;
+	Menu->ApplyServerInfo(SessionId, ServerInfo, PingInMs);
+}
+
+/**
+ * Forgets a server info beacon that could not reach its server. The row keeps what the session search reported.
+ *
+ * @param SessionId The ID of the session that was queried.
+ */
+void USideScrollerGameInstance::OnServerInfoFailed(const FString& SessionId)
+{
+	ServerInfoBeacons.Remove(SessionId);
 }
 
 /**
@@ -815,23 +1048,75 @@ void USideScrollerGameInstance::CreateSession()
 }
 
 /**
- * Loads a saved game for the player profile.
- * If a saved game file exists, the method will load it.
- * If not, it will create a new instance of the player profile and save it.
+ * Finishes the profile write in flight and flushes any coalesced one before the game instance goes away.
+ */
+void USideScrollerGameInstance::Shutdown()
+{
+	// a synchronous write of the same slot must not overlap the one still running on the thread pool
+	if (PlayerProfileSaveFuture.IsValid())
+	{
+		PlayerProfileSaveFuture.Wait();
+	}
+
+	// progression writes go through a temp file, so a write cut off here would lose the latest autosave
+	for (const TFuture<bool>& ProgressionSave : PendingProgressionSaves)
+	{
+		ProgressionSave.Wait();
+	}
+	PendingProgressionSaves.Reset();
+
+	if (SaveGameTimerHandle.IsValid())
+	{
+		GetTimerManager().ClearTimer(SaveGameTimerHandle);
+		bSaveGamePending = true;
+	}
+
+	// the completion callback of the write can not run once we are shutting down, so write what is outstanding now
+	if (bSaveGamePending && PlayerProfile != nullptr)
+	{
+		UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::Shutdown - Writing pending player profile changes."));
+		UGameplayStatics::SaveGameToSlot(PlayerProfile, PlayerProfileSlot, 0);
+		bSaveGamePending = false;
+	}
+
+	Super::Shutdown();
+}
+
+/**
+ * Starts loading the saved game for the player profile in the background.
+ * The result is handled by OnPlayerProfileLoaded.
  */
 void USideScrollerGameInstance::LoadGame()
 {
 	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::LoadGame - Trying to load a saved game"));
-	// Try to load a saved game file (with name: <SaveGameSlotName>.sav) if exists
-	PlayerProfile = Cast<USideScrollerSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(PlayerProfileSlot, 0)
+	// Try to load a saved game file (with name: <SaveGameSlotName>.sav) if exists, without blocking the game thread
+	UGameplayStatics::AsyncLoadGameFromSlot(
+		PlayerProfileSlot,
+		0,
+		FAsyncLoadGameFromSlotDelegate::CreateUObject(this, &USideScrollerGameInstance::OnPlayerProfileLoaded)
 	);
+}
+
+/**
+ * Handles the result of the asynchronous profile load.
+ * If a saved game file existed it is used as the player profile.
+ * If not, a new instance of the player profile is created and saved.
+ *
+ * @param SlotName The name of the slot that was loaded.
+ * @param UserIndex The platform user index the slot belongs to.
+ * @param LoadedGame The loaded save game, or nullptr if nothing could be loaded.
+ */
+void USideScrollerGameInstance::OnPlayerProfileLoaded(
+	const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame
+)
+{
+	PlayerProfile = Cast<USideScrollerSaveGame>(LoadedGame);
 
 	// If file does not exist try create a new one
 	if (PlayerProfile == nullptr)
 	{
 		UE_LOG(LogTemp, Display,
-			TEXT("USideScrollerGameInstance::LoadGame - No saved games found. Trying to save a new one.")
+			TEXT("USideScrollerGameInstance::OnPlayerProfileLoaded - No saved games found. Trying to save a new one.")
 		);
 
 		// Instantiate a new SaveGame object
@@ -841,7 +1126,7 @@ void USideScrollerGameInstance::LoadGame()
 		if (PlayerProfile == nullptr)
 		{
 			UE_LOG(LogTemp, Warning,
-				TEXT("USideScrollerGameInstance::LoadGame - Not able to create a saved game.")
+				TEXT("USideScrollerGameInstance::OnPlayerProfileLoaded - Not able to create a saved game.")
 			);
 			return;
 		}
@@ -853,37 +1138,143 @@ void USideScrollerGameInstance::LoadGame()
 	}
 	else
 	{
-		
 		UE_LOG(LogTemp, Display,
-			TEXT("USideScrollerGameInstance::LoadGame - Saved game found. Loaded %s."), *PlayerProfile->GetPathName()
+			TEXT("USideScrollerGameInstance::OnPlayerProfileLoaded - Saved game found. Loaded %s."),
+			*PlayerProfile->GetPathName()
 		);
 	}
-    
+
+	bPlayerProfileReady = true;
+	OnPlayerProfileReady.Broadcast(PlayerProfile);
 }
 
 /**
- * Saves the current game progress.
+ * @brief Checks whether the player profile has finished loading.
  *
- * @param PlayerProfile - The save game object to be serialized and saved.
- * @param PlayerProfileSlot - The name of the save game slot.
+ * @return True if the player profile is loaded and valid.
+ */
+bool USideScrollerGameInstance::IsPlayerProfileReady() const
+{
+	return bPlayerProfileReady && PlayerProfile != nullptr;
+}
+
+/**
+ * @brief Executes the callback now if the profile is ready, otherwise once it is.
+ *
+ * @param Callback The delegate to execute with the loaded profile.
+ * @return The handle of the registered delegate, or an invalid handle if the callback already ran.
+ */
+FDelegateHandle USideScrollerGameInstance::CallWhenPlayerProfileReady(FOnPlayerProfileReady::FDelegate&& Callback)
+{
+	if (IsPlayerProfileReady())
+	{
+		Callback.ExecuteIfBound(PlayerProfile);
+		return FDelegateHandle();
+	}
+
+	return OnPlayerProfileReady.Add(MoveTemp(Callback));
+}
+
+/**
+ * Requests that the current game progress be saved.
+ * The write is deferred by SaveGameCoalesceDelay so that bursts of changes only hit the disk once.
  */
 void USideScrollerGameInstance::SaveGame()
 {
-	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::SaveGame - Saving game..."));
+	if (PlayerProfile == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("USideScrollerGameInstance::SaveGame - No player profile loaded yet."));
+		return;
+	}
+
+	// a write is already scheduled, it will pick up this change as well
+	if (GetTimerManager().IsTimerActive(SaveGameTimerHandle)) return;
+
+	GetTimerManager().SetTimer(
+		SaveGameTimerHandle,
+		this,
+		&USideScrollerGameInstance::FlushSaveGame,
+		SaveGameCoalesceDelay,
+		false
+	);
+}
+
+/**
+ * Serializes the player profile on the game thread and writes it to its slot on the thread pool. The result is
+ * handed back to OnPlayerProfileSaved on the game thread.
+ */
+void USideScrollerGameInstance::FlushSaveGame()
+{
+	SaveGameTimerHandle.Invalidate();
+
+	if (PlayerProfile == nullptr) return;
+
+	if (bSaveGameInFlight)
+	{
+		// write again once the current one finishes so the latest values end up on disk
+		bSaveGamePending = true;
+		return;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("USideScrollerGameInstance::FlushSaveGame - Saving game..."));
+	bSaveGameInFlight = true;
+	bSaveGamePending = false;
     
-	// Call SaveGameToSlot to serialize and save our SaveGameObject with name: <SaveGameSlotName>.sav
-	if (UGameplayStatics::SaveGameToSlot(PlayerProfile, PlayerProfileSlot, 0))
+	// serialize here, where the profile can not change underneath us, and only leave the file write to the worker
+	TArray<uint8> ProfileData;
+	if (!UGameplayStatics::SaveGameToMemory(PlayerProfile, ProfileData))
+	{
+		OnPlayerProfileSaved(PlayerProfileSlot, 0, false);
+		return;
+	}
+
+	// keep our own future, unlike AsyncSaveGameToSlot, so Shutdown can wait for the write to finish
+	TWeakObjectPtr<USideScrollerGameInstance> WeakThis(this);
+	PlayerProfileSaveFuture = Async(EAsyncExecution::ThreadPool,
+		[WeakThis, SlotName = PlayerProfileSlot, ProfileData = MoveTemp(ProfileData)]()
+		{
+			// Save our SaveGameObject with name: <SaveGameSlotName>.sav
+			const bool bSuccess = UGameplayStatics::SaveDataToSlot(ProfileData, SlotName, 0);
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotName, bSuccess]()
+			{
+				if (USideScrollerGameInstance* GameInstance = WeakThis.Get())
+				{
+					GameInstance->OnPlayerProfileSaved(SlotName, 0, bSuccess);
+				}
+			});
+			return bSuccess;
+		}
+	);
+}
+
+/**
+ * Logs the result of an asynchronous profile write and issues another write if changes came in meanwhile.
+ *
+ * @param SlotName The name of the slot that was written.
+ * @param UserIndex The platform user index the slot belongs to.
+ * @param bSuccess Whether the write succeeded.
+ */
+void USideScrollerGameInstance::OnPlayerProfileSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+	bSaveGameInFlight = false;
+
+	if (bSuccess)
 	{
 		UE_LOG(LogTemp, Display,
-			TEXT("USideScrollerGameInstance::LogIfGameWasSavedOrNot - Game saved.")
+			TEXT("USideScrollerGameInstance::OnPlayerProfileSaved - Game saved.")
 		);
 	}
 	else
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("USideScrollerGameInstance::LogIfGameWasSavedOrNot - Game NOT saved.")
+			TEXT("USideScrollerGameInstance::OnPlayerProfileSaved - Game NOT saved.")
 		);
 	}
+
+	if (bSaveGamePending)
+	{
+		FlushSaveGame();
+	}
 }
 
 /**
@@ -895,3 +1286,165 @@ USideScrollerSaveGame* USideScrollerGameInstance::GetPlayerProfile() const
 {
 	return PlayerProfile;
 }
+
+/**
+ * Remembers the given progression and writes it to disk in the background.
+ *
+ * @param Record The progression to save.
+ */
+void USideScrollerGameInstance::SaveProgression(const FProgressionRecord& Record)
+{
+	SavedProgression = Record;
+	bHasSavedProgression = true;
+
+	UE_LOG(LogTemp, Display,
+		TEXT("USideScrollerGameInstance::SaveProgression - Autosaving progression for level %i."), Record.Level
+	);
+	PendingProgressionSaves.RemoveAll([](const TFuture<bool>& ProgressionSave)
+	{
+		return ProgressionSave.IsReady();
+	});
+	PendingProgressionSaves.Add(
+		FProgressionRecordFile::SaveAsync(Record, FProgressionRecordFile::GetFilePath(PlayerProfileSlot))
+	);
+}
+
+/**
+ * @brief Gets the latest saved progression.
+ *
+ * @param OutRecord The saved progression.
+ * @return True if there is a saved progression.
+ */
+bool USideScrollerGameInstance::GetSavedProgression(FProgressionRecord& OutRecord) const
+{
+	if (!bHasSavedProgression) return false;
+
+	OutRecord = SavedProgression;
+	return true;
+}
+
+/**
+ * Hands out the saved progression for the level once, and only to a game hosted with HostSavedProgression.
+ *
+ * @param World The world the player spawned in.
+ * @param Level The level being played.
+ * @param OutRecord The saved progression.
+ * @return True if the player chose to continue, World is not a client of someone else's session and the saved
+ * progression belongs to Level.
+ */
+bool USideScrollerGameInstance::ConsumeSavedProgression(
+	const UWorld* World,
+	const int Level,
+	FProgressionRecord& OutRecord
+) {
+	if (!bContinueSavedProgression || !bHasSavedProgression) return false;
+	if (World == nullptr || World->GetNetMode() == NM_Client || SavedProgression.Level != Level) return false;
+
+	bContinueSavedProgression = false;
+	OutRecord = SavedProgression;
+	return true;
+}
+
+/**
+ * Reads the progression record on a worker thread and hands it back to the game thread once it is loaded.
+ */
+void USideScrollerGameInstance::LoadProgression()
+{
+	TWeakObjectPtr<USideScrollerGameInstance> WeakThis(this);
+	FProgressionRecordFile::LoadAsync(FProgressionRecordFile::GetFilePath(PlayerProfileSlot)).Next(
+		[WeakThis](const TOptional<FProgressionRecord>& Record)
+		{
+			if (!Record.IsSet()) return;
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, LoadedRecord = Record.GetValue()]()
+			{
+				USideScrollerGameInstance* GameInstance = WeakThis.Get();
+				// an autosave made while loading is newer than what was on disk
+				if (GameInstance == nullptr || GameInstance->bHasSavedProgression) return;
+
+				GameInstance->SavedProgression = LoadedRecord;
+				GameInstance->bHasSavedProgression = true;
+				UE_LOG(LogTemp, Display,
+					TEXT("USideScrollerGameInstance::LoadProgression - Loaded progression for level %i."),
+					LoadedRecord.Level
+				);
+			});
+		}
+	);
+}
+
+/**
+ * Starts an asynchronous load of the given level's map package so that the following ServerTravel does not have to
+ * load it from disk.
+ *
+ * @param Level The number of the level to preload.
+ */
+void USideScrollerGameInstance::PreloadLevel(const int Level)
+{
+	const FString LevelPackageName = FString::Printf(TEXT("/Game/Maps/Map_Level%i"), Level);
+	if (PreloadedLevelPackageName == LevelPackageName)
+	{
+		UE_LOG(LogTemp, Verbose,
+			TEXT("USideScrollerGameInstance::PreloadLevel - %s is already preloading."), *LevelPackageName
+		);
+		return;
+	}
+
+	ReleasePreloadedLevel();
+	PreloadedLevelPackageName = LevelPackageName;
+
+	UE_LOG(LogTemp, Display,
+		TEXT("USideScrollerGameInstance::PreloadLevel - Preloading %s in the background."), *LevelPackageName
+	);
+	LoadPackageAsync(
+		LevelPackageName,
+		FLoadPackageAsyncDelegate::CreateUObject(this, &USideScrollerGameInstance::OnLevelPreloaded)
+	);
+}
+
+/**
+ * Keeps a reference to the world of the preloaded level package so it stays resident until the travel to it is done.
+ *
+ * @param PackageName The name of the package that finished loading.
+ * @param LoadedPackage The loaded package, or nullptr if the load failed.
+ * @param Result The result of the async load request.
+ */
+void USideScrollerGameInstance::OnLevelPreloaded(
+	const FName& PackageName,
+	UPackage* LoadedPackage,
+	const EAsyncLoadingResult::Type Result
+)
+{
+	// a newer preload request (or a release) came in while this one was loading
+	if (PackageName.ToString() != PreloadedLevelPackageName) return;
+
+	UWorld* LoadedWorld = LoadedPackage != nullptr ? UWorld::FindWorldInPackage(LoadedPackage) : nullptr;
+	if (Result != EAsyncLoadingResult::Succeeded || LoadedWorld == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("USideScrollerGameInstance::OnLevelPreloaded - Failed to preload %s."), *PackageName.ToString()
+		);
+		PreloadedLevelPackageName.Empty();
+		return;
+	}
+
+	UE_LOG(LogTemp, Display,
+		TEXT("USideScrollerGameInstance::OnLevelPreloaded - %s is loaded and ready for travel."),
+		*PackageName.ToString()
+	);
+	PreloadedLevelWorld = LoadedWorld;
+}
+
+/**
+ * Releases the preloaded level package, if any.
+ */
+void USideScrollerGameInstance::ReleasePreloadedLevel()
+{
+	if (PreloadedLevelPackageName.IsEmpty()) return;
+
+	UE_LOG(LogTemp, Verbose,
+		TEXT("USideScrollerGameInstance::ReleasePreloadedLevel - Releasing %s."), *PreloadedLevelPackageName
+	);
+	PreloadedLevelPackageName.Empty();
+	PreloadedLevelWorld = nullptr;
+}
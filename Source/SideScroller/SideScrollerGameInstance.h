@@ -2,15 +2,15 @@
 
 #pragma once
 
-#include <map>
-
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
 #include "Interfaces/MenuInterface.h"
 #include "OnlineSessionSettings.h"
 #include "OnlineSubsystem.h"
 #include "GameModes/LobbyGameMode.h"
 #include "Interfaces/OnlineSessionInterface.h"
+#include "SaveGames/ProgressionRecord.h"
 #include "SidescrollerGameInstance.generated.h"
 
 /**
@@ -21,6 +21,7 @@
  * progress in the game.
  */
 class USideScrollerSaveGame;
+class USaveGame;
 /**
  * @class APC_PlayerFox
  * @brief The APC_PlayerFox class represents the player character in the game.
@@ -31,6 +32,13 @@ class USideScrollerSaveGame;
  */
 class APC_PlayerFox;
 
+/**
+ * @brief Broadcast once the player profile has finished loading (or has been created) and is safe to read.
+ *
+ * @param PlayerProfile The loaded player profile.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerProfileReady, USideScrollerSaveGame*);
+
 /**
  * @struct FServerData
  * @brief Represents server data information.
@@ -39,6 +47,13 @@ USTRUCT()
 struct FServerData
 {
 	GENERATED_BODY()
+	/**
+	 * @brief The ID of the session the server is hosting.
+	 *
+	 * Unique per session, so the server browser uses it to match search results to the rows it already shows and
+	 * the game instance uses it to find the search result to join.
+	 */
+	FString SessionId;
 	/**
 	 * @brief Represents the name of the server.
 	 *
@@ -80,6 +95,17 @@ struct FServerData
 	 * @endcode
 	 */
 	FString HostUserName;
+	/**
+	 * @brief The round trip time to the server in milliseconds, as measured by the session search or the server's
+	 * info beacon.
+	 */
+	int32 PingInMs = 0;
+	/**
+	 * @brief The level the server is playing, or 0 while it is in the lobby.
+	 *
+	 * Session searches do not report it, so it stays 0 until the server's info beacon answered.
+	 */
+	int32 Level = 0;
 };
 
 /**
@@ -99,8 +125,9 @@ class SIDESCROLLER_API USideScrollerGameInstance : public UGameInstance, public
 public:
 	/**
 	 * Constructor for the SideScrollerGameInstance class.
-	 * Initializes the class by finding and assigning the necessary widget classes for the main menu, in-game menu,
-	 * game over menu, and select character menu. It also loads the saved game.
+	 * Initializes the class by pointing the soft widget class references at the main menu, in-game menu, respawn,
+	 * game over, credits and select character menu blueprints. Nothing is loaded here; each class is loaded
+	 * asynchronously the first time its menu is shown. The saved game is loaded later, asynchronously, from Init.
 	 *
 	 * @param ObjectInitializer The object initializer from FObjectInitializer.
 	 */
@@ -109,8 +136,9 @@ public:
 	/**
 	 * Initializes the game instance.
 	 *
-	 * This method initializes the game instance by getting the online subsystem, checking for the session interface,
-	 * and setting up the delegates for different session events.
+	 * This method initializes the game instance by kicking off the asynchronous load of the player profile, getting
+	 * the online subsystem, checking for the session interface, and setting up the delegates for different session
+	 * events.
 	 *
 	 * @see IOnlineSubsystem::Get()
 	 * @see IOnlineSubsystem::GetSubsystemName()
@@ -122,6 +150,15 @@ public:
 	 */
 	virtual void Init();
 
+	/**
+	 * @brief Shuts down the game instance.
+	 *
+	 * Any profile or progression write still in flight is waited for first, and then any write that is still waiting
+	 * on the save coalescing timer is flushed synchronously, so settings changed right before quitting are not lost
+	 * and the two writes never race on the same slot file.
+	 */
+	virtual void Shutdown() override;
+
 	/**
 	 * Loads the main menu level. This function is a BlueprintCallable and can be called from Blueprints.
 	 *
@@ -137,8 +174,12 @@ public:
 	 *
 	 * This function is responsible for refreshing the server list. It searches for available game sessions
 	 * using the SessionInterface object and populates the GameSessionSearch object with the results.
-	 * The maximum number of search results can be set using the MaxSearchResults property of the GameSessionSearch
-	 * object. The search can be customized using the QuerySettings property of the GameSessionSearch object.
+	 * The maximum number of search results is capped by MaxServerSearchResults. The search can be customized using the
+	 * QuerySettings property of the GameSessionSearch object.
+	 *
+	 * While the search runs, the results found so far are handed to the main menu every ServerSearchPollInterval
+	 * seconds, so servers show up as they answer instead of all at once when the search completes. Does nothing
+	 * while a search is already running.
 	 *
 	 * @note This function assumes that the SessionInterface object is valid. If it is not valid, an error message will
 	 * be logged and the function will exit early.
@@ -164,6 +205,26 @@ public:
 	UFUNCTION(Exec)
 	void Host(FString ServerName) override;
 
+	/**
+	 * @brief Hosts a game session like Host, but the lobby starts the game at the level of the saved progression.
+	 *
+	 * The host's player then resumes that level with the saved lives and points, at the last checkpoint if one had
+	 * been reached (see APC_PlayerFox::ApplySavedProgression). The record belongs to this machine's profile, so
+	 * players who join start the level fresh.
+	 *
+	 * @param ServerName The name of the server for the game session.
+	 */
+	UFUNCTION(Exec, BlueprintCallable)
+	void HostSavedProgression(FString ServerName);
+
+	/**
+	 * @brief Gets the level the lobby starts the game at, and drops the continue request of HostSavedProgression if
+	 * the saved level's map no longer exists.
+	 *
+	 * @return The level of the saved progression when continuing and its map exists, otherwise 1.
+	 */
+	int ConsumeStartLevel();
+
 	/**
 	 * @brief Function to join a game with the given IP address.
 	 *
@@ -184,28 +245,39 @@ public:
 	void JoinIP(FString& IpAddress) override;
 
 	/**
-	 * @brief Joins a game session at the specified index.
+	 * @brief Joins the game session with the specified session ID.
 	 *
-	 * This function joins a game session at a specific index. It checks if the session interface and game session
-	 * search is valid before attempting to join the session. If the session interface or game session search is not
-	 * valid, an error message is logged and the function returns.
+	 * This function looks the session up in the results of the last session search and joins it. It checks if the
+	 * session interface and game session search is valid before attempting to join the session. If either is not
+	 * valid, or the session is no longer among the search results, an error message is logged and the function
+	 * returns.
 	 *
-	 * @param Index The index of the game session to join.
+	 * @param SessionId The ID of the game session to join.
 	 * @return void
 	 */
 	UFUNCTION(Exec)
-	void Join(uint32 Index) override;
+	void Join(const FString& SessionId) override;
 
-	/** Loads the menu by creating a widget instance of the Main Menu blueprint class.
+	/**
+	 * @brief Asks a listed server for its live state through a server info beacon.
 	 *
-	 * - If the MainMenuClass is valid, it logs a message indicating the class is found.
-	 * - Creates an instance of MainMenu widget.
+	 * The beacon connects to the beacon port the server advertises in its session settings, so no session search
+	 * is needed. The answer (player counts, level, server name and ping) is handed to the main menu through
+	 * UMainMenu::ApplyServerInfo. Does nothing while a query to the same server is still in flight.
+	 *
+	 * @param SessionId The ID of the session to query, as found by the last server list refresh.
+	 */
+	void RefreshServerInfo(const FString& SessionId) override;
+
+	/** Loads the menu by showing the Main Menu blueprint widget.
+	 *
+	 * - Loads the MainMenuClass asynchronously if it is not loaded yet.
+	 * - Creates the MainMenu widget the first time, and re-shows the cached one afterwards.
 	 * - Sets up the MainMenu widget.
 	 * - Sets the MenuInterface of the MainMenu widget to be the current game instance.
-	 * - If MainMenu widget fails to create, it logs an error message and returns.
-	 * - If MainMenuClass is not found, it logs an error message and returns.
+	 * - If MainMenuClass is not set or fails to load, it logs an error message and returns.
 	 *
-	 * @see MainMenuClass
+	 * @see MainMenuClass, ShowMenu
 	 */
 	UFUNCTION(BlueprintCallable)
 	void LoadMenu();
@@ -213,8 +285,8 @@ public:
 	/**
 	 * Loads the in-game menu.
 	 *
-	 * This method creates and sets up an instance of the in-game menu widget if the in-game menu blueprint
-	 * class is found.
+	 * This method shows the cached in-game menu widget, creating it (and loading its blueprint class) the first
+	 * time the menu is opened.
 	 *
 	 * @param None
 	 *
@@ -246,14 +318,22 @@ public:
 	/**
 	 * Loads the game over menu.
 	 *
-	 * If the GameOverMenuClass variable is set, this method will create an instance of the GameOverMenu blueprint class,
-	 * set it up, and set the current menu interface to the created menu. Otherwise, it will log an error message.
+	 * If the GameOverMenuClass variable is set, this method will show the GameOverMenu widget, creating it the first
+	 * time, and set the current menu interface to it. Otherwise, it will log an error message.
+	 * The menu is shown over the level, which stays loaded so it can be reset in place; it is kept until
+	 * GameOverUnloadMenu takes it down. Does nothing if the menu is already showing.
 	 *
 	 * @note This method is BlueprintCallable, meaning it can be called from Blueprint scripts.
 	 */
 	UFUNCTION(BlueprintCallable)
 	void GameOverLoadMenu();
 
+	/**
+	 * @brief Takes down the game over menu shown by GameOverLoadMenu, if any, and gives input back to the game.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void GameOverUnloadMenu();
+
 	UFUNCTION(BlueprintCallable)
 	void GameCompleteLoadCredits();
 	
@@ -261,7 +341,8 @@ public:
 	 * Loads the Game Over Menu.
 	 *
 	 * This function is called to load the Game Over Menu. It checks if the current game mode is a level game mode,
-	 * and if so, it calls the TravelToGameOverMenu function of the level game mode.
+	 * and if so, it calls the ShowGameOverMenu function of the level game mode, which shows the menu over the level
+	 * on every machine instead of travelling to the game over map.
 	 *
 	 * @param None
 	 * @return None
@@ -294,6 +375,23 @@ public:
 	UFUNCTION(BlueprintCallable)
 	int GetNumPlayersToStartGame() const;
 
+	/**
+	 * @brief Gets the name the host gave the server.
+	 *
+	 * @return The server name, or an empty string if the host did not name the server.
+	 */
+	const FString& GetServerName() const;
+
+	/**
+	 * @brief Advertises the port the server info beacon listens on in the hosted session's settings.
+	 *
+	 * Called by the game mode once it has opened the beacon host. Clients resolve the beacon address from the
+	 * search result with this port, so it has to be updated whenever the host had to bind a different one.
+	 *
+	 * @param BeaconPort The port the beacon host is listening on.
+	 */
+	void AdvertiseBeaconPort(int32 BeaconPort);
+
 	/**
 	 * Retrieves the chosen character class associated with the given player controller.
 	 * Returns the class of the chosen character.
@@ -315,91 +413,164 @@ public:
 	void SetChosenCharacter(APlayerController* PlayerController, TSubclassOf<APC_PlayerFox> ChosenCharacter);
 
 	/**
-	 * Check whether every player has chosen a character.
+	 * @brief Streams in the blueprint class of the roster character with the given color.
+	 *
+	 * Only the picked character is loaded, through the asset manager's streamable manager, and the handle is kept
+	 * so the class stays loaded for the level that spawns it. Asking for a character that is already loaded calls
+	 * back right away.
 	 *
-	 * @return True if every player has chosen a character, false otherwise.
+	 * @param Color The color the character is picked by.
+	 * @param OnLoaded Called with the loaded class, or with nullptr if the roster has no such character.
 	 */
-	UFUNCTION(BlueprintCallable)
-	bool IsEveryPlayersCharacterChosen() const;
+	void LoadCharacterClass(const FString& Color, TFunction<void(TSubclassOf<APC_PlayerFox>)> OnLoaded);
 
 	/**
-	 * @brief Sets the ready-to-start game condition.
+	 * @brief Gets the character roster.
 	 *
-	 * This method updates the ready-to-start game condition of the `USideScrollerGameInstance` instance.
-	 * The condition determines whether the game is ready to start or not.
+	 * @return The roster the asset manager loaded, or the built-in FallbackCharacterRoster until it has (or when
+	 * DA_CharacterRoster is missing).
+	 */
+	const class UCharacterRoster* GetCharacterRoster() const;
+
+	/**
+	 * \brief Retrieves the player profile.
 	 *
-	 * @param bCond The new value of the ready-to-start game condition.
+	 * \return The player's profile as an instance of USideScrollerSaveGame.
+	 */
+	UFUNCTION(BlueprintCallable)
+	USideScrollerSaveGame* GetPlayerProfile() const;
+
+	/**
+	 * @brief Checks whether the player profile has finished loading.
 	 *
-	 * @return None
+	 * @return True once the asynchronous profile load has completed and GetPlayerProfile returns a valid profile.
 	 */
 	UFUNCTION(BlueprintCallable)
-	void SetReadyToStartGame(bool bCond);
+	bool IsPlayerProfileReady() const;
 
 	/**
-	 * @brief Checks if the game is ready to start.
+	 * @brief Runs the given callback as soon as the player profile is ready.
 	 *
-	 * @return True if the game is ready to start, false otherwise.
+	 * If the profile has already been loaded the callback is executed immediately, otherwise it is registered with
+	 * OnPlayerProfileReady and executed when the asynchronous load completes. Menus use this instead of reading
+	 * the profile directly because they can be constructed before the load has finished.
 	 *
-	 * @param None.
+	 * @param Callback The delegate to execute with the loaded profile.
+	 * @return The handle of the registered delegate, or an invalid handle if the callback already ran.
+	 */
+	FDelegateHandle CallWhenPlayerProfileReady(FOnPlayerProfileReady::FDelegate&& Callback);
+
+	/**
+	 * @brief Delegate broadcast when the player profile finishes loading.
+	 */
+	FOnPlayerProfileReady OnPlayerProfileReady;
+
+	/**
+	 * Saves the game.
+	 *
+	 * This function requests that the player's profile be written to its save game slot. Requests are coalesced:
+	 * the first request arms a short timer and any further requests made before it fires (for example while a
+	 * slider is being dragged) are folded into the same write. The profile is serialized on the game thread and
+	 * written to its slot on the thread pool, so the game thread never waits on the disk.
+	 *
+	 * @return None.
 	 */
 	UFUNCTION(BlueprintCallable)
-	bool IsReadyToStartGame();
+	void SaveGame();
 
 	/**
-	 * \brief Retrieves the player profile.
+	 * @brief Autosaves the player's progression record.
 	 *
-	 * \return The player's profile as an instance of USideScrollerSaveGame.
+	 * The record is copied, remembered as the latest saved progression and then serialized and written atomically
+	 * on a worker thread by FProgressionRecordFile, so the game thread does not wait on it.
+	 *
+	 * @param Record The progression to save.
+	 */
+	void SaveProgression(const FProgressionRecord& Record);
+
+	/**
+	 * @brief Gets the latest saved progression of the player profile.
+	 *
+	 * The record is read from disk in the background during Init, so this returns false until that has finished or
+	 * when the profile has no progression saved yet.
+	 *
+	 * @param OutRecord The saved progression.
+	 * @return True if there is a saved progression.
 	 */
 	UFUNCTION(BlueprintCallable)
-	USideScrollerSaveGame* GetPlayerProfile() const;
+	bool GetSavedProgression(FProgressionRecord& OutRecord) const;
 
 	/**
-	 * Saves the game.
+	 * @brief Gets the saved progression to resume the given level with, once, if the player chose to continue it.
 	 *
-	 * This function serializes and saves the player's profile to a save game slot.
+	 * Only a game hosted with HostSavedProgression, or its standalone equivalent, gets the record: Host, Join and
+	 * JoinIP clear the continue request, and a client in someone else's session never gets it. It is cleared again
+	 * once handed out, so respawns and later levels can not top the lives back up from it.
 	 *
-	 * @param PlayerProfile - The player's profile to save.
-	 * @param PlayerProfileSlot - The name of the save game slot.
+	 * @param World The world the player spawned in.
+	 * @param Level The level being played.
+	 * @param OutRecord The saved progression.
+	 * @return True if the player chose to continue, World is not a client of someone else's session and the saved
+	 * progression belongs to Level.
+	 */
+	bool ConsumeSavedProgression(const UWorld* World, int Level, FProgressionRecord& OutRecord);
+
+	/**
+	 * @brief Starts loading the given level's map package in the background.
 	 *
-	 * @return None.
+	 * The package is requested with LoadPackageAsync and its world is held by the game instance once loaded, so it
+	 * survives garbage collection and the seamless travel out of the current world. ServerTravel then finds the map
+	 * already resident and only has to swap worlds instead of doing a cold package load. Calling this again for the
+	 * level that is already preloading (or preloaded) does nothing.
+	 *
+	 * @param Level The number of the level whose map (/Game/Maps/Map_Level<Level>) should be preloaded.
 	 */
 	UFUNCTION(BlueprintCallable)
-	void SaveGame();
+	void PreloadLevel(int Level);
+
+	/**
+	 * @brief Drops the reference to a preloaded level's world so it can be garbage collected.
+	 *
+	 * Called once the preloaded level is up and running, or when the game leaves the level flow.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void ReleasePreloadedLevel();
 
 private:
 	/**
 	 * @brief The MainMenuClass variable.
 	 *
-	 * MainMenuClass represents the class of the main menu user widget.
+	 * MainMenuClass is a soft reference to the class of the main menu user widget. It is loaded asynchronously the
+	 * first time the main menu is shown.
 	 */
-	TSubclassOf<class UUserWidget> MainMenuClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> MainMenuClass;
 	
 	/**
 	 * @brief This variable represents the User Widget class for the in-game menu.
 	 *
-	 * The InGameMenuClass variable is of type TSubclassOf<class UUserWidget> and is used to store the class
-	 * that represents the in-game menu User Widget. The User Widget is responsible for displaying the
-	 * in-game menu UI elements.
+	 * The InGameMenuClass variable is a soft reference to the class that represents the in-game menu User Widget.
+	 * The User Widget is responsible for displaying the in-game menu UI elements.
 	 *
-	 * Setting this variable to nullptr means that there is no specific User Widget class assigned to the
-	 * in-game menu yet.
+	 * The class is only loaded, asynchronously, the first time the in-game menu is opened.
 	 *
-	 * @note The actual User Widget class assigned to this variable should be derived from the UUserWidget
-	 *       base class.
+	 * @note The actual User Widget class assigned to this variable should be derived from the UMenuWidget class.
 	 *
-	 * @see UUserWidget
+	 * @see UUserWidget, ShowMenu
 	 */
-	TSubclassOf<class UUserWidget> InGameMenuClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> InGameMenuClass;
 	
 	/**
 	 * @brief The class representing the Select Character Menu.
 	 *
 	 * This class is responsible for managing the Select Character Menu user interface.
-	 * It extends the UUserWidget class which is a base class for all user widgets.
+	 * It extends the UUserWidget class which is a base class for all user widgets. Loaded on first use.
 	 *
 	 * @see UUserWidget
 	 */
-	TSubclassOf<class UUserWidget> SelectCharacterMenuClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> SelectCharacterMenuClass;
 	
 	/**
 	 *
@@ -409,33 +580,67 @@ private:
 	/**
 	 * @brief Class variable representing the game over menu widget.
 	 *
-	 * This variable holds a reference to the UE4 `TSubclassOf<class UUserWidget>` class which represents the game
-	 * over menu widget. It is initialized with a `nullptr` value to indicate that it has not been assigned yet.
-	 *
-	 * @note To create an instance of the game over menu widget, use `CreateWidget` or `CreateWidgetInstance` function
-	 * and pass this variable as the template parameter.
+	 * This variable holds a soft reference to the class which represents the game over menu widget. The class is
+	 * loaded asynchronously the first time the game over menu is shown.
 	 *
-	 * @see CreateWidget
-	 * @see CreateWidgetInstance
+	 * @see ShowMenu
 	 */
-	TSubclassOf<class UUserWidget> GameOverMenuClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> GameOverMenuClass;
+
+	/**
+	 * @brief The game over menu currently shown over the level, or null.
+	 */
+	UPROPERTY()
+	class UMenuWidget* ActiveGameOverMenu = nullptr;
 
 	/**
 	 * @brief Represents the class of the user widget used for the game complete credits.
 	 *
-	 * This variable stores the TSubclassOf<class UUserWidget> representing the user widget class used for
-	 * the game complete credits. The user widget class defines the layout and functionality
-	 * of the credits screen displayed when the game is completed.
+	 * This variable stores a soft reference to the user widget class used for the game complete credits. The user
+	 * widget class defines the layout and functionality of the credits screen displayed when the game is completed.
 	 */
-	TSubclassOf<class UUserWidget> GameCompleteCreditsClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> GameCompleteCreditsClass;
 	
 	/**
-	 * The RespawnMenuClass variable is a TSubclassOf<UUserWidget> type variable used to hold the class of the
-	 * respawn menu widget. It is assigned with nullptr by default.
+	 * The RespawnMenuClass variable is a soft reference to the class of the respawn menu widget. It is loaded
+	 * asynchronously the first time the respawn menu is shown.
 	 *
 	 * @see UUserWidget
 	 */
-	TSubclassOf<class UUserWidget>  RespawnMenuClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, Category = "Menus")
+	TSoftClassPtr<class UUserWidget> RespawnMenuClass;
+
+	/**
+	 * @brief The menu widgets created so far, keyed by their class.
+	 *
+	 * Menus are created once and re-shown from here afterwards, so opening a menu again does not allocate and lay
+	 * out a new widget tree. They are owned by the game instance and survive travelling between maps.
+	 */
+	UPROPERTY()
+	TMap<UClass*, class UMenuWidget*> MenuWidgetCache;
+
+	/**
+	 * @brief The menu classes that are being loaded asynchronously right now.
+	 */
+	TSet<FSoftObjectPath> PendingMenuLoads;
+
+	/**
+	 * @brief Shows the menu of the given class, loading the class and creating the widget on first use.
+	 *
+	 * If the class is loaded the cached widget (or a new one, which is then cached) is added to the viewport, unless
+	 * it is already showing, and gets this game instance as its menu interface. If the class is not loaded yet it
+	 * is requested from the asset manager's streamable manager and the menu is shown once it arrives, provided the
+	 * world has not changed in the meantime. Requests for a class that is still loading are ignored.
+	 *
+	 * @param MenuClass The soft class of the menu to show.
+	 * @param OnMenuShown Called with the menu widget once it is showing.
+	 */
+	void ShowMenu(
+		const TSoftClassPtr<class UUserWidget>& MenuClass,
+		TFunction<void(class UMenuWidget*)> OnMenuShown = nullptr
+	);
 	
 	/**
 	 * @class UMainMenu
@@ -508,6 +713,59 @@ private:
 	 * @endcode
 	 */
 	TSharedPtr<class FOnlineSessionSearch> GameSessionSearch;
+
+	/**
+	 * @brief The most sessions a server list refresh asks the online subsystem for.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Server List")
+	int32 MaxServerSearchResults = 100;
+
+	/**
+	 * @brief Seconds between handing the results found so far to the main menu while a session search runs.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Server List")
+	float ServerSearchPollInterval = 0.25f;
+
+	/**
+	 * @brief Timer that publishes the results of a running session search to the main menu.
+	 */
+	FTimerHandle ServerSearchPollTimerHandle;
+
+	/**
+	 * @brief The number of search results of the running search already handed to the main menu.
+	 */
+	int32 PublishedSearchResultCount = 0;
+
+	/**
+	 * @brief Hands search results to the main menu's server list.
+	 *
+	 * While the search runs only the results that arrived since the last call are converted and handed over. Once it
+	 * is complete every result is handed over, so the menu can drop the servers that are gone.
+	 *
+	 * @param bSearchComplete Whether the session search has finished.
+	 */
+	void PublishServerSearchResults(bool bSearchComplete);
+
+	/**
+	 * @brief The server info beacons still waiting for an answer, keyed by the session ID they query.
+	 */
+	TMap<FString, TWeakObjectPtr<class AServerInfoBeaconClient>> ServerInfoBeacons;
+
+	/**
+	 * @brief Hands a server info beacon's answer to the main menu.
+	 *
+	 * @param SessionId The ID of the session that was queried.
+	 * @param ServerInfo The server's live state.
+	 * @param PingInMs The round trip time of the query in milliseconds.
+	 */
+	void OnServerInfoReceived(const FString& SessionId, const struct FServerBeaconInfo& ServerInfo, int32 PingInMs);
+
+	/**
+	 * @brief Forgets a server info beacon that could not reach its server.
+	 *
+	 * @param SessionId The ID of the session that was queried.
+	 */
+	void OnServerInfoFailed(const FString& SessionId);
 	
 	/**
 	 * @brief The number of players in the game.
@@ -521,20 +779,6 @@ private:
 	 */
 	int NumPlayers = 1;
 	
-	/**
-	 * @brief A boolean variable indicating whether the game is ready to start or not.
-	 *
-	 * This variable is used to track the readiness of the game to start.
-	 * It is initially set to false and should be set to true when all the necessary preparations for the
-	 * game are complete.
-	 *
-	 * @see StartGame()
-	 *
-	 * @remark This variable should be checked before attempting to start the game to ensure that all the
-	 * required components are ready.
-	 */
-	bool bReadyToStartGame = false;
-	
 	/**
 	 * Callback function called when a game session is complete.
 	 *
@@ -561,8 +805,8 @@ private:
 	 *
 	 * @param Success Boolean value indicating whether the find sessions operation was successful.
 	 *
-	 * @note If Success is true, the function retrieves the search results and updates the server list in the menu.
-	 * If Success is false, a warning message is logged.
+	 * @note If Success is true, the function hands the complete search results to the server list in the menu.
+	 * If Success is false, a warning message is logged. Either way the polling of the running search stops.
 	 * If the GameSessionSearch object is not valid, an error message is logged and the function returns.
 	 * If no game sessions were found in the search, a message is logged.
 	 * Each found session is processed to obtain server data such as the maximum number of players, current number of
@@ -588,24 +832,47 @@ private:
 	 */
 	void OnJoinSessionComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
 	/**
-	 * @brief PlayerControllerChosenCharMap
-	 *
-	 * This variable represents a map that associates a FString key with a TSubclassOf<APC_PlayerFox> value.
-	 * It is used to store the chosen character for each player controller in the game.
-	 *
-	 * @details
-	 * The map allows multiple player controllers to choose a character from a list of available character classes.
-	 * The FString key represents a unique identifier for each player controller.
-	 * The TSubclassOf<APC_PlayerFox> value represents the chosen character class for each player controller.
-	 *
-	 * @note
-	 * It is important to note that the chosen character class must be a subclass of APC_PlayerFox, which is an actor
-	 * that represents the player controller's character in the game world.
+	 * @brief The character each player chose, keyed by the player's unique net ID.
 	 *
-	 * @see
-	 * APFC_PlayerFox
+	 * Unique net IDs survive seamless travel and, unlike display names, cannot collide between players. The classes
+	 * are kept loaded by CharacterClassHandles.
+	 */
+	TMap<FUniqueNetIdRepl, TSubclassOf<APC_PlayerFox>> ChosenCharacters;
+
+	/**
+	 * @brief The primary asset ID of the character roster, loaded by the asset manager in Init.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Characters")
+	FPrimaryAssetId CharacterRosterId;
+
+	/**
+	 * @brief The loaded character roster, or null until the asset manager delivered it.
+	 */
+	UPROPERTY()
+	class UCharacterRoster* CharacterRoster = nullptr;
+
+	/**
+	 * @brief The player blueprints by their hard-coded paths, used while CharacterRoster is not loaded, so the game
+	 * stays playable without the DA_CharacterRoster asset.
 	 */
-	std::map<FString, TSubclassOf<APC_PlayerFox>> PlayerControllerChosenCharMap;
+	UPROPERTY()
+	class UCharacterRoster* FallbackCharacterRoster = nullptr;
+
+	/**
+	 * @brief The streamable handles of the character classes loaded so far, keyed by color. Holding a handle keeps
+	 * its class in memory; they are released when returning to the main menu.
+	 */
+	TMap<FString, TSharedPtr<FStreamableHandle>> CharacterClassHandles;
+
+	/**
+	 * @brief Asks the asset manager to load the character roster, without any of the characters it lists.
+	 */
+	void LoadCharacterRoster();
+
+	/**
+	 * @brief Releases the handles of every loaded character class, so unused characters can be garbage collected.
+	 */
+	void ReleaseCharacterClasses();
 	/**
 	 * @brief The DesiredServerName variable stores the name of the desired server.
 	 *
@@ -646,9 +913,8 @@ private:
 	/**
 	 * \brief Loads a saved game.
 	 *
-	 * This function attempts to load a saved game from a specified slot. If a saved game file
-	 * exists in the slot, it is loaded into the PlayerProfile variable. If the saved game file
-	 * does not exist, a new save game object is created and saved to the slot.
+	 * This function starts an asynchronous load of the saved game in the player profile slot. The result is handled
+	 * in OnPlayerProfileLoaded, which also takes care of creating a new profile if none exists yet.
 	 *
 	 * \param None.
 	 *
@@ -657,6 +923,40 @@ private:
 	UFUNCTION(BlueprintCallable)
 	void LoadGame();
 
+	/**
+	 * @brief Completion callback for the asynchronous profile load started in LoadGame.
+	 *
+	 * Stores the loaded profile, or creates and saves a default one when the slot was empty, and then broadcasts
+	 * OnPlayerProfileReady.
+	 *
+	 * @param SlotName The name of the slot that was loaded.
+	 * @param UserIndex The platform user index the slot belongs to.
+	 * @param LoadedGame The loaded save game object, or nullptr if nothing could be loaded.
+	 */
+	void OnPlayerProfileLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame);
+
+	/**
+	 * @brief Serializes the player profile and writes it to its slot on the thread pool.
+	 *
+	 * Called by the save coalescing timer. If a previous write is still in flight the request is remembered and
+	 * issued again once that write completes.
+	 */
+	void FlushSaveGame();
+
+	/**
+	 * @brief Completion callback for the asynchronous profile write started in FlushSaveGame.
+	 *
+	 * @param SlotName The name of the slot that was written.
+	 * @param UserIndex The platform user index the slot belongs to.
+	 * @param bSuccess Whether the write succeeded.
+	 */
+	void OnPlayerProfileSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess);
+
+	/**
+	 * @brief Starts reading the progression record of the player profile on a worker thread.
+	 */
+	void LoadProgression();
+
 	/**
 	 * The PlayerProfile variable is used to store an instance of the USideScrollerSaveGame class.
 	 * This class is responsible for managing the saved game data for the player.
@@ -690,4 +990,83 @@ private:
 	 */
 	UPROPERTY()
 	FString PlayerProfileSlot = "SideScrollerPlayerProfile";
+
+	/**
+	 * @brief Whether the asynchronous profile load has completed.
+	 */
+	bool bPlayerProfileReady = false;
+
+	/**
+	 * @brief The time, in seconds, that SaveGame waits before writing so rapid changes end up in a single write.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Save Game")
+	float SaveGameCoalesceDelay = 0.5f;
+
+	/**
+	 * @brief Timer used to coalesce SaveGame requests.
+	 */
+	FTimerHandle SaveGameTimerHandle;
+
+	/**
+	 * @brief Whether a profile write is currently in flight.
+	 */
+	bool bSaveGameInFlight = false;
+
+	/**
+	 * @brief The result of the last profile write started by FlushSaveGame, waited for on Shutdown.
+	 */
+	TFuture<bool> PlayerProfileSaveFuture;
+
+	/**
+	 * @brief Whether the profile changed while a write was in flight and needs to be written again afterwards.
+	 */
+	bool bSaveGamePending = false;
+
+	/**
+	 * @brief The latest progression record, either loaded from disk or last saved.
+	 */
+	UPROPERTY()
+	FProgressionRecord SavedProgression;
+
+	/**
+	 * @brief Whether SavedProgression holds a record.
+	 */
+	bool bHasSavedProgression = false;
+
+	/**
+	 * @brief Whether the lobby starts the game at the level of the saved progression and the host's player resumes it,
+	 * set by HostSavedProgression and cleared once the progression is handed out.
+	 */
+	bool bContinueSavedProgression = false;
+
+	/**
+	 * @brief The progression writes that may still be running, waited for on Shutdown.
+	 */
+	TArray<TFuture<bool>> PendingProgressionSaves;
+
+	/**
+	 * @brief Completion callback for the async load started in PreloadLevel.
+	 *
+	 * @param PackageName The name of the package that finished loading.
+	 * @param LoadedPackage The loaded package, or nullptr if the load failed.
+	 * @param Result The result of the async load request.
+	 */
+	void OnLevelPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+	/**
+	 * @brief The name of the level package currently being preloaded or held in memory.
+	 *
+	 * Empty when no level is being preloaded.
+	 */
+	FString PreloadedLevelPackageName;
+
+	/**
+	 * @brief The world of the preloaded level package.
+	 *
+	 * Holding the package alone does not keep the world inside it reachable, so the world is what is referenced. It
+	 * is a UPROPERTY so the garbage collector keeps it, and its package through it as its outer, until the travel to
+	 * it is done.
+	 */
+	UPROPERTY()
+	UWorld* PreloadedLevelWorld = nullptr;
 };
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AudioPoolSubsystem.h"
+
+#include "AudioDevice.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Sound/SoundBase.h"
+
+/**
+ * Sets the default concurrency limits. Footsteps get the tightest one since every walking character fires them.
+ */
+UAudioPoolSubsystem::UAudioPoolSubsystem()
+{
+	CategoryVoiceLimits.Add(EAudioEventCategory::Footstep, 4);
+	CategoryVoiceLimits.Add(EAudioEventCategory::Character, 6);
+	CategoryVoiceLimits.Add(EAudioEventCategory::Pickup, 4);
+	CategoryVoiceLimits.Add(EAudioEventCategory::Interactable, 4);
+	CategoryVoiceLimits.Add(EAudioEventCategory::Projectile, 6);
+	CategoryVoiceLimits.Add(EAudioEventCategory::Level, 2);
+}
+
+/**
+ * Plays a sound attached to a component through the audio pool of the context object's world.
+ *
+ * @param WorldContextObject Any object in the world the sound is played in.
+ * @param Sound The sound to play.
+ * @param AttachTo The component the sound follows while it plays.
+ * @param Category The category whose concurrency limit applies.
+ * @return The pooled component playing the sound, or null if nothing was played.
+ */
+UAudioComponent* UAudioPoolSubsystem::PlayAttached(
+	const UObject* WorldContextObject,
+	USoundBase* Sound,
+	USceneComponent* AttachTo,
+	const EAudioEventCategory Category
+) {
+	const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+	UAudioPoolSubsystem* AudioPool = World != nullptr ? World->GetSubsystem<UAudioPoolSubsystem>() : nullptr;
+	return AudioPool != nullptr ? AudioPool->PlaySoundAttached(Sound, AttachTo, Category) : nullptr;
+}
+
+/**
+ * Plays a sound at a location through the audio pool of the context object's world.
+ *
+ * @param WorldContextObject Any object in the world the sound is played in.
+ * @param Sound The sound to play.
+ * @param Location The world location of the sound.
+ * @param Category The category whose concurrency limit applies.
+ * @return The pooled component playing the sound, or null if nothing was played.
+ */
+UAudioComponent* UAudioPoolSubsystem::PlayAtLocation(
+	const UObject* WorldContextObject,
+	USoundBase* Sound,
+	const FVector& Location,
+	const EAudioEventCategory Category
+) {
+	const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+	UAudioPoolSubsystem* AudioPool = World != nullptr ? World->GetSubsystem<UAudioPoolSubsystem>() : nullptr;
+	return AudioPool != nullptr ? AudioPool->PlaySoundAtLocation(Sound, Location, Category) : nullptr;
+}
+
+UAudioComponent* UAudioPoolSubsystem::PlaySoundAttached(
+	USoundBase* Sound,
+	USceneComponent* AttachTo,
+	const EAudioEventCategory Category
+) {
+	if (Sound == nullptr || AttachTo == nullptr || !this->CanPlayAudio()) return nullptr;
+
+	const int32 VoiceIndex = this->AcquireVoice(Category);
+	if (VoiceIndex == INDEX_NONE) return nullptr;
+
+	UAudioComponent* Component = this->Voices[VoiceIndex].Component;
+	Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	return this->StartVoice(VoiceIndex, Sound, Category);
+}
+
+UAudioComponent* UAudioPoolSubsystem::PlaySoundAtLocation(
+	USoundBase* Sound,
+	const FVector& Location,
+	const EAudioEventCategory Category
+) {
+	if (Sound == nullptr || !this->CanPlayAudio()) return nullptr;
+
+	const int32 VoiceIndex = this->AcquireVoice(Category);
+	if (VoiceIndex == INDEX_NONE) return nullptr;
+
+	this->Voices[VoiceIndex].Component->SetWorldLocation(Location);
+	return this->StartVoice(VoiceIndex, Sound, Category);
+}
+
+/**
+ * Destroys the pooled audio components along with the world.
+ */
+void UAudioPoolSubsystem::Deinitialize()
+{
+	for (FPooledAudioVoice& Voice : this->Voices)
+	{
+		if (Voice.Component == nullptr) continue;
+
+		Voice.Component->OnAudioFinishedNative.RemoveAll(this);
+		Voice.Component->DestroyComponent();
+	}
+	this->Voices.Empty();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Picks the voice for a new sound.
+ *
+ * A full category steals its own oldest voice. Otherwise an idle voice is reused, a new one is created while the
+ * pool is below MaxVoices, and as a last resort the oldest voice of any category is stolen.
+ *
+ * @param Category The category of the new sound.
+ * @return The index of the voice in Voices, or INDEX_NONE if none could be found or created.
+ */
+int32 UAudioPoolSubsystem::AcquireVoice(const EAudioEventCategory Category)
+{
+	int32 VoiceIndex = INDEX_NONE;
+
+	if (const int32* CategoryLimit = this->CategoryVoiceLimits.Find(Category))
+	{
+		int32 ActiveInCategory = 0;
+		for (const FPooledAudioVoice& Voice : this->Voices)
+		{
+			if (Voice.bActive && Voice.Category == Category) ++ActiveInCategory;
+		}
+		if (ActiveInCategory >= *CategoryLimit)
+		{
+			VoiceIndex = this->FindOldestVoice(Category);
+		}
+	}
+
+	if (VoiceIndex == INDEX_NONE)
+	{
+		VoiceIndex = this->Voices.IndexOfByPredicate([](const FPooledAudioVoice& Voice)
+		{
+			return !Voice.bActive && Voice.Component != nullptr;
+		});
+	}
+	if (VoiceIndex == INDEX_NONE && this->Voices.Num() < this->MaxVoices)
+	{
+		VoiceIndex = this->CreateVoice();
+	}
+	if (VoiceIndex == INDEX_NONE)
+	{
+		VoiceIndex = this->FindOldestVoice(TOptional<EAudioEventCategory>());
+	}
+
+	if (VoiceIndex != INDEX_NONE && this->Voices[VoiceIndex].bActive)
+	{
+		UE_LOG(LogTemp, VeryVerbose,
+			TEXT("UAudioPoolSubsystem::AcquireVoice - Stealing voice %i for category %i."),
+			VoiceIndex, static_cast<int32>(Category)
+		);
+		// free the voice here rather than in OnVoiceFinished, since the finish notification of the stopped sound may
+		// only arrive once the new sound is playing
+		this->Voices[VoiceIndex].Component->Stop();
+		this->ReleaseVoice(this->Voices[VoiceIndex]);
+	}
+	return VoiceIndex;
+}
+
+int32 UAudioPoolSubsystem::FindOldestVoice(const TOptional<EAudioEventCategory> Category) const
+{
+	int32 OldestIndex = INDEX_NONE;
+	for (int32 VoiceIndex = 0; VoiceIndex < this->Voices.Num(); ++VoiceIndex)
+	{
+		const FPooledAudioVoice& Voice = this->Voices[VoiceIndex];
+		if (!Voice.bActive || (Category.IsSet() && Voice.Category != Category.GetValue())) continue;
+
+		if (OldestIndex == INDEX_NONE || Voice.StartTime < this->Voices[OldestIndex].StartTime)
+		{
+			OldestIndex = VoiceIndex;
+		}
+	}
+	return OldestIndex;
+}
+
+int32 UAudioPoolSubsystem::CreateVoice()
+{
+	UWorld* World = this->GetWorld();
+	if (World == nullptr) return INDEX_NONE;
+
+	UAudioComponent* Component = NewObject<UAudioComponent>(World);
+	Component->bAutoActivate = false;
+	Component->bAutoDestroy = false;
+	Component->RegisterComponentWithWorld(World);
+	Component->OnAudioFinishedNative.AddUObject(this, &UAudioPoolSubsystem::OnVoiceFinished);
+
+	FPooledAudioVoice Voice;
+	Voice.Component = Component;
+	return this->Voices.Add(Voice);
+}
+
+UAudioComponent* UAudioPoolSubsystem::StartVoice(
+	const int32 VoiceIndex,
+	USoundBase* Sound,
+	const EAudioEventCategory Category
+) {
+	FPooledAudioVoice& Voice = this->Voices[VoiceIndex];
+	Voice.Component->SetSound(Sound);
+	Voice.Component->Play();
+
+	// marked after Play, which may stop (and free) a component that was still active
+	Voice.Category = Category;
+	Voice.StartTime = this->GetWorld()->GetTimeSeconds();
+	Voice.bActive = true;
+	return Voice.Component;
+}
+
+/**
+ * Frees the voice of a component that finished or was stopped, and detaches it from whatever it followed.
+ *
+ * @param Component The pooled component that stopped playing.
+ */
+void UAudioPoolSubsystem::OnVoiceFinished(UAudioComponent* Component)
+{
+	// a late notification for a stolen voice's previous sound; the voice is already playing its next one
+	if (Component->IsPlaying()) return;
+
+	FPooledAudioVoice* Voice = this->Voices.FindByPredicate([Component](const FPooledAudioVoice& PooledVoice)
+	{
+		return PooledVoice.Component == Component;
+	});
+	if (Voice == nullptr) return;
+
+	this->ReleaseVoice(*Voice);
+}
+
+/**
+ * Marks the voice idle and detaches its component from whatever it followed.
+ *
+ * @param Voice The voice to free.
+ */
+void UAudioPoolSubsystem::ReleaseVoice(FPooledAudioVoice& Voice)
+{
+	Voice.bActive = false;
+	if (Voice.Component->GetAttachParent() != nullptr)
+	{
+		Voice.Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+}
+
+bool UAudioPoolSubsystem::CanPlayAudio() const
+{
+	const UWorld* World = this->GetWorld();
+	return World != nullptr && World->GetAudioDeviceRaw() != nullptr;
+}
@@ -0,0 +1,219 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AudioPoolSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * @enum EAudioEventCategory
+ * @brief The kind of gameplay event a sound belongs to. Every category has its own concurrency limit.
+ */
+UENUM(BlueprintType)
+enum class EAudioEventCategory : uint8
+{
+	Footstep,
+	Character,
+	Pickup,
+	Interactable,
+	Projectile,
+	Level
+};
+
+/**
+ * @struct FPooledAudioVoice
+ * @brief One pooled audio component and the sound it is currently playing, if any.
+ */
+USTRUCT()
+struct FPooledAudioVoice
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The pooled audio component. Owned by the subsystem and reused for every sound it plays.
+	 */
+	UPROPERTY()
+	UAudioComponent* Component = nullptr;
+
+	/**
+	 * @brief The category of the sound the component is playing.
+	 */
+	EAudioEventCategory Category = EAudioEventCategory::Level;
+
+	/**
+	 * @brief The world time when the current sound started, used to steal the oldest voice first.
+	 */
+	double StartTime = 0.0;
+
+	/**
+	 * @brief Whether the component is playing a sound.
+	 */
+	bool bActive = false;
+};
+
+/**
+ * @class UAudioPoolSubsystem
+ * @brief Plays one-shot gameplay sounds on a fixed pool of audio components.
+ *
+ * UGameplayStatics::SpawnSoundAttached creates and registers a new UAudioComponent for every sound, which adds up
+ * to hundreds of components a minute once several players walk, jump, shoot and collect pickups. This subsystem
+ * instead keeps at most MaxVoices components per world and moves an idle one to the sound's location or attach
+ * point. Every EAudioEventCategory has a concurrency limit; when a category is full, or every voice is busy, the
+ * oldest voice is stopped and reused (voice stealing), so a burst of footsteps can never starve the other sounds.
+ *
+ * The limits can be changed in the [/Script/SideScroller.AudioPoolSubsystem] section of DefaultGame.ini. Nothing
+ * is played in worlds without an audio device, such as on a dedicated server.
+ */
+UCLASS(Config = Game)
+class SIDESCROLLER_API UAudioPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Sets the default concurrency limits of the categories.
+	 */
+	UAudioPoolSubsystem();
+
+	/**
+	 * @brief Plays a sound attached to a component through the audio pool of the context object's world.
+	 *
+	 * Drop-in replacement for UGameplayStatics::SpawnSoundAttached.
+	 *
+	 * @param WorldContextObject Any object in the world the sound is played in.
+	 * @param Sound The sound to play. Nothing is played if it is null.
+	 * @param AttachTo The component the sound follows while it plays.
+	 * @param Category The category whose concurrency limit applies.
+	 * @return The pooled component playing the sound, or null if nothing was played. Only valid until it finishes.
+	 */
+	static UAudioComponent* PlayAttached(
+		const UObject* WorldContextObject,
+		USoundBase* Sound,
+		USceneComponent* AttachTo,
+		EAudioEventCategory Category
+	);
+
+	/**
+	 * @brief Plays a sound at a location through the audio pool of the context object's world.
+	 *
+	 * Drop-in replacement for UGameplayStatics::PlaySoundAtLocation.
+	 *
+	 * @param WorldContextObject Any object in the world the sound is played in.
+	 * @param Sound The sound to play. Nothing is played if it is null.
+	 * @param Location The world location of the sound.
+	 * @param Category The category whose concurrency limit applies.
+	 * @return The pooled component playing the sound, or null if nothing was played. Only valid until it finishes.
+	 */
+	static UAudioComponent* PlayAtLocation(
+		const UObject* WorldContextObject,
+		USoundBase* Sound,
+		const FVector& Location,
+		EAudioEventCategory Category
+	);
+
+	/**
+	 * @brief Plays a sound attached to a component on a pooled voice.
+	 *
+	 * @param Sound The sound to play.
+	 * @param AttachTo The component the sound follows while it plays.
+	 * @param Category The category whose concurrency limit applies.
+	 * @return The pooled component playing the sound, or null if nothing was played.
+	 */
+	UAudioComponent* PlaySoundAttached(USoundBase* Sound, USceneComponent* AttachTo, EAudioEventCategory Category);
+
+	/**
+	 * @brief Plays a sound at a location on a pooled voice.
+	 *
+	 * @param Sound The sound to play.
+	 * @param Location The world location of the sound.
+	 * @param Category The category whose concurrency limit applies.
+	 * @return The pooled component playing the sound, or null if nothing was played.
+	 */
+	UAudioComponent* PlaySoundAtLocation(USoundBase* Sound, const FVector& Location, EAudioEventCategory Category);
+
+	/**
+	 * @brief Destroys the pooled audio components.
+	 */
+	virtual void Deinitialize() override;
+
+private:
+	/**
+	 * @brief Picks the voice for a new sound of the given category, stealing one if necessary.
+	 *
+	 * @param Category The category of the new sound.
+	 * @return The index of the voice in Voices, or INDEX_NONE if no voice could be found or created.
+	 */
+	int32 AcquireVoice(EAudioEventCategory Category);
+
+	/**
+	 * @brief Finds the voice that has been playing the longest.
+	 *
+	 * @param Category Only voices of this category are considered, unless it is not set.
+	 * @return The index of the oldest active voice, or INDEX_NONE if none is active.
+	 */
+	int32 FindOldestVoice(TOptional<EAudioEventCategory> Category) const;
+
+	/**
+	 * @brief Creates and registers a new pooled audio component.
+	 *
+	 * @return The index of the new voice in Voices, or INDEX_NONE if the world has no audio device.
+	 */
+	int32 CreateVoice();
+
+	/**
+	 * @brief Starts a sound on an acquired voice.
+	 *
+	 * @param VoiceIndex The index of the voice in Voices.
+	 * @param Sound The sound to play.
+	 * @param Category The category of the sound.
+	 * @return The component playing the sound.
+	 */
+	UAudioComponent* StartVoice(int32 VoiceIndex, USoundBase* Sound, EAudioEventCategory Category);
+
+	/**
+	 * @brief Frees the voice of a component that finished or was stopped, and detaches it.
+	 *
+	 * Ignored while the component is playing: the notification then belongs to a sound that was stopped when the
+	 * voice was stolen, and the voice has moved on to its next sound.
+	 *
+	 * @param Component The pooled component that stopped playing.
+	 */
+	void OnVoiceFinished(UAudioComponent* Component);
+
+	/**
+	 * @brief Marks a voice idle and detaches its component.
+	 *
+	 * @param Voice The voice to free.
+	 */
+	void ReleaseVoice(FPooledAudioVoice& Voice);
+
+	/**
+	 * @brief Checks whether sounds can be played in this world.
+	 *
+	 * @return False if the world has no audio device, such as on a dedicated server.
+	 */
+	bool CanPlayAudio() const;
+
+	/**
+	 * @brief The pooled voices.
+	 */
+	UPROPERTY()
+	TArray<FPooledAudioVoice> Voices;
+
+	/**
+	 * @brief The most audio components the pool creates per world.
+	 */
+	UPROPERTY(Config)
+	int32 MaxVoices = 24;
+
+	/**
+	 * @brief The most sounds of each category that play at the same time. Categories without a limit only share
+	 *        MaxVoices.
+	 */
+	UPROPERTY(Config)
+	TMap<EAudioEventCategory, int32> CategoryVoiceLimits;
+};
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CosmeticCueSubsystem.h"
+
+#include "Algo/Reverse.h"
+#include "Engine/World.h"
+#include "SideScroller/Controllers/GameModePlayerController.h"
+
+/**
+ * Sends a cue through the cosmetic cue channel of the instigator's world, from the instigator's location.
+ *
+ * @param Instigator The actor that caused the cue and plays it.
+ * @param Cue The cue to send.
+ */
+void UCosmeticCueSubsystem::SendCue(AActor* Instigator, const ECosmeticCue Cue)
+{
+	if (Instigator == nullptr || !Instigator->HasAuthority()) return;
+
+	const UWorld* World = Instigator->GetWorld();
+	UCosmeticCueSubsystem* CosmeticCues = World != nullptr ? World->GetSubsystem<UCosmeticCueSubsystem>() : nullptr;
+	if (CosmeticCues != nullptr)
+	{
+		CosmeticCues->QueueCue(Cue, Instigator, Instigator->GetActorLocation());
+	}
+}
+
+/**
+ * Plays the cue on this machine if it has a local player, and queues it for the remote players.
+ *
+ * @param Cue The cue to send.
+ * @param Instigator The actor that caused the cue and plays it.
+ * @param Location Where the cue happened.
+ */
+void UCosmeticCueSubsystem::QueueCue(const ECosmeticCue Cue, AActor* Instigator, const FVector& Location)
+{
+	FCosmeticCue CosmeticCue;
+	CosmeticCue.Cue = Cue;
+	CosmeticCue.Location = Location;
+	CosmeticCue.Instigator = Instigator;
+
+	const ENetMode NetMode = this->GetWorld()->GetNetMode();
+	if (NetMode != NM_DedicatedServer)
+	{
+		PlayCue(CosmeticCue);
+	}
+	if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer)
+	{
+		this->PendingCues.Add(CosmeticCue);
+	}
+}
+
+/**
+ * Plays the cues the server sent this client.
+ *
+ * @param Cues The cues the server sent.
+ */
+void UCosmeticCueSubsystem::ReceiveCues(const TArray<FCosmeticCue>& Cues) const
+{
+	for (const FCosmeticCue& Cue : Cues)
+	{
+		PlayCue(Cue);
+	}
+}
+
+/**
+ * Sends every remote player the queued cues that happened near its view or were instigated by its own pawn.
+ *
+ * @param DeltaTime Time since the last tick.
+ */
+void UCosmeticCueSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	if (this->PendingCues.IsEmpty()) return;
+
+	const float RelevancyDistanceSquared = FMath::Square(this->CueRelevancyDistance);
+	TArray<FCosmeticCue> Batch;
+
+	for (FConstPlayerControllerIterator It = this->GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		AGameModePlayerController* PlayerController = Cast<AGameModePlayerController>(It->Get());
+		if (PlayerController == nullptr || PlayerController->IsLocalController()) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		Batch.Reset();
+		// walk the queue backwards so a full batch keeps the newest cues
+		for (int32 CueIndex = this->PendingCues.Num() - 1; CueIndex >= 0; --CueIndex)
+		{
+			const FCosmeticCue& Cue = this->PendingCues[CueIndex];
+			const bool bOwnCue = Cue.Instigator != nullptr && Cue.Instigator->GetNetOwner() == PlayerController;
+			if (bOwnCue || FVector::DistSquared(Cue.Location, ViewLocation) <= RelevancyDistanceSquared)
+			{
+				Batch.Add(Cue);
+				if (Batch.Num() >= this->MaxCuesPerBatch) break;
+			}
+		}
+
+		if (!Batch.IsEmpty())
+		{
+			Algo::Reverse(Batch);
+			PlayerController->ClientReceiveCosmeticCues(Batch);
+		}
+	}
+	this->PendingCues.Reset();
+}
+
+TStatId UCosmeticCueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCosmeticCueSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * Hands the cue to its instigator, which knows the sounds and flipbooks it stands for.
+ *
+ * @param Cue The cue to play.
+ */
+void UCosmeticCueSubsystem::PlayCue(const FCosmeticCue& Cue)
+{
+	if (ICosmeticCueInterface* CueInstigator = Cast<ICosmeticCueInterface>(Cue.Instigator))
+	{
+		CueInstigator->PlayCosmeticCue(Cue.Cue, Cue.Location);
+		return;
+	}
+	UE_LOG(LogTemp, VeryVerbose,
+		TEXT("UCosmeticCueSubsystem::PlayCue - Dropping cue %i without a resolvable instigator."),
+		static_cast<int32>(Cue.Cue)
+	);
+}
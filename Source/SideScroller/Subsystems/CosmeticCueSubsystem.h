@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SideScroller/Interfaces/CosmeticCueInterface.h"
+#include "CosmeticCueSubsystem.generated.h"
+
+/**
+ * @struct FCosmeticCue
+ * @brief One cosmetic event as it is sent to clients: what happened, where, and who caused it.
+ */
+USTRUCT()
+struct FCosmeticCue
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief What happened.
+	 */
+	UPROPERTY()
+	ECosmeticCue Cue = ECosmeticCue::Hurt;
+
+	/**
+	 * @brief Where it happened, rounded to whole units.
+	 */
+	UPROPERTY()
+	FVector_NetQuantize Location;
+
+	/**
+	 * @brief The actor that caused it, which plays it on the receiving machine. Null on clients the actor is not
+	 *        relevant to.
+	 */
+	UPROPERTY()
+	AActor* Instigator = nullptr;
+};
+
+/**
+ * @class UCosmeticCueSubsystem
+ * @brief A single, unreliable, distance-filtered channel for purely cosmetic events.
+ *
+ * Hurt sounds, door and lever sounds used to be separate reliable multicast RPCs, each sent to every client
+ * as soon as it happened and competing with gameplay state for the reliable buffer. Instead the server queues a
+ * small FCosmeticCue record here. Once per frame, after the actors ticked and before the net driver flushes, the
+ * queued cues are sent to every remote player controller in one unreliable RPC. Only the cues that happened within
+ * CueRelevancyDistance of the player's view, or that the player's own pawn instigated, are sent. A dropped batch
+ * only means a missing sound.
+ *
+ * Machines with a local player (listen servers and standalone games) play a cue as soon as it is queued. Clients
+ * play the cues they receive by handing them to the instigator's ICosmeticCueInterface.
+ */
+UCLASS(Config = Game)
+class SIDESCROLLER_API UCosmeticCueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Sends a cue through the cosmetic cue channel of the instigator's world.
+	 *
+	 * Ignored where the instigator has no authority, since the server sends every cue.
+	 *
+	 * @param Instigator The actor that caused the cue and plays it. Must implement ICosmeticCueInterface.
+	 * @param Cue The cue to send.
+	 */
+	static void SendCue(AActor* Instigator, ECosmeticCue Cue);
+
+	/**
+	 * @brief Plays the cue locally, if there is a local player, and queues it for the remote players.
+	 *
+	 * @param Cue The cue to send.
+	 * @param Instigator The actor that caused the cue and plays it.
+	 * @param Location Where the cue happened.
+	 */
+	void QueueCue(ECosmeticCue Cue, AActor* Instigator, const FVector& Location);
+
+	/**
+	 * @brief Plays a batch of cues received from the server.
+	 *
+	 * @param Cues The cues the server sent this client.
+	 */
+	void ReceiveCues(const TArray<FCosmeticCue>& Cues) const;
+
+	/**
+	 * @brief Sends the cues queued this frame to the remote players they are relevant to.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+private:
+	/**
+	 * @brief Asks the cue's instigator to play it.
+	 *
+	 * @param Cue The cue to play.
+	 */
+	static void PlayCue(const FCosmeticCue& Cue);
+
+	/**
+	 * @brief The cues queued since the last tick.
+	 */
+	UPROPERTY()
+	TArray<FCosmeticCue> PendingCues;
+
+	/**
+	 * @brief How far from a player's view a cue may happen and still be sent to that player.
+	 */
+	UPROPERTY(Config)
+	float CueRelevancyDistance = 2500.f;
+
+	/**
+	 * @brief The most cues sent to one player per frame. Cues beyond it are dropped, oldest first.
+	 */
+	UPROPERTY(Config)
+	int32 MaxCuesPerBatch = 32;
+};
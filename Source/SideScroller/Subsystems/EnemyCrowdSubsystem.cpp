@@ -0,0 +1,521 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyCrowdSubsystem.h"
+
+#include "EngineUtils.h"
+#include "PaperFlipbookComponent.h"
+#include "PaperGroupedSpriteComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "SideScroller/Characters/Enemies/EnemyCollisionPaperCharacter.h"
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/Projectiles/BaseProjectile.h"
+#include "SideScroller/Subsystems/PlatformNavigationSubsystem.h"
+
+namespace EnemyCrowd
+{
+	/**
+	 * Gets the rotation of a walker facing the given way, as enemies turn to face left.
+	 *
+	 * @param Facing 1 for right, -1 for left.
+	 * @return The rotation.
+	 */
+	static FRotator GetFacingRotation(const float Facing)
+	{
+		return FRotator(0.f, Facing < 0.f ? 180.f : 0.f, 0.f);
+	}
+}
+
+/**
+ * Adds the spawner's walkers to the arrays, working out what they share from the walker class's defaults, and adds
+ * one sprite instance per walker. A crowd that is already registered only takes the walkers' new state.
+ *
+ * @param Spawner The spawner of the crowd.
+ */
+void UEnemyCrowdSubsystem::RegisterCrowd(AEnemyCrowdSpawner* Spawner)
+{
+	if (Spawner == nullptr) return;
+
+	const TArray<FEnemyCrowdWalker>& SpawnerWalkers = Spawner->GetWalkers();
+	int32 CrowdIndex = this->FindCrowd(Spawner);
+	if (CrowdIndex != INDEX_NONE && this->Crowds[CrowdIndex].NumWalkers != SpawnerWalkers.Num())
+	{
+		this->UnregisterCrowd(Spawner);
+		CrowdIndex = INDEX_NONE;
+	}
+
+	if (CrowdIndex != INDEX_NONE)
+	{
+		const FEnemyCrowd& Crowd = this->Crowds[CrowdIndex];
+		for (int32 Index = 0; Index < Crowd.NumWalkers; ++Index)
+		{
+			this->Walks[Crowd.FirstWalker + Index] = SpawnerWalkers[Index];
+		}
+		return;
+	}
+
+	CrowdIndex = this->Crowds.AddDefaulted();
+	FEnemyCrowd& Crowd = this->Crowds[CrowdIndex];
+	Crowd.Spawner = Spawner;
+	Crowd.FirstWalker = this->Walks.Num();
+	Crowd.NumWalkers = SpawnerWalkers.Num();
+	Crowd.PlaneY = Spawner->GetActorLocation().Y;
+
+	if (const UClass* WalkerClass = Spawner->GetWalkerClass())
+	{
+		const AEnemyCollisionPaperCharacter* WalkerDefaults =
+			WalkerClass->GetDefaultObject<AEnemyCollisionPaperCharacter>();
+		const UCapsuleComponent* Capsule = WalkerDefaults->GetCapsuleComponent();
+		Crowd.HalfWidth = Capsule->GetScaledCapsuleRadius();
+		Crowd.FloorOffset = Capsule->GetScaledCapsuleHalfHeight();
+		Crowd.DefaultHealth = WalkerDefaults->GetDefaultHealth();
+		Crowd.SpriteTransform = WalkerDefaults->GetSprite()->GetRelativeTransform();
+
+		const FVector CapsuleExtent(Crowd.HalfWidth, Crowd.HalfWidth, Crowd.FloorOffset);
+		FBox ContactBox = FBox::BuildAABB(FVector::ZeroVector, CapsuleExtent);
+		for (const UBoxComponent* Box : {
+			WalkerDefaults->GetDamageBox(), WalkerDefaults->GetLeftHurtBox(), WalkerDefaults->GetRightHurtBox()
+		}) {
+			if (Box == nullptr) continue;
+			const FVector Extent = Box->GetUnscaledBoxExtent() * Box->GetRelativeScale3D().GetAbs();
+			ContactBox += FBox::BuildAABB(Box->GetRelativeLocation(), Extent);
+		}
+		Crowd.ContactExtent = ContactBox.Min.GetAbs().ComponentMax(ContactBox.Max.GetAbs());
+	}
+
+	this->Walks.Append(SpawnerWalkers);
+	this->Positions.AddZeroed(Crowd.NumWalkers);
+	this->Velocities.AddZeroed(Crowd.NumWalkers);
+	this->PromotedActors.AddDefaulted(Crowd.NumWalkers);
+	for (int32 Index = 0; Index < Crowd.NumWalkers; ++Index)
+	{
+		this->Facings.Add(1.f);
+		this->Healths.Add(Crowd.DefaultHealth);
+		this->WalkerCrowds.Add(CrowdIndex);
+	}
+
+	if (GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		UPaperGroupedSpriteComponent* WalkerSprites = Spawner->GetWalkerSprites();
+		UPaperSprite* WalkerSprite = Spawner->GetWalkerSprite();
+		WalkerSprites->ClearInstances();
+		for (int32 Index = 0; Index < Crowd.NumWalkers; ++Index)
+		{
+			WalkerSprites->AddInstance(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector),
+				WalkerSprite, true
+			);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UEnemyCrowdSubsystem::RegisterCrowd - %s added %i walkers, %i in total."),
+		*Spawner->GetName(), Crowd.NumWalkers, this->Walks.Num()
+	);
+}
+
+/**
+ * Destroys the actors the crowd's walkers were promoted to and removes its range from every array, moving the later
+ * crowds down.
+ *
+ * @param Spawner The spawner of the crowd.
+ */
+void UEnemyCrowdSubsystem::UnregisterCrowd(const AEnemyCrowdSpawner* Spawner)
+{
+	const int32 CrowdIndex = this->FindCrowd(Spawner);
+	if (CrowdIndex == INDEX_NONE) return;
+
+	const int32 FirstWalker = this->Crowds[CrowdIndex].FirstWalker;
+	const int32 NumWalkers = this->Crowds[CrowdIndex].NumWalkers;
+	for (int32 WalkerIndex = FirstWalker; WalkerIndex < FirstWalker + NumWalkers; ++WalkerIndex)
+	{
+		if (AEnemyCollisionPaperCharacter* Actor = this->PromotedActors[WalkerIndex].Get())
+		{
+			Actor->Destroy();
+		}
+	}
+
+	this->Walks.RemoveAt(FirstWalker, NumWalkers);
+	this->Positions.RemoveAt(FirstWalker, NumWalkers);
+	this->Velocities.RemoveAt(FirstWalker, NumWalkers);
+	this->Facings.RemoveAt(FirstWalker, NumWalkers);
+	this->Healths.RemoveAt(FirstWalker, NumWalkers);
+	this->WalkerCrowds.RemoveAt(FirstWalker, NumWalkers);
+	this->PromotedActors.RemoveAt(FirstWalker, NumWalkers);
+	this->Crowds.RemoveAt(CrowdIndex);
+
+	for (int32 Index = CrowdIndex; Index < this->Crowds.Num(); ++Index)
+	{
+		this->Crowds[Index].FirstWalker -= NumWalkers;
+	}
+	for (int32& WalkerCrowd : this->WalkerCrowds)
+	{
+		if (WalkerCrowd > CrowdIndex) --WalkerCrowd;
+	}
+}
+
+/**
+ * Destroys the crowd's promoted actors, restores the walkers' health and takes their state from the spawner.
+ *
+ * @param Spawner The spawner of the crowd.
+ */
+void UEnemyCrowdSubsystem::ResetCrowd(AEnemyCrowdSpawner* Spawner)
+{
+	const int32 CrowdIndex = this->FindCrowd(Spawner);
+	if (CrowdIndex == INDEX_NONE) return;
+
+	const FEnemyCrowd& Crowd = this->Crowds[CrowdIndex];
+	for (int32 WalkerIndex = Crowd.FirstWalker; WalkerIndex < Crowd.FirstWalker + Crowd.NumWalkers; ++WalkerIndex)
+	{
+		if (AEnemyCollisionPaperCharacter* Actor = this->PromotedActors[WalkerIndex].Get())
+		{
+			Actor->Destroy();
+		}
+		this->PromotedActors[WalkerIndex] = nullptr;
+		this->Healths[WalkerIndex] = Crowd.DefaultHealth;
+	}
+	this->RegisterCrowd(Spawner);
+}
+
+/**
+ * Promotes a walker to a real enemy actor right away.
+ *
+ * @param Spawner The spawner of the walker's crowd.
+ * @param WalkerIndex The index of the walker in the crowd.
+ * @return The actor, or nullptr if the walker is not walking or could not be promoted.
+ */
+AEnemyCollisionPaperCharacter* UEnemyCrowdSubsystem::PromoteWalker(
+	const AEnemyCrowdSpawner* Spawner,
+	const int32 WalkerIndex
+) {
+	const int32 CrowdIndex = this->FindCrowd(Spawner);
+	if (CrowdIndex == INDEX_NONE || GetWorld()->GetNetMode() == NM_Client) return nullptr;
+
+	const FEnemyCrowd& Crowd = this->Crowds[CrowdIndex];
+	if (WalkerIndex < 0 || WalkerIndex >= Crowd.NumWalkers) return nullptr;
+	if (this->Walks[Crowd.FirstWalker + WalkerIndex].State != EEnemyCrowdWalkerState::Walking) return nullptr;
+
+	return this->Promote(Crowd.FirstWalker + WalkerIndex);
+}
+
+/**
+ * Runs the passes over every walker. The contact and promoted passes only run where the game is simulated, the
+ * draw pass only where it is seen.
+ *
+ * @param DeltaTime Time since the last tick.
+ */
+void UEnemyCrowdSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	if (this->Walks.Num() == 0) return;
+
+	const double ServerTime = this->GetServerTime();
+	this->UpdateWalkers(ServerTime);
+
+	const ENetMode NetMode = GetWorld()->GetNetMode();
+	if (NetMode != NM_Client)
+	{
+		TArray<FCrowdThreat> Threats;
+		this->GatherThreats(Threats);
+		this->CheckContacts(Threats);
+		this->UpdatePromotedActors(Threats, ServerTime);
+	}
+
+	if (NetMode != NM_DedicatedServer)
+	{
+		this->UpdateInstances();
+	}
+}
+
+TStatId UEnemyCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyCrowdSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * Finds the crowd of a spawner.
+ *
+ * @param Spawner The spawner.
+ * @return The index of its crowd, or INDEX_NONE if it is not registered.
+ */
+int32 UEnemyCrowdSubsystem::FindCrowd(const AEnemyCrowdSpawner* Spawner) const
+{
+	return this->Crowds.IndexOfByPredicate([Spawner](const FEnemyCrowd& Crowd)
+	{
+		return Crowd.Spawner.Get() == Spawner;
+	});
+}
+
+/**
+ * The walk pass. A walker goes from MinX to MaxX and back at its speed, so the distance it has covered since server
+ * time 0, wrapped to one round trip, gives both where it is and which way it faces; the floor between the ends of its
+ * stretch is taken to be straight.
+ *
+ * @param ServerTime The server world time.
+ */
+void UEnemyCrowdSubsystem::UpdateWalkers(const double ServerTime)
+{
+	for (const FEnemyCrowd& Crowd : this->Crowds)
+	{
+		for (int32 WalkerIndex = Crowd.FirstWalker; WalkerIndex < Crowd.FirstWalker + Crowd.NumWalkers; ++WalkerIndex)
+		{
+			const FEnemyCrowdWalker& Walk = this->Walks[WalkerIndex];
+			if (Walk.State != EEnemyCrowdWalkerState::Walking) continue;
+
+			const double Length = FMath::Max<double>(Walk.MaxX - Walk.MinX, KINDA_SMALL_NUMBER);
+			double Distance = FMath::Fmod(Walk.WalkOffset + Walk.Speed * ServerTime, 2.0 * Length);
+			if (Distance < 0.0) Distance += 2.0 * Length;
+
+			const float Facing = Distance < Length ? 1.f : -1.f;
+			const double X = Facing > 0.f ? Walk.MinX + Distance : Walk.MaxX - (Distance - Length);
+			const double Slope = (Walk.RightZ - Walk.LeftZ) / Length;
+
+			this->Facings[WalkerIndex] = Facing;
+			this->Positions[WalkerIndex] = FVector(
+				X, Crowd.PlaneY, Walk.LeftZ + (X - Walk.MinX) * Slope + Crowd.FloorOffset
+			);
+			this->Velocities[WalkerIndex] = FVector(Facing * Walk.Speed, 0.f, Facing * Walk.Speed * Slope);
+		}
+	}
+}
+
+/**
+ * Collects the living player foxes and the projectiles they shot.
+ *
+ * @param OutThreats The players and projectiles, with the half size of their collision.
+ */
+void UEnemyCrowdSubsystem::GatherThreats(TArray<FCrowdThreat>& OutThreats) const
+{
+	UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World->GetGameState();
+	if (GameState == nullptr) return;
+
+	for (const APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		const APC_PlayerFox* PlayerFox = PlayerState ? Cast<APC_PlayerFox>(PlayerState->GetPawn()) : nullptr;
+		if (PlayerFox == nullptr || PlayerFox->IsDead()) continue;
+
+		float Radius, HalfHeight;
+		PlayerFox->GetSimpleCollisionCylinder(Radius, HalfHeight);
+		OutThreats.Add({PlayerFox->GetActorLocation(), FVector(Radius, Radius, HalfHeight)});
+	}
+
+	for (TActorIterator<ABaseProjectile> It(World); It; ++It)
+	{
+		if (Cast<APC_PlayerFox>(It->GetOwner()) == nullptr) continue;
+
+		float Radius, HalfHeight;
+		It->GetSimpleCollisionCylinder(Radius, HalfHeight);
+		OutThreats.Add({It->GetActorLocation(), FVector(Radius, Radius, HalfHeight)});
+	}
+}
+
+/**
+ * The contact pass. A walker is about to be touched when the box around its collision, grown by PromotionDistance,
+ * overlaps a player's or a projectile's in the X-Z plane.
+ *
+ * @param Threats The players and projectiles.
+ */
+void UEnemyCrowdSubsystem::CheckContacts(const TArray<FCrowdThreat>& Threats)
+{
+	if (Threats.Num() == 0) return;
+
+	int32 NumPromoted = 0;
+	for (const FEnemyCrowd& Crowd : this->Crowds)
+	{
+		const FVector Extent = Crowd.ContactExtent + FVector(this->PromotionDistance);
+		for (int32 WalkerIndex = Crowd.FirstWalker; WalkerIndex < Crowd.FirstWalker + Crowd.NumWalkers; ++WalkerIndex)
+		{
+			if (this->Walks[WalkerIndex].State != EEnemyCrowdWalkerState::Walking) continue;
+
+			const FVector& Position = this->Positions[WalkerIndex];
+			for (const FCrowdThreat& Threat : Threats)
+			{
+				if (FMath::Abs(Position.X - Threat.Center.X) > Extent.X + Threat.Extent.X) continue;
+				if (FMath::Abs(Position.Z - Threat.Center.Z) > Extent.Z + Threat.Extent.Z) continue;
+
+				if (this->Promote(WalkerIndex) != nullptr && ++NumPromoted >= this->MaxPromotionsPerFrame) return;
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * The promoted pass. Walkers whose actor is gone or dead are dead until the level is reset; the actor plays its own
+ * death and is destroyed by it. Promoted walkers standing on the ground with no player or projectile within
+ * DemotionDistance are demoted.
+ *
+ * @param Threats The players and projectiles.
+ * @param ServerTime The server world time.
+ */
+void UEnemyCrowdSubsystem::UpdatePromotedActors(const TArray<FCrowdThreat>& Threats, const double ServerTime)
+{
+	for (int32 WalkerIndex = 0; WalkerIndex < this->Walks.Num(); ++WalkerIndex)
+	{
+		if (this->Walks[WalkerIndex].State != EEnemyCrowdWalkerState::Promoted) continue;
+
+		const AEnemyCollisionPaperCharacter* Actor = this->PromotedActors[WalkerIndex].Get();
+		if (Actor == nullptr || Actor->IsActorBeingDestroyed() || Actor->IsDead())
+		{
+			this->PromotedActors[WalkerIndex] = nullptr;
+			this->SetWalkerState(WalkerIndex, EEnemyCrowdWalkerState::Dead);
+			continue;
+		}
+
+		this->Positions[WalkerIndex] = Actor->GetActorLocation();
+		if (Actor->GetCharacterMovement()->IsFalling()) continue;
+
+		const bool bThreatNear = Threats.ContainsByPredicate([this, WalkerIndex](const FCrowdThreat& Threat)
+		{
+			return FVector::Dist(this->Positions[WalkerIndex], Threat.Center) <= this->DemotionDistance;
+		});
+		if (!bThreatNear)
+		{
+			this->Demote(WalkerIndex, ServerTime);
+		}
+	}
+}
+
+/**
+ * The draw pass. Walking walkers get their instance placed and turned the way they face; promoted and dead ones get
+ * theirs scaled to nothing. The render state is marked dirty once per crowd.
+ */
+void UEnemyCrowdSubsystem::UpdateInstances() const
+{
+	for (const FEnemyCrowd& Crowd : this->Crowds)
+	{
+		const AEnemyCrowdSpawner* Spawner = Crowd.Spawner.Get();
+		UPaperGroupedSpriteComponent* WalkerSprites = Spawner ? Spawner->GetWalkerSprites() : nullptr;
+		if (WalkerSprites == nullptr || WalkerSprites->GetInstanceCount() != Crowd.NumWalkers) continue;
+
+		for (int32 Index = 0; Index < Crowd.NumWalkers; ++Index)
+		{
+			const int32 WalkerIndex = Crowd.FirstWalker + Index;
+			const FTransform Transform = this->Walks[WalkerIndex].State == EEnemyCrowdWalkerState::Walking
+				? Crowd.SpriteTransform * FTransform(
+					EnemyCrowd::GetFacingRotation(this->Facings[WalkerIndex]), this->Positions[WalkerIndex]
+				)
+				: FTransform(FQuat::Identity, this->Positions[WalkerIndex], FVector::ZeroVector);
+			WalkerSprites->UpdateInstanceTransform(Index, Transform, true, Index == Crowd.NumWalkers - 1, true);
+		}
+	}
+}
+
+/**
+ * Spawns the walker class where the walker is, facing and moving the way it was, with the walker's health. The
+ * spawner owns the actor, which keeps it out of the level reset pool since the crowd resets it instead.
+ *
+ * @param WalkerIndex The index of the walker in the arrays.
+ * @return The actor, or nullptr if it could not be spawned.
+ */
+AEnemyCollisionPaperCharacter* UEnemyCrowdSubsystem::Promote(const int32 WalkerIndex)
+{
+	AEnemyCrowdSpawner* Spawner = this->Crowds[this->WalkerCrowds[WalkerIndex]].Spawner.Get();
+	if (Spawner == nullptr || Spawner->GetWalkerClass() == nullptr) return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Spawner;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AEnemyCollisionPaperCharacter* Actor = GetWorld()->SpawnActor<AEnemyCollisionPaperCharacter>(
+		Spawner->GetWalkerClass(),
+		this->Positions[WalkerIndex],
+		EnemyCrowd::GetFacingRotation(this->Facings[WalkerIndex]),
+		SpawnParams
+	);
+	if (Actor == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UEnemyCrowdSubsystem::Promote - Could not spawn a walker of %s."),
+			*Spawner->GetName()
+		);
+		return nullptr;
+	}
+
+	if (Actor->GetController() == nullptr)
+	{
+		Actor->SpawnDefaultController();
+	}
+	Actor->SetHealth(this->Healths[WalkerIndex]);
+	Actor->GetCharacterMovement()->Velocity = this->Velocities[WalkerIndex];
+
+	this->PromotedActors[WalkerIndex] = Actor;
+	this->SetWalkerState(WalkerIndex, EEnemyCrowdWalkerState::Promoted);
+	return Actor;
+}
+
+/**
+ * Gives the walker the platform its actor stands on, with the walk offset that puts it where the actor is, facing
+ * the way the actor faces, right now. Its health is kept and the actor is destroyed.
+ *
+ * @param WalkerIndex The index of the walker in the arrays.
+ * @param ServerTime The server world time.
+ * @return False if the actor does not stand on a platform long enough to walk.
+ */
+bool UEnemyCrowdSubsystem::Demote(const int32 WalkerIndex, const double ServerTime)
+{
+	AEnemyCollisionPaperCharacter* Actor = this->PromotedActors[WalkerIndex].Get();
+	const UPlatformNavigationSubsystem* Navigation = GetWorld()->GetSubsystem<UPlatformNavigationSubsystem>();
+	if (Actor == nullptr || Navigation == nullptr) return false;
+
+	const FEnemyCrowd& Crowd = this->Crowds[this->WalkerCrowds[WalkerIndex]];
+	const FVector Location = Actor->GetActorLocation();
+	const FPlatformNavNode* Node = Navigation->GetNode(
+		Navigation->FindNode(Location - FVector(0.f, 0.f, Crowd.FloorOffset))
+	);
+	if (Node == nullptr) return false;
+
+	FEnemyCrowdWalker& Walk = this->Walks[WalkerIndex];
+	const float MinX = Node->MinX + Crowd.HalfWidth;
+	const float MaxX = Node->MaxX - Crowd.HalfWidth;
+	if (MaxX - MinX < Crowd.HalfWidth) return false;
+
+	const double Length = MaxX - MinX;
+	const double Along = FMath::Clamp(Location.X - MinX, 0.0, Length);
+	const bool bFacingLeft = FMath::IsNearlyEqual(FMath::Abs(Actor->GetActorRotation().Yaw), 180.f, 1.f);
+	const double Distance = bFacingLeft ? 2.0 * Length - Along : Along;
+	double WalkOffset = FMath::Fmod(Distance - Walk.Speed * ServerTime, 2.0 * Length);
+	if (WalkOffset < 0.0) WalkOffset += 2.0 * Length;
+
+	Walk.MinX = MinX;
+	Walk.MaxX = MaxX;
+	Walk.LeftZ = Node->GetFloorZ(MinX);
+	Walk.RightZ = Node->GetFloorZ(MaxX);
+	Walk.WalkOffset = static_cast<float>(WalkOffset);
+	this->Healths[WalkerIndex] = Actor->GetHealth();
+	this->PromotedActors[WalkerIndex] = nullptr;
+	Actor->Destroy();
+
+	this->SetWalkerState(WalkerIndex, EEnemyCrowdWalkerState::Walking);
+	return true;
+}
+
+/**
+ * Changes a walker's state and hands the whole walker to its spawner to replicate.
+ *
+ * @param WalkerIndex The index of the walker in the arrays.
+ * @param State The new state.
+ */
+void UEnemyCrowdSubsystem::SetWalkerState(const int32 WalkerIndex, const EEnemyCrowdWalkerState State)
+{
+	this->Walks[WalkerIndex].State = State;
+
+	const FEnemyCrowd& Crowd = this->Crowds[this->WalkerCrowds[WalkerIndex]];
+	if (AEnemyCrowdSpawner* Spawner = Crowd.Spawner.Get())
+	{
+		Spawner->SetWalker(WalkerIndex - Crowd.FirstWalker, this->Walks[WalkerIndex]);
+	}
+}
+
+/**
+ * Gets the synchronized server world time.
+ *
+ * @return The server world time, or the local world time while the game state is not replicated yet.
+ */
+double UEnemyCrowdSubsystem::GetServerTime() const
+{
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	return GameState != nullptr ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
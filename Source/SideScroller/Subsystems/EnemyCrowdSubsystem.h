@@ -0,0 +1,234 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SideScroller/Characters/Enemies/EnemyCrowdSpawner.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyCrowdSubsystem.generated.h"
+
+class AEnemyCollisionPaperCharacter;
+
+/**
+ * @class UEnemyCrowdSubsystem
+ * @brief Walks, checks and draws the walkers of every enemy crowd of the level in batch.
+ *
+ * The walkers are not objects but entries in parallel arrays, one per kind of data (walk, position, velocity,
+ * facing, health, promoted actor), with the walkers of each crowd next to each other and what is shared by a crowd
+ * (the size of its walkers, the sprite transform) stored once. Every frame a few passes run over the arrays:
+ *   - the walk pass moves every walker along its platform and turns it at the ends, on every machine;
+ *   - the contact pass, on the server, checks every walker against the players and their projectiles and promotes
+ *     the ones about to be touched to real enemy actors, at most MaxPromotionsPerFrame per frame;
+ *   - the promoted pass, on the server, marks walkers whose actor died as dead, and demotes those whose actor is
+ *     standing on a platform with no player or projectile within DemotionDistance back to crowd data;
+ *   - the draw pass moves the grouped sprite instances, except on dedicated servers.
+ */
+UCLASS(Config = Game)
+class SIDESCROLLER_API UEnemyCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Adds the spawner's walkers to the arrays, or updates them from its replicated state if already added.
+	 *
+	 * A crowd whose number of walkers changed is added again from scratch.
+	 *
+	 * @param Spawner The spawner of the crowd.
+	 */
+	void RegisterCrowd(AEnemyCrowdSpawner* Spawner);
+
+	/**
+	 * @brief Removes the spawner's walkers from the arrays and destroys the actors they were promoted to.
+	 *
+	 * @param Spawner The spawner of the crowd.
+	 */
+	void UnregisterCrowd(const AEnemyCrowdSpawner* Spawner);
+
+	/**
+	 * @brief Destroys the actors the crowd's walkers were promoted to and takes the walkers from the spawner again
+	 * with full health. Called after the spawner restored its initial walkers.
+	 *
+	 * @param Spawner The spawner of the crowd.
+	 */
+	void ResetCrowd(AEnemyCrowdSpawner* Spawner);
+
+	/**
+	 * @brief Promotes a walker to a real enemy actor right away, for behaviour the crowd does not do. Server only.
+	 *
+	 * @param Spawner The spawner of the walker's crowd.
+	 * @param WalkerIndex The index of the walker in the crowd.
+	 * @return The actor, or nullptr if the walker is not walking or could not be promoted.
+	 */
+	AEnemyCollisionPaperCharacter* PromoteWalker(const AEnemyCrowdSpawner* Spawner, int32 WalkerIndex);
+
+	/**
+	 * @brief Runs the walk, contact, promoted and draw passes.
+	 *
+	 * @param DeltaTime Time since the last tick.
+	 */
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+private:
+	/**
+	 * @struct FEnemyCrowd
+	 * @brief A crowd's range in the arrays and the data its walkers share.
+	 */
+	struct FEnemyCrowd
+	{
+		TWeakObjectPtr<AEnemyCrowdSpawner> Spawner;
+
+		/**
+		 * @brief The index of the crowd's first walker in the arrays, and how many it has.
+		 */
+		int32 FirstWalker = 0;
+		int32 NumWalkers = 0;
+
+		/**
+		 * @brief Half the size of the box around a walker's capsule, damage box and hurt boxes, either way it faces.
+		 */
+		FVector ContactExtent = FVector::ZeroVector;
+
+		/**
+		 * @brief The walker's capsule radius and half height: how far it turns before the end of its platform, and how
+		 * far above the floor its location is.
+		 */
+		float HalfWidth = 0.f;
+		float FloorOffset = 0.f;
+
+		/**
+		 * @brief The Y of the plane the crowd walks in.
+		 */
+		float PlaneY = 0.f;
+
+		/**
+		 * @brief The health walkers start with.
+		 */
+		float DefaultHealth = 0.f;
+
+		/**
+		 * @brief The transform of the walker class's sprite relative to its location.
+		 */
+		FTransform SpriteTransform;
+	};
+
+	/**
+	 * @struct FCrowdThreat
+	 * @brief Something that makes walkers near it become actors: a player or a player's projectile.
+	 */
+	struct FCrowdThreat
+	{
+		FVector Center = FVector::ZeroVector;
+		FVector Extent = FVector::ZeroVector;
+	};
+
+	/**
+	 * @brief Finds the crowd of a spawner.
+	 *
+	 * @param Spawner The spawner.
+	 * @return The index of its crowd, or INDEX_NONE if it is not registered.
+	 */
+	int32 FindCrowd(const AEnemyCrowdSpawner* Spawner) const;
+
+	/**
+	 * @brief Works out where every walking walker is and which way it faces at the given time.
+	 *
+	 * @param ServerTime The server world time.
+	 */
+	void UpdateWalkers(double ServerTime);
+
+	/**
+	 * @brief Collects the living players and their projectiles.
+	 *
+	 * @param OutThreats The players and projectiles, with the half size of their collision.
+	 */
+	void GatherThreats(TArray<FCrowdThreat>& OutThreats) const;
+
+	/**
+	 * @brief Promotes the walkers within PromotionDistance of touching a player or a projectile.
+	 *
+	 * @param Threats The players and projectiles.
+	 */
+	void CheckContacts(const TArray<FCrowdThreat>& Threats);
+
+	/**
+	 * @brief Marks walkers whose actor died as dead and demotes those no longer near a player or a projectile.
+	 *
+	 * @param Threats The players and projectiles.
+	 * @param ServerTime The server world time.
+	 */
+	void UpdatePromotedActors(const TArray<FCrowdThreat>& Threats, double ServerTime);
+
+	/**
+	 * @brief Moves the sprite instances of walking walkers to them and hides the others.
+	 */
+	void UpdateInstances() const;
+
+	/**
+	 * @brief Replaces a walking walker with a real enemy actor.
+	 *
+	 * @param WalkerIndex The index of the walker in the arrays.
+	 * @return The actor, or nullptr if it could not be spawned.
+	 */
+	AEnemyCollisionPaperCharacter* Promote(int32 WalkerIndex);
+
+	/**
+	 * @brief Turns a promoted walker back into crowd data, walking the platform its actor stands on.
+	 *
+	 * @param WalkerIndex The index of the walker in the arrays.
+	 * @param ServerTime The server world time.
+	 * @return False if the actor does not stand on a platform long enough to walk.
+	 */
+	bool Demote(int32 WalkerIndex, double ServerTime);
+
+	/**
+	 * @brief Changes a walker's state and replicates it through its spawner.
+	 *
+	 * @param WalkerIndex The index of the walker in the arrays.
+	 * @param State The new state.
+	 */
+	void SetWalkerState(int32 WalkerIndex, EEnemyCrowdWalkerState State);
+
+	/**
+	 * @brief Gets the synchronized server world time.
+	 *
+	 * @return The server world time, or the local world time while the game state is not replicated yet.
+	 */
+	double GetServerTime() const;
+
+	/**
+	 * @brief The registered crowds.
+	 */
+	TArray<FEnemyCrowd> Crowds;
+
+	/**
+	 * @brief The walkers of every crowd, one entry per walker in each array.
+	 */
+	TArray<FEnemyCrowdWalker> Walks;
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> Facings;
+	TArray<float> Healths;
+	TArray<int32> WalkerCrowds;
+	TArray<TWeakObjectPtr<AEnemyCollisionPaperCharacter>> PromotedActors;
+
+	/**
+	 * @brief How close to touching a player or a projectile a walker has to come to be promoted.
+	 */
+	UPROPERTY(Config)
+	float PromotionDistance = 64.f;
+
+	/**
+	 * @brief How far from every player and projectile a promoted walker has to be to be demoted.
+	 */
+	UPROPERTY(Config)
+	float DemotionDistance = 768.f;
+
+	/**
+	 * @brief The most walkers promoted in one frame, so a player landing in a horde spreads the spawns out.
+	 */
+	UPROPERTY(Config)
+	int32 MaxPromotionsPerFrame = 8;
+};
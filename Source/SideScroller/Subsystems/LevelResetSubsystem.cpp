@@ -0,0 +1,175 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "LevelResetSubsystem.h"
+
+#include "GameFramework/Controller.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
+#include "TimerManager.h"
+
+/**
+ * Records the actor's initial transform, class, collision and visibility.
+ *
+ * @param Actor The resettable actor to register.
+ */
+void ULevelResetSubsystem::RegisterActor(AActor* Actor)
+{
+	if (Actor == nullptr || bIsResetting) return;
+	if (SnapshotIndices.Contains(Actor)) return;
+
+	FLevelActorSnapshot Snapshot;
+	Snapshot.Actor = Actor;
+	Snapshot.ActorClass = Actor->GetClass();
+	Snapshot.InitialTransform = Actor->GetActorTransform();
+	Snapshot.bInitialCollisionEnabled = Actor->GetActorEnableCollision();
+	Snapshot.bInitialHidden = Actor->IsHidden();
+
+	SnapshotIndices.Add(Actor, Snapshots.Add(Snapshot));
+}
+
+/**
+ * Deactivates a registered actor and keeps it around for the next reset.
+ *
+ * @param Actor The actor that would otherwise be destroyed.
+ * @return True if the actor was pooled.
+ */
+bool ULevelResetSubsystem::ReleaseToPool(AActor* Actor)
+{
+	if (Actor == nullptr) return false;
+
+	const int32* SnapshotIndex = SnapshotIndices.Find(Actor);
+	if (SnapshotIndex == nullptr) return false;
+
+	FLevelActorSnapshot& Snapshot = Snapshots[*SnapshotIndex];
+	if (!Snapshot.bPooled)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ULevelResetSubsystem::ReleaseToPool - Pooling %s."), *Actor->GetName());
+		DeactivateActor(Actor);
+		Snapshot.bPooled = true;
+	}
+	return true;
+}
+
+/**
+ * Restores every registered actor to its initial state.
+ */
+void ULevelResetSubsystem::ResetLevel()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return;
+
+	UE_LOG(LogTemp, Display,
+		TEXT("ULevelResetSubsystem::ResetLevel - Resetting %i actors in place."), Snapshots.Num()
+	);
+
+	TGuardValue<bool> ResettingGuard(bIsResetting, true);
+	const bool bIsClient = World->GetNetMode() == NM_Client;
+
+	for (int32 SnapshotIndex = 0; SnapshotIndex < Snapshots.Num(); ++SnapshotIndex)
+	{
+		FLevelActorSnapshot& Snapshot = Snapshots[SnapshotIndex];
+		AActor* Actor = Snapshot.Actor.Get();
+
+		if (Actor == nullptr || Actor->IsActorBeingDestroyed())
+		{
+			const AActor* ClassDefaults = Snapshot.ActorClass ? Snapshot.ActorClass->GetDefaultObject<AActor>() : nullptr;
+			if (ClassDefaults == nullptr || (bIsClient && ClassDefaults->GetIsReplicated())) continue;
+
+			// the actor was destroyed outside of the pool; put a fresh one in its place
+			Actor = World->SpawnActor<AActor>(Snapshot.ActorClass, Snapshot.InitialTransform);
+			if (Actor == nullptr)
+			{
+				UE_LOG(LogTemp, Warning,
+					TEXT("ULevelResetSubsystem::ResetLevel - Could not respawn a %s."), *Snapshot.ActorClass->GetName()
+				);
+				continue;
+			}
+			Snapshot.Actor = Actor;
+			SnapshotIndices.Add(Actor, SnapshotIndex);
+		}
+
+		World->GetTimerManager().ClearAllTimersForObject(Actor);
+		if (Snapshot.bPooled)
+		{
+			ActivateActor(Actor, Snapshot);
+			Snapshot.bPooled = false;
+		}
+
+		Actor->SetActorTransform(Snapshot.InitialTransform, false, nullptr, ETeleportType::ResetPhysics);
+		if (IResettableInterface* Resettable = Cast<IResettableInterface>(Actor))
+		{
+			Resettable->ResetToInitialState();
+		}
+	}
+
+	OnLevelReset.Broadcast();
+}
+
+/**
+ * Checks whether the given actor is waiting in the pool.
+ *
+ * @param Actor The actor to check.
+ * @return True if the actor is registered and pooled.
+ */
+bool ULevelResetSubsystem::IsPooled(const AActor* Actor) const
+{
+	const int32* SnapshotIndex = SnapshotIndices.Find(Actor);
+	return SnapshotIndex != nullptr && Snapshots[*SnapshotIndex].bPooled;
+}
+
+/**
+ * Hides the actor and stops everything that would keep it doing things while pooled.
+ *
+ * @param Actor The actor to deactivate.
+ */
+void ULevelResetSubsystem::DeactivateActor(AActor* Actor) const
+{
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(Actor);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	const APawn* Pawn = Cast<APawn>(Actor);
+	if (Pawn == nullptr) return;
+
+	if (UPawnMovementComponent* MovementComponent = Pawn->GetMovementComponent())
+	{
+		MovementComponent->StopMovementImmediately();
+		MovementComponent->SetComponentTickEnabled(false);
+	}
+
+	// the AI keeps steering and shooting through the controller, so park it as well
+	if (AController* Controller = Pawn->GetController())
+	{
+		GetWorld()->GetTimerManager().ClearAllTimersForObject(Controller);
+		Controller->StopMovement();
+		Controller->SetActorTickEnabled(false);
+	}
+}
+
+/**
+ * Shows the actor again, if it began play visible, and lets it collide, if it began play colliding, tick and move.
+ *
+ * @param Actor The actor to reactivate.
+ * @param Snapshot The recorded initial state of the actor.
+ */
+void ULevelResetSubsystem::ActivateActor(AActor* Actor, const FLevelActorSnapshot& Snapshot) const
+{
+	Actor->SetActorHiddenInGame(Snapshot.bInitialHidden);
+	Actor->SetActorEnableCollision(Snapshot.bInitialCollisionEnabled);
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+	const APawn* Pawn = Cast<APawn>(Actor);
+	if (Pawn == nullptr) return;
+
+	if (UPawnMovementComponent* MovementComponent = Pawn->GetMovementComponent())
+	{
+		MovementComponent->SetComponentTickEnabled(true);
+	}
+
+	if (AController* Controller = Pawn->GetController())
+	{
+		Controller->SetActorTickEnabled(Controller->PrimaryActorTick.bStartWithTickEnabled);
+	}
+}
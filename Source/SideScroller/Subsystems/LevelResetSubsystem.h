@@ -0,0 +1,154 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "LevelResetSubsystem.generated.h"
+
+/**
+ * @brief Broadcast after the level has been put back into its initial state.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnLevelReset);
+
+/**
+ * @struct FLevelActorSnapshot
+ * @brief The initial state of one resettable level actor, recorded when it began play.
+ */
+USTRUCT()
+struct FLevelActorSnapshot
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief The actor the snapshot belongs to. Becomes stale if the actor was destroyed for good.
+	 */
+	UPROPERTY()
+	TWeakObjectPtr<AActor> Actor;
+
+	/**
+	 * @brief The class of the actor, used to spawn a replacement if the actor no longer exists.
+	 */
+	UPROPERTY()
+	TSubclassOf<AActor> ActorClass;
+
+	/**
+	 * @brief The transform of the actor when it began play.
+	 */
+	UPROPERTY()
+	FTransform InitialTransform;
+
+	/**
+	 * @brief Whether the actor's collision was enabled when it began play.
+	 */
+	UPROPERTY()
+	bool bInitialCollisionEnabled = true;
+
+	/**
+	 * @brief Whether the actor was hidden in game when it began play.
+	 */
+	UPROPERTY()
+	bool bInitialHidden = false;
+
+	/**
+	 * @brief Whether the actor is currently deactivated and waiting in the pool.
+	 */
+	UPROPERTY()
+	bool bPooled = false;
+};
+
+/**
+ * @class ULevelResetSubsystem
+ * @brief Records the initial state of a level's actors and restores it in place.
+ *
+ * Enemies, pickups, interactables, moving platforms and checkpoints (everything implementing IResettableInterface)
+ * register here in BeginPlay. Instead of destroying themselves when they are killed, collected or used up they are
+ * released to the pool: hidden, made non-colliding and stopped, but kept in the world. ResetLevel then brings every
+ * registered actor back to its recorded transform, reactivates pooled actors and lets each of them restore its own
+ * state, so restarting a level takes a few frames instead of a ServerTravel that reloads the map.
+ *
+ * The subsystem exists on the server and on every client; ALevelGameState::MulticastResetLevel runs the reset
+ * everywhere.
+ */
+UCLASS()
+class SIDESCROLLER_API ULevelResetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Records the actor's current transform, class, collision and visibility as its initial state.
+	 *
+	 * Ignored for actors that are already registered and while a reset is running (replacements spawned by
+	 * ResetLevel are registered by the reset itself).
+	 *
+	 * @param Actor The resettable actor to register.
+	 */
+	void RegisterActor(AActor* Actor);
+
+	/**
+	 * @brief Deactivates a registered actor instead of destroying it.
+	 *
+	 * The actor is hidden, stops colliding, ticking and moving, and its timers are cleared. It stays in the pool
+	 * until the next ResetLevel reactivates it.
+	 *
+	 * @param Actor The actor that would otherwise be destroyed.
+	 * @return True if the actor was pooled, false if it is not registered and should be destroyed as usual.
+	 */
+	bool ReleaseToPool(AActor* Actor);
+
+	/**
+	 * @brief Puts every registered actor back into its initial state.
+	 *
+	 * Pooled actors are reactivated, every actor is moved back to its initial transform and ResetToInitialState is
+	 * called on it. Registered actors that were destroyed for good are respawned from their class (on clients only
+	 * if they do not replicate, since the server's replacement replicates to them).
+	 */
+	void ResetLevel();
+
+	/**
+	 * @brief Checks whether the given actor is currently waiting in the pool.
+	 *
+	 * @param Actor The actor to check.
+	 * @return True if the actor is registered and pooled.
+	 */
+	bool IsPooled(const AActor* Actor) const;
+
+	/**
+	 * @brief Delegate broadcast at the end of ResetLevel.
+	 */
+	FOnLevelReset OnLevelReset;
+
+private:
+	/**
+	 * @brief Hides the actor and stops it from colliding, ticking, moving and running timers.
+	 *
+	 * @param Actor The actor to deactivate.
+	 */
+	void DeactivateActor(AActor* Actor) const;
+
+	/**
+	 * @brief Undoes DeactivateActor, giving the actor back the collision and visibility it began play with.
+	 *
+	 * @param Actor The actor to reactivate.
+	 * @param Snapshot The recorded initial state of the actor.
+	 */
+	void ActivateActor(AActor* Actor, const FLevelActorSnapshot& Snapshot) const;
+
+	/**
+	 * @brief The snapshots of all registered actors.
+	 */
+	UPROPERTY()
+	TArray<FLevelActorSnapshot> Snapshots;
+
+	/**
+	 * @brief Maps registered actors to their index in Snapshots.
+	 */
+	TMap<TObjectKey<AActor>, int32> SnapshotIndices;
+
+	/**
+	 * @brief Whether ResetLevel is running.
+	 */
+	bool bIsResetting = false;
+};
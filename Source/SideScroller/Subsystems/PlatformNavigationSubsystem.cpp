@@ -0,0 +1,226 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PlatformNavigationSubsystem.h"
+
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+namespace PlatformNavigation
+{
+	/**
+	 * Gets the debug color of a link type.
+	 *
+	 * @param Type The link type.
+	 * @return Green for walking, yellow for jumping, orange for dropping and cyan for ladders.
+	 */
+	static FColor GetLinkColor(const EPlatformNavLinkType Type)
+	{
+		switch (Type)
+		{
+		case EPlatformNavLinkType::Jump:
+			return FColor::Yellow;
+		case EPlatformNavLinkType::Drop:
+			return FColor::Orange;
+		case EPlatformNavLinkType::Ladder:
+			return FColor::Cyan;
+		default:
+			return FColor::Green;
+		}
+	}
+
+	/**
+	 * Handles the "SideScroller.PlatformNav.Rebuild" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleRebuildCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UPlatformNavigationSubsystem* Navigation =
+			World ? World->GetSubsystem<UPlatformNavigationSubsystem>() : nullptr;
+		if (Navigation == nullptr) return;
+
+		Navigation->RebuildGraph();
+	}
+
+	/**
+	 * Handles the "SideScroller.PlatformNav.Draw [Seconds]" console command.
+	 *
+	 * @param Args The command arguments.
+	 * @param World The world the command was run in.
+	 */
+	static void HandleDrawCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		const UPlatformNavigationSubsystem* Navigation =
+			World ? World->GetSubsystem<UPlatformNavigationSubsystem>() : nullptr;
+		if (Navigation == nullptr) return;
+
+		Navigation->DrawGraph(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 10.f);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RebuildCommand(
+		TEXT("SideScroller.PlatformNav.Rebuild"),
+		TEXT("Bakes the platform navigation graph of the level again and clears the cached paths."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleRebuildCommand)
+	);
+
+	static FAutoConsoleCommandWithWorldAndArgs DrawCommand(
+		TEXT("SideScroller.PlatformNav.Draw"),
+		TEXT("Draws the platform navigation graph for the given number of seconds (10 by default): platforms in white, "
+			"walk links in green, jump links in yellow, drop links in orange and ladder links in cyan."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleDrawCommand)
+	);
+}
+
+/**
+ * Bakes the graph on the server and in standalone games, where the enemies' AI runs.
+ *
+ * @param InWorld The world that began play.
+ */
+void UPlatformNavigationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client) return;
+	this->RebuildGraph();
+}
+
+/**
+ * Bakes the graph with the configured settings and clears the cached paths, which refer to the old graph.
+ */
+void UPlatformNavigationSubsystem::RebuildGraph()
+{
+	FPlatformNavBuildSettings Settings;
+	Settings.ColumnWidth = this->ColumnWidth;
+	Settings.AgentHeight = this->AgentHeight;
+	Settings.MaxStepHeight = this->MaxStepHeight;
+	Settings.MaxJumpHeight = this->MaxJumpHeight;
+	Settings.MaxJumpDistance = this->MaxJumpDistance;
+	Settings.MaxDropHeight = this->MaxDropHeight;
+
+	this->PathCache.Reset();
+	this->Graph.Build(this->GetWorld(), Settings);
+}
+
+/**
+ * Finds the platform under a point.
+ *
+ * @param FeetLocation The point, usually the bottom of an agent's capsule.
+ * @return The index of the platform, or INDEX_NONE if there is none.
+ */
+int32 UPlatformNavigationSubsystem::FindNode(const FVector& FeetLocation) const
+{
+	return this->Graph.FindNode(FeetLocation);
+}
+
+/**
+ * Looks the path up in the cache, and searches the graph and caches the result if it is not there. StartX and GoalX
+ * are rounded down to PathCacheCellWidth in the key, so agents at nearly the same place share a search while one at
+ * the other end of a wide platform gets its own. Failed searches are cached too, so agents that cannot reach their
+ * target do not search every frame.
+ *
+ * @param StartNode The platform to start on.
+ * @param StartX Where on the start platform the agent is.
+ * @param GoalNode The platform to end on.
+ * @param GoalX Where on the goal platform the agent wants to go.
+ * @param Agent What the agent can do.
+ * @param OutLinks The indices of the links to take, in order.
+ * @return False if the goal cannot be reached.
+ */
+bool UPlatformNavigationSubsystem::FindPath(
+	const int32 StartNode,
+	const float StartX,
+	const int32 GoalNode,
+	const float GoalX,
+	const FPlatformNavAgent& Agent,
+	TArray<int32>& OutLinks
+) {
+	const float CellWidth = FMath::Max(this->PathCacheCellWidth, 1.f);
+	const TTuple<int32, int32, int32, int32, uint32> Key(
+		StartNode,
+		FMath::FloorToInt(StartX / CellWidth),
+		GoalNode,
+		FMath::FloorToInt(GoalX / CellWidth),
+		Agent.GetProfileHash()
+	);
+	if (const FPlatformNavCachedPath* CachedPath = this->PathCache.Find(Key))
+	{
+		OutLinks = CachedPath->Links;
+		return CachedPath->bFound;
+	}
+
+	if (this->PathCache.Num() >= this->MaxCachedPaths)
+	{
+		UE_LOG(LogTemp, Verbose,
+			TEXT("UPlatformNavigationSubsystem::FindPath - Clearing %i cached paths."), this->PathCache.Num()
+		);
+		this->PathCache.Reset();
+	}
+
+	FPlatformNavCachedPath& NewPath = this->PathCache.Add(Key);
+	NewPath.bFound = this->Graph.FindPath(StartNode, StartX, GoalNode, GoalX, Agent, NewPath.Links);
+	OutLinks = NewPath.Links;
+	return NewPath.bFound;
+}
+
+/**
+ * Gets a platform of the graph.
+ *
+ * @param NodeIndex The index of the platform.
+ * @return The platform, or nullptr if there is none with that index.
+ */
+const FPlatformNavNode* UPlatformNavigationSubsystem::GetNode(const int32 NodeIndex) const
+{
+	const TArray<FPlatformNavNode>& Nodes = this->Graph.GetNodes();
+	return Nodes.IsValidIndex(NodeIndex) ? &Nodes[NodeIndex] : nullptr;
+}
+
+/**
+ * Gets a link of the graph.
+ *
+ * @param LinkIndex The index of the link.
+ * @return The link, or nullptr if there is none with that index.
+ */
+const FPlatformNavLink* UPlatformNavigationSubsystem::GetLink(const int32 LinkIndex) const
+{
+	const TArray<FPlatformNavLink>& Links = this->Graph.GetLinks();
+	return Links.IsValidIndex(LinkIndex) ? &Links[LinkIndex] : nullptr;
+}
+
+/**
+ * Draws every platform as a white line along its floor and every link as an arrow from its take-off point to its
+ * landing point. The lines are drawn slightly in front of the plane the game is played in, towards the camera, so the
+ * level's sprites do not hide them.
+ *
+ * @param Duration How long the lines stay, in seconds.
+ */
+void UPlatformNavigationSubsystem::DrawGraph(const float Duration) const
+{
+	const UWorld* World = this->GetWorld();
+	if (World == nullptr) return;
+
+	if (this->Graph.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UPlatformNavigationSubsystem::DrawGraph - %s has no platform graph."),
+			*World->GetMapName()
+		);
+		return;
+	}
+
+	const float DrawY = this->Graph.GetPlaneY() - 10.f;
+	const TArray<FPlatformNavNode>& Nodes = this->Graph.GetNodes();
+	for (const FPlatformNavNode& Node : Nodes)
+	{
+		DrawDebugLine(World, FVector(Node.MinX, DrawY, Node.LeftZ), FVector(Node.MaxX, DrawY, Node.RightZ),
+			FColor::White, false, Duration, 0, 2.f
+		);
+	}
+
+	for (const FPlatformNavLink& Link : this->Graph.GetLinks())
+	{
+		const FVector From(Link.FromX, DrawY, Nodes[Link.FromNode].GetFloorZ(Link.FromX));
+		const FVector To(Link.ToX, DrawY, Nodes[Link.ToNode].GetFloorZ(Link.ToX));
+		DrawDebugDirectionalArrow(World, From, To, 8.f, GetLinkColor(Link.Type), false, Duration, 0, 1.f);
+	}
+}
@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SideScroller/Navigation/PlatformNavGraph.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlatformNavigationSubsystem.generated.h"
+
+/**
+ * @struct FPlatformNavCachedPath
+ * @brief A path search result kept for the agents that ask for it again.
+ */
+struct FPlatformNavCachedPath
+{
+	/**
+	 * @brief Whether the goal could be reached.
+	 */
+	bool bFound = false;
+
+	/**
+	 * @brief The indices of the links to take, in order.
+	 */
+	TArray<int32> Links;
+};
+
+/**
+ * @class UPlatformNavigationSubsystem
+ * @brief Owns the platform navigation graph of the level and the paths found on it.
+ *
+ * The server bakes the graph from the level's static collision when the level begins play (clients do not run the
+ * enemies' AI, so they skip it). Enemies then ask for paths from the platform they stand on to the platform their
+ * target stands on. Paths are cached by their start and goal platform, the stretch of PathCacheCellWidth on each the
+ * agent and its target are in, and the kind of agent asking, so every enemy chasing the same player across the same
+ * platforms shares one search, and an enemy only searches again when its target moves to another platform. The cache is
+ * cleared when it grows past MaxCachedPaths and when the graph is rebuilt.
+ *
+ * "SideScroller.PlatformNav.Rebuild" bakes the graph again, and "SideScroller.PlatformNav.Draw [Seconds]" draws it.
+ */
+UCLASS(Config = Game)
+class SIDESCROLLER_API UPlatformNavigationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Bakes the graph, unless this is a client.
+	 *
+	 * @param InWorld The world that began play.
+	 */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/**
+	 * @brief Bakes the graph from the world's current static collision and clears the cached paths.
+	 */
+	void RebuildGraph();
+
+	/**
+	 * @brief Finds the platform under a point.
+	 *
+	 * @param FeetLocation The point, usually the bottom of an agent's capsule.
+	 * @return The index of the platform, or INDEX_NONE if there is none.
+	 */
+	int32 FindNode(const FVector& FeetLocation) const;
+
+	/**
+	 * @brief Finds the links to take from one platform to another, reusing the cached path if there is one.
+	 *
+	 * A cached path was found for whatever X inside the same PathCacheCellWidth stretch of the start and goal platforms
+	 * it was first asked for, so it may be a little longer than the cheapest one for others, but it always gets the
+	 * agent there.
+	 *
+	 * @param StartNode The platform to start on.
+	 * @param StartX Where on the start platform the agent is.
+	 * @param GoalNode The platform to end on.
+	 * @param GoalX Where on the goal platform the agent wants to go.
+	 * @param Agent What the agent can do.
+	 * @param OutLinks The indices of the links to take, in order.
+	 * @return False if the goal cannot be reached.
+	 */
+	bool FindPath(
+		int32 StartNode,
+		float StartX,
+		int32 GoalNode,
+		float GoalX,
+		const FPlatformNavAgent& Agent,
+		TArray<int32>& OutLinks
+	);
+
+	/**
+	 * @brief Gets a platform of the graph.
+	 *
+	 * @param NodeIndex The index of the platform.
+	 * @return The platform, or nullptr if there is none with that index.
+	 */
+	const FPlatformNavNode* GetNode(int32 NodeIndex) const;
+
+	/**
+	 * @brief Gets a link of the graph.
+	 *
+	 * @param LinkIndex The index of the link.
+	 * @return The link, or nullptr if there is none with that index.
+	 */
+	const FPlatformNavLink* GetLink(int32 LinkIndex) const;
+
+	/**
+	 * @brief Checks whether the graph has been baked and has any platforms.
+	 *
+	 * @return True if agents can path on it.
+	 */
+	bool HasGraph() const { return !this->Graph.IsEmpty(); }
+
+	/**
+	 * @brief Draws the platforms and the links, colored by their type, in the world.
+	 *
+	 * @param Duration How long the lines stay, in seconds.
+	 */
+	void DrawGraph(float Duration) const;
+
+private:
+	/**
+	 * @brief The graph of the level.
+	 */
+	FPlatformNavGraph Graph;
+
+	/**
+	 * @brief The paths found so far, by start platform, start cell, goal platform, goal cell and agent profile hash.
+	 */
+	TMap<TTuple<int32, int32, int32, int32, uint32>, FPlatformNavCachedPath> PathCache;
+
+	/**
+	 * @brief The distance between the columns the level is sampled in.
+	 */
+	UPROPERTY(Config)
+	float ColumnWidth = 16.f;
+
+	/**
+	 * @brief The height of the free space an enemy needs to stand on a floor.
+	 */
+	UPROPERTY(Config)
+	float AgentHeight = 32.f;
+
+	/**
+	 * @brief The largest height difference between neighbouring columns that is walked rather than jumped.
+	 */
+	UPROPERTY(Config)
+	float MaxStepHeight = 12.f;
+
+	/**
+	 * @brief The highest and farthest jump links are made for; should cover the best jumper among the enemies.
+	 */
+	UPROPERTY(Config)
+	float MaxJumpHeight = 128.f;
+
+	UPROPERTY(Config)
+	float MaxJumpDistance = 256.f;
+
+	/**
+	 * @brief The deepest fall drop links are made for.
+	 */
+	UPROPERTY(Config)
+	float MaxDropHeight = 1024.f;
+
+	/**
+	 * @brief How many paths are cached before the cache is cleared.
+	 */
+	UPROPERTY(Config)
+	int32 MaxCachedPaths = 1024;
+
+	/**
+	 * @brief The width of the stretches StartX and GoalX are rounded to in the path cache key. Wide platforms with
+	 * links at both ends get a path per stretch, so an agent entering at the other end does not reuse a detour.
+	 */
+	UPROPERTY(Config)
+	float PathCacheCellWidth = 256.f;
+};
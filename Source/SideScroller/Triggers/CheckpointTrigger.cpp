@@ -3,16 +3,21 @@
 
 #include "CheckpointTrigger.h"
 
-#include "Kismet/GameplayStatics.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "SideScroller/GameModes/SideScrollerGameModeBase.h"
+#include "SideScroller/GameStates/SideScrollerGameState.h"
+#include "SideScroller/Diagnostics/TickCensus.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
+#include "SideScroller/Subsystems/LevelResetSubsystem.h"
 
 /**
  * Constructor for the ACheckpointTrigger class.
  */
 ACheckpointTrigger::ACheckpointTrigger()
 {
+	// only ticks while spinning; see SpinFlipbook
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	CheckpointFlipbook = CreateDefaultSubobject<UPaperFlipbookComponent>(TEXT("CheckpointPaperFlipbook"));
 	CheckpointFlipbook->SetupAttachment(RootComponent);
@@ -34,6 +39,7 @@ ACheckpointTrigger::ACheckpointTrigger()
  */
 void ACheckpointTrigger::Tick(float DeltaTime)
 {
+	TICK_CENSUS_SCOPE();
 	Super::Tick(DeltaTime);
 	
 	if (CheckpointFlipbook && this->bSpin)
@@ -51,7 +57,8 @@ void ACheckpointTrigger::Tick(float DeltaTime)
  * @brief Plays the beginning of the level.
  *
  * This method is called when the level begins. It initializes the checkpoint trigger
- * and sets up the necessary components and events for the trigger to function properly.
+ * and sets up the necessary components and events for the trigger to function properly, and registers the trigger
+ * with the ULevelResetSubsystem.
  */
 void ACheckpointTrigger::BeginPlay()
 {
@@ -60,19 +67,28 @@ void ACheckpointTrigger::BeginPlay()
 	if (!CheckpointFlipbook) return;
 	
 	this->CheckpointFlipbook->SetFlipbook(IdleCheckpoint);
+	this->InitialFlipbookRotation = this->CheckpointFlipbook->GetRelativeRotation();
 	
 	this->CheckpointBox->SetGenerateOverlapEvents(true);
 	this->CheckpointBox->OnComponentBeginOverlap.AddDynamic(this, &ACheckpointTrigger::OnBeginOverlapDelegate);
+
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>())
+	{
+		LevelReset->RegisterActor(this);
+	}
 }
 
 /**
  * Starts the spinning animation of the flipbook.
  *
+ * Tick is switched on here, for the duration of the spin only; the actor is destroyed when the spin ends.
+ *
  * @param SpinTime The duration in seconds for which the flipbook should spin.
  */
 void ACheckpointTrigger::SpinFlipbook()
 {
 	this->bSpin = true;
+	SetActorTickEnabled(true);
 	GetWorld()->GetTimerManager().SetTimer(
 		this->SpinTimerHandle,
 		this,
@@ -115,11 +131,49 @@ void ACheckpointTrigger::SetAllPlayersCheckpointLocations() const
 				);
 				return;	
 			}
-			CurrentPlayer->SetLastCheckpointLocation(this->CheckpointFlipbook->GetComponentLocation());
+			CurrentPlayer->SetLastCheckpointLocation(this->GetCheckpointLocation());
 		}
 	}
 }
 
+/**
+ * @brief Autosaves the progression of the locally controlled players at this checkpoint.
+ *
+ * Overlaps are handled on every machine, so each machine saves its own local players to its own profile. The
+ * actual write happens on a worker thread.
+ */
+void ACheckpointTrigger::AutosaveLocalPlayersProgression() const
+{
+	const ASideScrollerGameState* GameState = GetWorld()->GetGameState<ASideScrollerGameState>();
+	if (GameState == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ACheckpointTrigger::AutosaveLocalPlayersProgression - Not a SideScrollerGameState. Not autosaving.")
+		);
+		return;
+	}
+
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr || !PlayerController->IsLocalController()) continue;
+
+		const APC_PlayerFox* LocalPlayer = Cast<APC_PlayerFox>(PlayerController->GetPawn());
+		if (LocalPlayer == nullptr) continue;
+
+		LocalPlayer->AutosaveProgression(
+			GameState->GetCurrentLevel(),
+			true,
+			this->GetCheckpointLocation()
+		);
+	}
+}
+
+FVector ACheckpointTrigger::GetCheckpointLocation() const
+{
+	return this->CheckpointFlipbook->GetComponentLocation();
+}
+
 /**
  * @brief This method is called when an actor begins to overlap with the CheckpointTrigger.
  *
@@ -152,6 +206,7 @@ void ACheckpointTrigger::OnBeginOverlapDelegate(
 		UE_LOG(LogTemp, Display, TEXT("PC_PlayerFox, %s, overlapping CheckpointTrigger."), *Player->GetName());
 
 		SetAllPlayersCheckpointLocations();
+		AutosaveLocalPlayersProgression();
 	}
 }
 
@@ -164,10 +219,11 @@ void ACheckpointTrigger::CheckpointFeedback(UPrimitiveComponent* OverlappedCompo
 {
 	SpinFlipbook();
 	
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->CheckpointSound,
 		OverlappedComponent,
-		TEXT("BasePickupSound")
+		EAudioEventCategory::Level
 	);
 }
 
@@ -177,7 +233,33 @@ void ACheckpointTrigger::CheckpointFeedback(UPrimitiveComponent* OverlappedCompo
  */
 void ACheckpointTrigger::DestroyActor()
 {
+	GetWorld()->GetTimerManager().ClearTimer(this->SpinTimerHandle);
+
+	// keep the checkpoint around so the level can be reset in place
+	if (ULevelResetSubsystem* LevelReset = GetWorld()->GetSubsystem<ULevelResetSubsystem>();
+		LevelReset != nullptr && LevelReset->ReleaseToPool(this)
+	) {
+		UE_LOG(LogTemp, Display, TEXT("Pooling %s!"), *this->GetName());
+		return;
+	}
+
 	UE_LOG(LogTemp, Display, TEXT("Destroying %s!"), *this->GetName());
 	this->Destroy();
-	GetWorld()->GetTimerManager().ClearTimer(this->SpinTimerHandle);
+}
+
+/**
+ * @brief Makes the checkpoint available again.
+ *
+ * Tick stays off until the checkpoint is reached again, see SpinFlipbook.
+ */
+void ACheckpointTrigger::ResetToInitialState()
+{
+	this->bHasGivenFeedback = false;
+	this->bSpin = false;
+	SetActorTickEnabled(false);
+
+	if (!CheckpointFlipbook) return;
+
+	this->CheckpointFlipbook->SetFlipbook(IdleCheckpoint);
+	this->CheckpointFlipbook->SetRelativeRotation(this->InitialFlipbookRotation);
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "PaperFlipbookComponent.h"
 #include "Components/BoxComponent.h"
+#include "SideScroller/Interfaces/ResettableInterface.h"
 #include "CheckpointTrigger.generated.h"
 
 /**
@@ -14,9 +15,12 @@
  * ACheckpointTrigger is an actor class that triggers checkpoint functionality
  * when the player character overlaps with it. It allows the player to save their
  * progress in the game.
+ *
+ * A used checkpoint is released to the ULevelResetSubsystem's pool rather than destroyed, so it can be reached again
+ * after the level is reset in place.
  */
 UCLASS()
-class SIDESCROLLER_API ACheckpointTrigger : public AActor
+class SIDESCROLLER_API ACheckpointTrigger : public AActor, public IResettableInterface
 {
 	GENERATED_BODY()
 
@@ -35,6 +39,8 @@ public:
 	 * exists and the trigger is set to spin, it will rotate the flipbook based on the CheckPointSpinForce and the
 	 * DeltaTime.
 	 *
+	 * Ticking is disabled until the checkpoint is activated, so the trigger costs nothing while it waits.
+	 *
 	 * @param DeltaTime The time since the last frame.
 	 */
 	virtual void Tick(float DeltaTime) override;
@@ -97,10 +103,19 @@ public:
 	 *
 	 * This function is a blueprint callable function that destroys the actor
 	 * and clears the spin timer associated with it. It also logs a message to
-	 * the console indicating the destruction of the actor.
+	 * the console indicating the destruction of the actor. A checkpoint registered with the ULevelResetSubsystem is
+	 * pooled instead of destroyed.
 	 */
 	UFUNCTION(BlueprintCallable)
 	virtual void DestroyActor();
+
+	/**
+	 * @brief Makes the checkpoint available again when the level is reset in place.
+	 *
+	 * Stops the spin, puts the flipbook back to its idle animation and rotation, and lets the next overlap give
+	 * feedback and set the players' checkpoint again.
+	 */
+	virtual void ResetToInitialState() override;
 	
 private:
 	/**
@@ -135,6 +150,11 @@ private:
 	UPROPERTY(VisibleAnywhere, Category = Actor)
 	UPaperFlipbookComponent* CheckpointFlipbook;
 
+	/**
+	 * @brief The relative rotation of the flipbook before it was spun, restored by ResetToInitialState.
+	 */
+	FRotator InitialFlipbookRotation = FRotator::ZeroRotator;
+
 	/**
 	 * @brief Spins the flipbook.
 	 *
@@ -160,6 +180,20 @@ private:
 	UFUNCTION(BlueprintCallable, Category = Actor)
 	void SetAllPlayersCheckpointLocations() const;
 
+	/**
+	 * @brief Gets where players who reached this checkpoint respawn, the location of its CheckpointFlipbook.
+	 *
+	 * @return The checkpoint location.
+	 */
+	FVector GetCheckpointLocation() const;
+
+	/**
+	 * Autosave the progression of the locally controlled players at this checkpoint.
+	 *
+	 * @see APC_PlayerFox::AutosaveProgression
+	 */
+	void AutosaveLocalPlayersProgression() const;
+
 	/**
 	 * bool bSpin
 	 *
@@ -4,6 +4,7 @@
 #include "LevelCompleteTrigger.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "SideScroller/Controllers/GameModePlayerController.h"
+#include "SideScroller/GameModes/LevelGameMode.h"
 
 /**
  * Begins playing the level complete trigger.
@@ -45,6 +46,7 @@ void ALevelCompleteTrigger::NotifyActorBeginOverlap(AActor* OtherActor)
  *  - Checks if the given player's controller is an instance of AGameModePlayerController. If not, logs a warning
  *  message and returns.
  *  - Invokes the DoLevelCompleteServerRPC function on the player to show the level complete banner or celebration.
+ *  - On the server, makes sure the next level is being preloaded while the delay runs.
  *  - Binds the CallNextLevelStart function to the StartNextLevelDelayDelegate, with the given GameModePlayerController
  *  as a parameter.
  *  - Sets a timer to call the StartNextLevelDelayDelegate function after a specified delay.
@@ -65,6 +67,13 @@ void ALevelCompleteTrigger::PrepForNextLevel(APC_PlayerFox* Player)
 	// show level complete banner / celebration
 	Player->DoLevelCompleteServerRPC();
 
+	// make sure the next level is loading during the delay, in case no preload trigger was reached
+	ALevelGameMode* LevelGameMode = GetWorld()->GetAuthGameMode<ALevelGameMode>();
+	if (LevelGameMode != nullptr)
+	{
+		LevelGameMode->PreloadNextLevel();
+	}
+
 	StartNextLevelDelayDelegate.BindUFunction(
 		this,
 		FName("CallNextLevelStart"),
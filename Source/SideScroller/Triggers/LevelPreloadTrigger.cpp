@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "LevelPreloadTrigger.h"
+
+#include "SideScroller/Characters/Players/PC_PlayerFox.h"
+#include "SideScroller/GameModes/LevelGameMode.h"
+
+/**
+ * Notifies when an actor begins to overlap with the level preload trigger.
+ *
+ * @param OtherActor The actor that is overlapping with the level preload trigger.
+ */
+void ALevelPreloadTrigger::NotifyActorBeginOverlap(AActor* OtherActor)
+{
+	Super::NotifyActorBeginOverlap(OtherActor);
+
+	if (bHasTriggeredPreload || !HasAuthority()) return;
+
+	const APC_PlayerFox* Player = Cast<APC_PlayerFox>(OtherActor);
+	if (Player == nullptr) return;
+
+	ALevelGameMode* LevelGameMode = GetWorld()->GetAuthGameMode<ALevelGameMode>();
+	if (LevelGameMode == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("ALevelPreloadTrigger::NotifyActorBeginOverlap - GameMode is not a level. Not preloading.")
+		);
+		return;
+	}
+
+	UE_LOG(LogTemp, Display,
+		TEXT("ALevelPreloadTrigger::NotifyActorBeginOverlap - PC_PlayerFox, %s, reached preload point."),
+		*Player->GetName()
+	);
+
+	bHasTriggeredPreload = true;
+	LevelGameMode->PreloadNextLevel();
+}
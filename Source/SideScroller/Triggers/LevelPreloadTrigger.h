@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TriggerBox.h"
+#include "LevelPreloadTrigger.generated.h"
+
+/**
+ * @class ALevelPreloadTrigger
+ *
+ * @brief A trigger box that starts loading the next level in the background once a player walks through it.
+ *
+ * Place one of these somewhere a player passes well before the ALevelCompleteTrigger (e.g. the last stretch of the
+ * level). The first time a player overlaps it on the server, the level game mode is asked to preload the next
+ * level's map, so that the travel at the end of the level only has to swap worlds.
+ *
+ * @see ALevelGameMode::PreloadNextLevel
+ */
+UCLASS()
+class SIDESCROLLER_API ALevelPreloadTrigger : public ATriggerBox
+{
+	GENERATED_BODY()
+
+protected:
+	/**
+	 * Notifies when an actor begins to overlap with the preload trigger.
+	 *
+	 * If the actor is a PC_PlayerFox and this is the server, the next level preload is kicked off. The preload
+	 * only ever happens once per trigger.
+	 *
+	 * @param OtherActor The actor that is overlapping with the preload trigger.
+	 */
+	virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
+
+private:
+	/**
+	 * @brief Whether this trigger has already started the next level preload.
+	 */
+	UPROPERTY(VisibleAnywhere)
+	bool bHasTriggeredPreload = false;
+};
@@ -15,7 +15,7 @@
 APlatformTrigger::APlatformTrigger()
 {
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
 	TriggerVolume = CreateDefaultSubobject<UBoxComponent>(FName(TEXT("TriggerVolume")));
 	if (!TriggerVolume) return;
@@ -37,21 +37,6 @@ void APlatformTrigger::BeginPlay()
 	Super::BeginPlay();
 }
 
-/**
- * @brief Executes each frame during gameplay.
- *
- * This method is called every frame to update the state of the APlatformTrigger object. It inherits from the
- * Super class's Tick method, which executes the same method in the parent class. The APlatformTrigger::Tick
- * method takes a float parameter named DeltaTime, which represents the time in seconds since the last frame.
- *
- * @param DeltaTime The time elapsed in seconds since the last frame.
- */
-void APlatformTrigger::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
 /**
  * Function called when an overlap begins.
  *
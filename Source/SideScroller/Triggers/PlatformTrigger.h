@@ -24,7 +24,7 @@ public:
 	/**
 	 * @brief Constructs an instance of APlatformTrigger.
 	 *
-	 * This method initializes the APlatformTrigger object. It sets up the actor to call Tick() every frame and
+	 * This method initializes the APlatformTrigger object. It sets up the actor to never tick and
 	 * assigns a UBoxComponent to the TriggerVolume variable. It also sets TriggerVolume as the root component of
 	 * the actor. Additionally, it binds the OnComponentBeginOverlap and OnComponentEndOverlap events to the
 	 * APlatformTrigger::OnOverlapBegin and APlatformTrigger::OnOverlapEnd methods respectively.
@@ -55,20 +55,6 @@ protected:
 	 */
 	virtual void BeginPlay() override;
 
-public:
-	/**
-	 * @brief Tick function called every frame.
-	 * @param DeltaTime The time passed since the last frame.
-	 *
-	 * This function is called every frame to update the object's state.
-	 * It is a virtual function and can be overridden by derived classes to provide custom behavior.
-	 * The DeltaTime parameter represents the time passed since the last frame, allowing for time-based
-	 * calculations. In this specific implementation, the Super::Tick(DeltaTime) function is called to invoke
-	 * the base class's tick function. This ensures that any necessary base class functionality is also
-	 * executed during the tick operation.
-	 */
-	virtual void Tick(float DeltaTime) override;
-
 private:
 	/**
 	 * The TriggerVolume variable represents a UBoxComponent that is visible anywhere.
@@ -3,50 +3,74 @@
 
 #include "TeleportTrigger.h"
 
-#include "Kismet/GameplayStatics.h"
 #include "SideScroller/Characters/Players/PC_PlayerFox.h"
 #include "SideScroller/Interactables/Door.h"
+#include "SideScroller/Subsystems/AudioPoolSubsystem.h"
 
 /**
  * @brief Constructor for the ATeleportTrigger class.
  *
- * Sets the primary actor tick to be able to tick.
+ * The trigger never ticks; it waits for the source door's OnOpened event instead.
  */
 ATeleportTrigger::ATeleportTrigger()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 }
 
 /**
  * @brief Called when the game starts or when spawned.
  *
  * This method is called when the game starts or when the object is spawned into the world. It is responsible
- * for initializing any required variables and performing any necessary setup tasks.
+ * for initializing any required variables and performing any necessary setup tasks, including subscribing to the
+ * teleport source door's OnOpened event.
  */
 void ATeleportTrigger::BeginPlay()
 {
 	Super::BeginPlay();
 	GlobalTeleportTargetLocation = GetTransform().TransformPosition(TeleportTargetLocation);
+
+	if (TeleportSourceDoor != nullptr)
+	{
+		TeleportSourceDoor->OnOpened.AddUObject(this, &ATeleportTrigger::OnSourceDoorOpened);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ATeleportTrigger::BeginPlay - %s has no TeleportSourceDoor."), *GetName());
+	}
 }
 
 /**
- * Executes the Tick functionality of the ATeleportTrigger class.
+ * @brief Called when the actor is removed from the level.
  *
- * This method is called every frame and is responsible for checking if the player
- * is overlapping the teleport trigger and if the corresponding teleport source door is open.
- * If both conditions are met, the player is prepared for teleportation and the
- * bPlayerIsOverlappingTrigger flag is set to false.
+ * Stops listening to the teleport source door.
  *
- * @param DeltaTime The time in seconds it took to complete the last frame.
+ * @param EndPlayReason Why the actor is being removed.
  */
-void ATeleportTrigger::Tick(float DeltaTime)
+void ATeleportTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (TeleportSourceDoor != nullptr)
+	{
+		TeleportSourceDoor->OnOpened.RemoveAll(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
-	if (bPlayerIsOverlappingTrigger && TeleportSourceDoor->GetIsOpen() && OverlappingPlayer != nullptr)
+/**
+ * Handles the teleport source door opening.
+ *
+ * If a player is overlapping the trigger and waiting for the door, the player is prepared for teleportation and
+ * the bPlayerIsOverlappingTrigger flag is set to false.
+ *
+ * @param Door The door that opened.
+ */
+void ATeleportTrigger::OnSourceDoorOpened(ADoor* Door)
+{
+	if (bPlayerIsOverlappingTrigger && OverlappingPlayer != nullptr)
 	{
 		UE_LOG(LogTemp, Display,
-			TEXT("ATeleportTrigger::Tick - PC_PlayerFox, %s, overlapping TeleportTrigger and door is open. Teleporting"),
+			TEXT("ATeleportTrigger::OnSourceDoorOpened - PC_PlayerFox, %s, overlapping TeleportTrigger and door is "
+				"open. Teleporting"),
 			*OverlappingPlayer->GetPlayerName().ToString()
 		);
 		PrepForTeleport(OverlappingPlayer);
@@ -74,7 +98,9 @@ void ATeleportTrigger::NotifyActorBeginOverlap(AActor* OtherActor)
 
 	bPlayerIsOverlappingTrigger = true;
 	OverlappingPlayer = Player;
-	
+
+	if (TeleportSourceDoor == nullptr) return;
+
 	if (TeleportSourceDoor->GetIsOpen())
 	{
 		UE_LOG(LogTemp, Display,
@@ -88,7 +114,7 @@ void ATeleportTrigger::NotifyActorBeginOverlap(AActor* OtherActor)
 	{
 		UE_LOG(LogTemp, Display,
 			TEXT("ATeleportTrigger::NotifyActorBeginOverlap - Door, %s, is not open, not teleporting player, %s."
-				" Entering loop to check if door is open while player is still overlapping the TeleportTrigger"),
+				" Waiting for the door to open while player is still overlapping the TeleportTrigger"),
 			*TeleportSourceDoor->GetName(),
 			*Player->GetPlayerName().ToString()
 		);
@@ -135,10 +161,11 @@ void ATeleportTrigger::NotifyActorEndOverlap(AActor* OtherActor)
  */
 void ATeleportTrigger::PlayTeleportSound(const APC_PlayerFox* Player)
 {
-	UGameplayStatics::SpawnSoundAttached(
+	UAudioPoolSubsystem::PlayAttached(
+		this,
 		this->TeleportSound,
 		Player->GetSprite(),
-		TEXT("BasePaperCharacterPain")
+		EAudioEventCategory::Level
 	);
 }
 
@@ -33,6 +33,9 @@ class ADoor;
  * It also includes properties to set the target location, teleport delay timer, teleport source door,
  * global teleport target location, and teleport sound.
  *
+ * The trigger does not tick. A player who enters while the source door is closed is teleported when the door's
+ * OnOpened event fires.
+ *
  * To use this class, create an instance of it in the game level and set the desired properties.
  * Handle the Begin Play event to initialize any necessary logic. The Teleport method can be called
  * to execute the teleportation for a specific player character. The NotifyActorBeginOverlap method
@@ -95,15 +98,13 @@ public:
 	virtual void BeginPlay() override;
 
 	/**
-	 * Called every frame.
+	 * @brief Called when the actor is being removed from the level.
 	 *
-	 * This method is called every frame to update the Teleport Trigger.
-	 * If the player is overlapping the trigger, the door is open, and there is an overlapping player,
-	 * the method logs a message indicating that the player is teleporting and calls the PrepForTeleport method.
+	 * Unsubscribes from the teleport source door's events.
 	 *
-	 * @param DeltaTime The time in seconds since the last frame.
+	 * @param EndPlayReason Why the actor is being removed.
 	 */
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 private:
 	/**
@@ -225,6 +226,15 @@ private:
 	UFUNCTION(BlueprintCallable)
 	void PrepForTeleport(const APC_PlayerFox* Player);
 
+	/**
+	 * @brief Called when the teleport source door has opened.
+	 *
+	 * If a player is waiting in the trigger for the door to open, they are teleported.
+	 *
+	 * @param Door The door that opened.
+	 */
+	void OnSourceDoorOpened(ADoor* Door);
+
 protected:
 	/**
 	 * NotifyActorBeginOverlap method is called when an actor begins overlapping with this actor.
@@ -11,5 +11,6 @@ public class SideScrollerEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V2;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_1;
 		ExtraModuleNames.Add("SideScroller");
+		ExtraModuleNames.Add("SideScrollerEditor");
 	}
 }
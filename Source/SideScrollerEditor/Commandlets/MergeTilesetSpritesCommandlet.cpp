@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MergeTilesetSpritesCommandlet.h"
+
+#include "SideScrollerEditor/TilesetSpriteMerger.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+/**
+ * Parses the command line and merges every requested map.
+ *
+ * @param Params The command line parameters.
+ * @return 0 on success, 1 if any map failed.
+ */
+int32 UMergeTilesetSpritesCommandlet::Main(const FString& Params)
+{
+	FString MapsParam = TEXT("/Game/Maps/Map_Level1,/Game/Maps/Map_Level2,/Game/Maps/Map_Level3");
+	FParse::Value(*Params, TEXT("Maps="), MapsParam, false);
+
+	float RegionSize = 1024.f;
+	FParse::Value(*Params, TEXT("RegionSize="), RegionSize);
+	if (RegionSize <= 0.f)
+	{
+		UE_LOG(LogTemp, Error,
+			TEXT("UMergeTilesetSpritesCommandlet::Main - Invalid region size %f, expected a positive number."),
+			RegionSize
+		);
+		return 1;
+	}
+
+	const bool bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+
+	TArray<FString> MapPaths;
+	MapsParam.ParseIntoArray(MapPaths, TEXT(","));
+
+	bool bSuccess = true;
+	for (const FString& MapPath : MapPaths)
+	{
+		bSuccess &= MergeMap(MapPath.TrimStartAndEnd(), RegionSize, bDryRun);
+	}
+
+	return bSuccess ? 0 : 1;
+}
+
+/**
+ * Loads the map into an editor world, runs the merger on it and saves the package.
+ *
+ * @param MapPath The long package name of the map.
+ * @param RegionSize The edge length of the merge regions in world units.
+ * @param bDryRun When true the map is only analysed, not changed.
+ * @return True if the map was processed successfully.
+ */
+bool UMergeTilesetSpritesCommandlet::MergeMap(const FString& MapPath, const float RegionSize, const bool bDryRun)
+{
+	UPackage* Package = LoadPackage(nullptr, *MapPath, LOAD_None);
+	UWorld* World = Package != nullptr ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UMergeTilesetSpritesCommandlet::MergeMap - Can't load map %s."), *MapPath);
+		return false;
+	}
+
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.RequiresHitProxies(false)
+			.ShouldSimulatePhysics(false)
+			.EnableTraceCollision(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.AllowAudioPlayback(false)
+			.CreatePhysicsScene(true));
+	}
+	World->UpdateWorldComponents(true, false);
+
+	FTilesetSpriteMerger Merger;
+	Merger.RegionSize = RegionSize;
+	Merger.bDryRun = bDryRun;
+	const FTilesetSpriteMergeReport Report = Merger.Merge(World);
+	Report.Log(MapPath);
+
+	bool bSaved = true;
+	if (!bDryRun && Report.GroupsCreated > 0)
+	{
+		const FString Filename = FPackageName::LongPackageNameToFilename(
+			MapPath, FPackageName::GetMapPackageExtension()
+		);
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		bSaved = UPackage::SavePackage(Package, World, *Filename, SaveArgs);
+		if (!bSaved)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UMergeTilesetSpritesCommandlet::MergeMap - Failed to save %s."), *Filename);
+		}
+	}
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	return bSaved;
+}
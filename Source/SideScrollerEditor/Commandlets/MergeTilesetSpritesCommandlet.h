@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MergeTilesetSpritesCommandlet.generated.h"
+
+/**
+ * @class UMergeTilesetSpritesCommandlet
+ * @brief Merges the static tileset sprite actors of one or more maps into grouped sprite components.
+ *
+ * Runs FTilesetSpriteMerger over every given map, logs the proxy and body counts before and after, and saves the
+ * map unless -DryRun is passed.
+ *
+ * Usage:
+ * \code
+ * UnrealEditor-Cmd SideScroller.uproject -run=MergeTilesetSprites
+ *     -Maps=/Game/Maps/Map_Level1,/Game/Maps/Map_Level2 [-RegionSize=1024] [-DryRun]
+ * \endcode
+ *
+ * Without -Maps the three level maps are merged.
+ *
+ * @see FTilesetSpriteMerger
+ */
+UCLASS()
+class SIDESCROLLEREDITOR_API UMergeTilesetSpritesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Entry point of the commandlet.
+	 *
+	 * @param Params The command line parameters.
+	 * @return 0 on success, 1 if any map failed to load or save.
+	 */
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/**
+	 * Loads, merges and (unless dry running) saves a single map.
+	 *
+	 * @param MapPath The long package name of the map, e.g. /Game/Maps/Map_Level1.
+	 * @param RegionSize The edge length of the merge regions in world units.
+	 * @param bDryRun When true the map is only analysed, not changed.
+	 * @return True if the map was processed successfully.
+	 */
+	static bool MergeMap(const FString& MapPath, float RegionSize, bool bDryRun);
+};
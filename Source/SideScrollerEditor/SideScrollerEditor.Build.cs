@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class SideScrollerEditor : ModuleRules
+{
+	public SideScrollerEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core", "CoreUObject", "Engine", "Paper2D", "SideScroller"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "UnrealEd", "ToolMenus", "Slate", "SlateCore" });
+	}
+}
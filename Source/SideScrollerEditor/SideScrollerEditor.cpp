@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SideScrollerEditor.h"
+
+#include "Editor.h"
+#include "ScopedTransaction.h"
+#include "TilesetSpriteMerger.h"
+#include "ToolMenus.h"
+#include "Modules/ModuleManager.h"
+
+#define LOCTEXT_NAMESPACE "SideScrollerEditor"
+
+IMPLEMENT_MODULE(FSideScrollerEditorModule, SideScrollerEditor);
+
+/**
+ * Registers the merge console command and hooks the Tools menu entry up once the tool menus are ready.
+ */
+void FSideScrollerEditorModule::StartupModule()
+{
+	MergeTilesetSpritesCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SideScroller.MergeTilesetSprites"),
+		TEXT("Merges the static tileset sprite actors of the open level into grouped sprite components. "
+			"Usage: SideScroller.MergeTilesetSprites [RegionSize]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FSideScrollerEditorModule::MergeTilesetSpritesInEditorWorld),
+		ECVF_Default
+	);
+
+	UToolMenus::RegisterStartupCallback(
+		FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FSideScrollerEditorModule::RegisterMenus)
+	);
+}
+
+/**
+ * Unregisters the console command and the menu entries owned by this module.
+ */
+void FSideScrollerEditorModule::ShutdownModule()
+{
+	if (MergeTilesetSpritesCommand != nullptr)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(MergeTilesetSpritesCommand);
+		MergeTilesetSpritesCommand = nullptr;
+	}
+
+	UToolMenus::UnRegisterStartupCallback(this);
+	UToolMenus::UnregisterOwner(this);
+}
+
+/**
+ * Adds the merge action to the level editor's Tools menu.
+ */
+void FSideScrollerEditorModule::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(this);
+
+	UToolMenu* ToolsMenu = UToolMenus::Get()->ExtendMenu("LevelEditor.MainMenu.Tools");
+	FToolMenuSection& Section = ToolsMenu->FindOrAddSection("SideScroller");
+	Section.Label = LOCTEXT("SideScrollerSection", "SideScroller");
+	Section.AddMenuEntry(
+		"MergeTilesetSprites",
+		LOCTEXT("MergeTilesetSprites", "Merge Tileset Sprites"),
+		LOCTEXT("MergeTilesetSpritesTooltip",
+			"Merges the static tileset sprite actors of this level into grouped sprite components per region, "
+			"with merged collision."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateLambda([]()
+		{
+			MergeTilesetSpritesInEditorWorld(TArray<FString>());
+		}))
+	);
+}
+
+/**
+ * Runs the tileset sprite merge on the editor world inside an undoable transaction.
+ *
+ * @param Args Optional console arguments; the first one, if given, is the region size in world units.
+ */
+void FSideScrollerEditorModule::MergeTilesetSpritesInEditorWorld(const TArray<FString>& Args)
+{
+	if (GEditor == nullptr) return;
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	if (World == nullptr)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("FSideScrollerEditorModule::MergeTilesetSpritesInEditorWorld - No editor world to merge.")
+		);
+		return;
+	}
+
+	FTilesetSpriteMerger Merger;
+	if (Args.Num() > 0)
+	{
+		// Atof quietly reads a typo as 0, which would make the merge silently do nothing
+		const float RegionSize = FCString::IsNumeric(*Args[0]) ? FCString::Atof(*Args[0]) : 0.f;
+		if (RegionSize <= 0.f)
+		{
+			UE_LOG(LogTemp, Error,
+				TEXT("FSideScrollerEditorModule::MergeTilesetSpritesInEditorWorld - Invalid region size '%s', "
+					"expected a positive number of world units."),
+				*Args[0]
+			);
+			return;
+		}
+		Merger.RegionSize = RegionSize;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("MergeTilesetSpritesTransaction", "Merge Tileset Sprites"));
+	const FTilesetSpriteMergeReport Report = Merger.Merge(World);
+	Report.Log(World->GetMapName());
+
+	GEditor->RedrawLevelEditingViewports();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleInterface.h"
+
+/**
+ * @class FSideScrollerEditorModule
+ * @brief Editor-only module for SideScroller level tooling.
+ *
+ * Registers the in-editor actions (console command and Tools menu entry) for merging static tileset sprites into
+ * grouped sprite components.
+ *
+ * @see FTilesetSpriteMerger
+ * @see UMergeTilesetSpritesCommandlet
+ */
+class FSideScrollerEditorModule : public IModuleInterface
+{
+public:
+	/**
+	 * Registers the merge console command and the Tools menu entry.
+	 */
+	virtual void StartupModule() override;
+
+	/**
+	 * Unregisters everything registered in StartupModule.
+	 */
+	virtual void ShutdownModule() override;
+
+private:
+	/**
+	 * Adds the "Merge Tileset Sprites" entry to the level editor's Tools menu.
+	 */
+	void RegisterMenus();
+
+	/**
+	 * Merges the tileset sprites of the level currently open in the editor.
+	 *
+	 * @param Args Optional console arguments; the first one, if given, is the region size in world units.
+	 */
+	static void MergeTilesetSpritesInEditorWorld(const TArray<FString>& Args);
+
+	/**
+	 * @brief The registered "SideScroller.MergeTilesetSprites" console command, kept so it can be unregistered.
+	 */
+	IConsoleObject* MergeTilesetSpritesCommand = nullptr;
+};
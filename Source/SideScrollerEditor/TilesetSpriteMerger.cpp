@@ -0,0 +1,397 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TilesetSpriteMerger.h"
+
+#include "EngineUtils.h"
+#include "PaperGroupedSpriteActor.h"
+#include "PaperGroupedSpriteComponent.h"
+#include "PaperSprite.h"
+#include "PaperSpriteActor.h"
+#include "PaperSpriteComponent.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "PhysicsEngine/BodySetup.h"
+
+/**
+ * @brief Tolerance, in world units, used when deciding whether two collision boxes line up or touch.
+ */
+static constexpr double BoxMergeTolerance = 0.1;
+
+/**
+ * Checks whether a rotation only turns the axes onto each other, in steps of 90 degrees, so that a box rotated by it
+ * is still an axis aligned box of the same size.
+ *
+ * @param Rotation The rotation to check.
+ * @return True if every rotated axis lies along a world axis.
+ */
+static bool IsAxisAligned(const FQuat& Rotation)
+{
+	for (const FVector& Axis : {Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ()})
+	{
+		if (Axis.GetAbsMax() < 1.0 - KINDA_SMALL_NUMBER) return false;
+	}
+	return true;
+}
+
+/**
+ * @struct FTilesetSpriteCollision
+ * @brief The collision settings of a tileset sprite: its profile and whatever the level designer overrode on top.
+ */
+struct FTilesetSpriteCollision
+{
+	FName Profile = UCollisionProfile::NoCollision_ProfileName;
+	ECollisionEnabled::Type Enabled = ECollisionEnabled::NoCollision;
+	ECollisionChannel ObjectType = ECC_WorldStatic;
+	FCollisionResponseContainer Responses;
+
+	/**
+	 * Reads the collision settings of the component.
+	 *
+	 * @param Component The component to read.
+	 * @return The settings.
+	 */
+	static FTilesetSpriteCollision FromComponent(const UPrimitiveComponent* Component)
+	{
+		FTilesetSpriteCollision Collision;
+		Collision.Profile = Component->GetCollisionProfileName();
+		Collision.Enabled = Component->GetCollisionEnabled();
+		Collision.ObjectType = Component->GetCollisionObjectType();
+		Collision.Responses = Component->GetCollisionResponseToChannels();
+		return Collision;
+	}
+
+	/**
+	 * Gives the component these collision settings.
+	 *
+	 * @param Component The component to set up.
+	 */
+	void ApplyTo(UPrimitiveComponent* Component) const
+	{
+		Component->SetCollisionProfileName(Profile);
+		Component->SetCollisionEnabled(Enabled);
+		Component->SetCollisionObjectType(ObjectType);
+		Component->SetCollisionResponseToChannels(Responses);
+	}
+
+	bool operator==(const FTilesetSpriteCollision& Other) const
+	{
+		return Profile == Other.Profile
+			&& Enabled == Other.Enabled
+			&& ObjectType == Other.ObjectType
+			&& Responses == Other.Responses;
+	}
+
+	friend uint32 GetTypeHash(const FTilesetSpriteCollision& Collision)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Collision.Profile), GetTypeHash(static_cast<uint8>(Collision.Enabled)));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Collision.ObjectType)));
+		return HashCombine(Hash, FCrc::MemCrc32(Collision.Responses.EnumArray, sizeof(Collision.Responses.EnumArray)));
+	}
+};
+
+/**
+ * @struct FTilesetSpriteBucketKey
+ * @brief Identifies the group a tileset sprite actor is merged into.
+ *
+ * Sprites are grouped by X/Z region, by depth (so the draw order of background and foreground layers is kept) and
+ * by their full collision settings, per channel overrides included (so the merged collision behaves like the tiles
+ * did).
+ */
+struct FTilesetSpriteBucketKey
+{
+	FIntVector Cell;
+	FTilesetSpriteCollision Collision;
+
+	bool operator==(const FTilesetSpriteBucketKey& Other) const
+	{
+		return Cell == Other.Cell && Collision == Other.Collision;
+	}
+
+	friend uint32 GetTypeHash(const FTilesetSpriteBucketKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.Collision));
+	}
+};
+
+/**
+ * @struct FTilesetSpriteBucket
+ * @brief The sprite actors of one group and the world space collision boxes collected from them.
+ */
+struct FTilesetSpriteBucket
+{
+	TArray<APaperSpriteActor*> SpriteActors;
+	TArray<FBox> CollisionBoxes;
+};
+
+/**
+ * Writes the merge report to the log.
+ *
+ * @param MapName The name of the merged map.
+ */
+void FTilesetSpriteMergeReport::Log(const FString& MapName) const
+{
+	UE_LOG(LogTemp, Display,
+		TEXT("FTilesetSpriteMerger - %s: merged %i sprite actors into %i groups (%i skipped)."),
+		*MapName, MergedSprites, GroupsCreated, SkippedSprites
+	);
+	UE_LOG(LogTemp, Display,
+		TEXT("FTilesetSpriteMerger - %s: scene proxies %i -> %i, collision bodies %i -> %i."),
+		*MapName, ProxiesBefore, ProxiesAfter, BodiesBefore, BodiesAfter
+	);
+}
+
+/**
+ * Buckets the world's tileset sprite actors, replaces each bucket with a grouped sprite actor with merged box
+ * collision, and removes the original actors.
+ *
+ * @param World The world to merge.
+ * @return The merge report.
+ */
+FTilesetSpriteMergeReport FTilesetSpriteMerger::Merge(UWorld* World) const
+{
+	FTilesetSpriteMergeReport Report;
+	if (World == nullptr || RegionSize <= 0.f) return Report;
+
+	CountProxiesAndBodies(World, Report.ProxiesBefore, Report.BodiesBefore);
+
+	TMap<FTilesetSpriteBucketKey, FTilesetSpriteBucket> Buckets;
+	for (TActorIterator<APaperSpriteActor> It(World); It; ++It)
+	{
+		APaperSpriteActor* SpriteActor = *It;
+		if (!IsMergeCandidate(SpriteActor)) continue;
+
+		UPaperSpriteComponent* SpriteComponent = SpriteActor->GetRenderComponent();
+		const UBodySetup* BodySetup = SpriteComponent->GetBodySetup();
+		const bool bHasCollision = SpriteComponent->IsCollisionEnabled()
+			&& BodySetup != nullptr
+			&& BodySetup->AggGeom.GetElementCount() > 0;
+
+		// only single, unrotated boxes can be folded into the merged collision without changing its shape, and only
+		// on components turned in steps of 90 degrees, or their world bounds would be bigger than the box
+		FBox CollisionBox(ForceInit);
+		if (bHasCollision)
+		{
+			const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+			if (AggGeom.GetElementCount() != 1 || AggGeom.BoxElems.Num() != 1
+				|| !AggGeom.BoxElems[0].Rotation.IsNearlyZero())
+			{
+				++Report.SkippedSprites;
+				continue;
+			}
+			if (!IsAxisAligned(SpriteComponent->GetComponentQuat()))
+			{
+				UE_LOG(LogTemp, Warning,
+					TEXT("FTilesetSpriteMerger::Merge - %s is not rotated in steps of 90 degrees (%s). Skipping it."),
+					*SpriteActor->GetName(), *SpriteComponent->GetComponentRotation().ToString()
+				);
+				++Report.SkippedSprites;
+				continue;
+			}
+
+			const FKBoxElem& BoxElem = AggGeom.BoxElems[0];
+			const FVector HalfExtent(BoxElem.X * 0.5f, BoxElem.Y * 0.5f, BoxElem.Z * 0.5f);
+			CollisionBox = FBox(BoxElem.Center - HalfExtent, BoxElem.Center + HalfExtent)
+				.TransformBy(SpriteComponent->GetComponentTransform());
+		}
+
+		const FVector Location = SpriteActor->GetActorLocation();
+		const FTilesetSpriteBucketKey Key{
+			FIntVector(
+				FMath::FloorToInt(Location.X / RegionSize),
+				FMath::RoundToInt(Location.Y),
+				FMath::FloorToInt(Location.Z / RegionSize)
+			),
+			bHasCollision ? FTilesetSpriteCollision::FromComponent(SpriteComponent) : FTilesetSpriteCollision()
+		};
+
+		FTilesetSpriteBucket& Bucket = Buckets.FindOrAdd(Key);
+		Bucket.SpriteActors.Add(SpriteActor);
+		if (bHasCollision)
+		{
+			Bucket.CollisionBoxes.Add(CollisionBox);
+		}
+	}
+
+	for (TPair<FTilesetSpriteBucketKey, FTilesetSpriteBucket>& Pair : Buckets)
+	{
+		FTilesetSpriteBucket& Bucket = Pair.Value;
+
+		// a lone sprite gains nothing from being grouped
+		if (Bucket.SpriteActors.Num() < 2)
+		{
+			Report.SkippedSprites += Bucket.SpriteActors.Num();
+			continue;
+		}
+
+		Report.MergedSprites += Bucket.SpriteActors.Num();
+		++Report.GroupsCreated;
+		if (bDryRun) continue;
+
+		const FVector GroupLocation(
+			(Pair.Key.Cell.X + 0.5f) * RegionSize,
+			Pair.Key.Cell.Y,
+			(Pair.Key.Cell.Z + 0.5f) * RegionSize
+		);
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags = RF_Transactional;
+		APaperGroupedSpriteActor* GroupActor = World->SpawnActor<APaperGroupedSpriteActor>(
+			GroupLocation, FRotator::ZeroRotator, SpawnParameters
+		);
+		if (GroupActor == nullptr)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FTilesetSpriteMerger::Merge - Failed to spawn a grouped sprite actor."));
+			continue;
+		}
+
+		GroupActor->SetActorLabel(FString::Printf(
+			TEXT("MergedTileset_%i_%i_%i"), Pair.Key.Cell.X, Pair.Key.Cell.Y, Pair.Key.Cell.Z
+		));
+		GroupActor->SetFolderPath(TEXT("MergedTilesets"));
+
+		// rendering only; collision comes from the merged boxes below
+		UPaperGroupedSpriteComponent* GroupComponent = GroupActor->GetRenderComponent();
+		GroupComponent->Modify();
+		GroupComponent->SetMobility(EComponentMobility::Static);
+		GroupComponent->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+
+		for (APaperSpriteActor* SpriteActor : Bucket.SpriteActors)
+		{
+			const UPaperSpriteComponent* SpriteComponent = SpriteActor->GetRenderComponent();
+			GroupComponent->AddInstance(
+				SpriteComponent->GetComponentTransform(),
+				SpriteComponent->GetSprite(),
+				true,
+				SpriteComponent->GetSpriteColor()
+			);
+			World->EditorDestroyActor(SpriteActor, true);
+		}
+
+		// fold touching tiles into runs, then stack equal runs, so solid ground ends up as a few large boxes
+		MergeBoxesAlongAxis(Bucket.CollisionBoxes, 0);
+		MergeBoxesAlongAxis(Bucket.CollisionBoxes, 2);
+
+		for (const FBox& Box : Bucket.CollisionBoxes)
+		{
+			UBoxComponent* BoxComponent = NewObject<UBoxComponent>(GroupActor, NAME_None, RF_Transactional);
+			BoxComponent->SetMobility(EComponentMobility::Static);
+			BoxComponent->SetupAttachment(GroupComponent);
+			BoxComponent->SetRelativeLocation(Box.GetCenter() - GroupLocation);
+			BoxComponent->SetBoxExtent(Box.GetExtent(), false);
+			Pair.Key.Collision.ApplyTo(BoxComponent);
+			GroupActor->AddInstanceComponent(BoxComponent);
+			BoxComponent->RegisterComponent();
+		}
+	}
+
+	CountProxiesAndBodies(World, Report.ProxiesAfter, Report.BodiesAfter);
+	return Report;
+}
+
+/**
+ * Checks whether the actor is a plain, static sprite actor showing a tileset sprite.
+ *
+ * @param SpriteActor The actor to check.
+ * @return True if the actor can be merged.
+ */
+bool FTilesetSpriteMerger::IsMergeCandidate(const APaperSpriteActor* SpriteActor) const
+{
+	// subclasses (moving platforms, interactables, ...) have behaviour of their own and must stay separate actors
+	if (SpriteActor == nullptr || SpriteActor->GetClass() != APaperSpriteActor::StaticClass()) return false;
+
+	const UPaperSpriteComponent* SpriteComponent = SpriteActor->GetRenderComponent();
+	if (SpriteComponent == nullptr || SpriteComponent->Mobility != EComponentMobility::Static) return false;
+
+	const UPaperSprite* Sprite = SpriteComponent->GetSprite();
+	return Sprite != nullptr && Sprite->GetPathName().Contains(SpritePathFilter);
+}
+
+/**
+ * Counts the in-game scene proxies and collision bodies of the world.
+ *
+ * @param World The world to count.
+ * @param OutProxies Receives the number of primitive components that render in game.
+ * @param OutBodies Receives the number of collision bodies.
+ */
+void FTilesetSpriteMerger::CountProxiesAndBodies(UWorld* World, int32& OutProxies, int32& OutBodies)
+{
+	OutProxies = 0;
+	OutBodies = 0;
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		It->ForEachComponent<UPrimitiveComponent>(false, [&OutProxies, &OutBodies](const UPrimitiveComponent* Component)
+		{
+			if (!Component->IsRegistered()) return;
+
+			if (Component->IsVisible() && !Component->bHiddenInGame)
+			{
+				++OutProxies;
+			}
+
+			if (Component->IsCollisionEnabled())
+			{
+				const UPaperGroupedSpriteComponent* GroupComponent = Cast<UPaperGroupedSpriteComponent>(Component);
+				OutBodies += GroupComponent != nullptr ? GroupComponent->GetInstanceCount() : 1;
+			}
+		});
+	}
+}
+
+/**
+ * Merges boxes that touch along the given axis and share their extents on the other two.
+ *
+ * @param Boxes The boxes to merge in place.
+ * @param Axis The axis to merge along (0 = X, 1 = Y, 2 = Z).
+ */
+void FTilesetSpriteMerger::MergeBoxesAlongAxis(TArray<FBox>& Boxes, const int32 Axis)
+{
+	if (Boxes.Num() < 2) return;
+
+	const int32 AxisA = (Axis + 1) % 3;
+	const int32 AxisB = (Axis + 2) % 3;
+
+	auto SharesCrossSection = [AxisA, AxisB](const FBox& A, const FBox& B)
+	{
+		return FMath::IsNearlyEqual(A.Min[AxisA], B.Min[AxisA], BoxMergeTolerance)
+			&& FMath::IsNearlyEqual(A.Max[AxisA], B.Max[AxisA], BoxMergeTolerance)
+			&& FMath::IsNearlyEqual(A.Min[AxisB], B.Min[AxisB], BoxMergeTolerance)
+			&& FMath::IsNearlyEqual(A.Max[AxisB], B.Max[AxisB], BoxMergeTolerance);
+	};
+
+	// snap to the tolerance grid for sorting; comparing with a tolerance is not transitive and breaks the sort order
+	auto Quantize = [](const double Value)
+	{
+		return FMath::RoundToInt64(Value / BoxMergeTolerance);
+	};
+
+	// sort so that boxes with the same cross section are next to each other, in order along the merge axis
+	Boxes.Sort([Axis, AxisA, AxisB, &Quantize](const FBox& A, const FBox& B)
+	{
+		for (const int32 Index : {AxisA, AxisB})
+		{
+			if (Quantize(A.Min[Index]) != Quantize(B.Min[Index])) return A.Min[Index] < B.Min[Index];
+			if (Quantize(A.Max[Index]) != Quantize(B.Max[Index])) return A.Max[Index] < B.Max[Index];
+		}
+		return A.Min[Axis] < B.Min[Axis];
+	});
+
+	TArray<FBox> Merged;
+	Merged.Reserve(Boxes.Num());
+	Merged.Add(Boxes[0]);
+	for (int32 Index = 1; Index < Boxes.Num(); ++Index)
+	{
+		FBox& Last = Merged.Last();
+		const FBox& Box = Boxes[Index];
+		if (SharesCrossSection(Last, Box) && Box.Min[Axis] <= Last.Max[Axis] + BoxMergeTolerance)
+		{
+			Last.Max[Axis] = FMath::Max(Last.Max[Axis], Box.Max[Axis]);
+		}
+		else
+		{
+			Merged.Add(Box);
+		}
+	}
+
+	Boxes = MoveTemp(Merged);
+}
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APaperSpriteActor;
+
+/**
+ * @struct FTilesetSpriteMergeReport
+ * @brief What a tileset sprite merge did to a world.
+ *
+ * Proxy and body counts are taken over the whole world, before and after the merge, so the effect on render-thread
+ * and physics cost can be read straight off the log.
+ */
+struct SIDESCROLLEREDITOR_API FTilesetSpriteMergeReport
+{
+	/** Primitive components that create a scene proxy in game, before the merge. */
+	int32 ProxiesBefore = 0;
+
+	/** Primitive components that create a scene proxy in game, after the merge. */
+	int32 ProxiesAfter = 0;
+
+	/** Collision bodies (grouped sprite instances count one each), before the merge. */
+	int32 BodiesBefore = 0;
+
+	/** Collision bodies (grouped sprite instances count one each), after the merge. */
+	int32 BodiesAfter = 0;
+
+	/** Tileset sprite actors that were folded into a grouped sprite actor and removed. */
+	int32 MergedSprites = 0;
+
+	/** Tileset sprite actors left alone, e.g. because their collision is not a single axis aligned box. */
+	int32 SkippedSprites = 0;
+
+	/** Grouped sprite actors created by the merge. */
+	int32 GroupsCreated = 0;
+
+	/**
+	 * Writes the report to the log.
+	 *
+	 * @param MapName The name of the merged map, used to tell reports apart.
+	 */
+	void Log(const FString& MapName) const;
+};
+
+/**
+ * @class FTilesetSpriteMerger
+ * @brief Merges static tileset sprite actors into grouped sprite components.
+ *
+ * Levels are painted out of many single APaperSpriteActors using the extracted SunnyLand tileset sprites, each with
+ * its own scene proxy and collision body. The merger buckets those actors by region (and depth and collision
+ * profile), replaces every bucket with one APaperGroupedSpriteActor holding the sprites as instances, and rebuilds
+ * their collision as a handful of merged box components instead of one body per tile.
+ *
+ * Only exact APaperSpriteActors with static mobility and a tileset sprite are touched; anything derived from it
+ * (moving platforms, interactables) keeps its own actor.
+ *
+ * @see UMergeTilesetSpritesCommandlet
+ * @see FSideScrollerEditorModule
+ */
+class SIDESCROLLEREDITOR_API FTilesetSpriteMerger
+{
+public:
+	/**
+	 * @brief Edge length, in world units, of the square X/Z regions whose sprites are merged together.
+	 *
+	 * Smaller regions cull better; larger regions save more proxies.
+	 */
+	float RegionSize = 1024.f;
+
+	/**
+	 * @brief Only sprites whose asset path contains this string are considered tileset sprites.
+	 */
+	FString SpritePathFilter = TEXT("ExtractedSprites/tileset_Sprite_");
+
+	/**
+	 * @brief When true, only counts what would be merged without changing the world.
+	 */
+	bool bDryRun = false;
+
+	/**
+	 * Merges the tileset sprite actors of the given world.
+	 *
+	 * @param World The world to merge. Must be an editor world.
+	 * @return A report of what was merged, including proxy and body counts before and after.
+	 */
+	FTilesetSpriteMergeReport Merge(UWorld* World) const;
+
+private:
+	/**
+	 * Checks whether the actor is a plain, static sprite actor showing a tileset sprite.
+	 *
+	 * @param SpriteActor The actor to check.
+	 * @return True if the actor can be merged.
+	 */
+	bool IsMergeCandidate(const APaperSpriteActor* SpriteActor) const;
+
+	/**
+	 * Counts the in-game scene proxies and collision bodies of the world.
+	 *
+	 * @param World The world to count.
+	 * @param OutProxies Receives the number of primitive components that render in game.
+	 * @param OutBodies Receives the number of collision bodies.
+	 */
+	static void CountProxiesAndBodies(UWorld* World, int32& OutProxies, int32& OutBodies);
+
+	/**
+	 * Merges boxes that touch along the given axis and share their extents on the other two.
+	 *
+	 * @param Boxes The boxes to merge in place.
+	 * @param Axis The axis to merge along (0 = X, 1 = Y, 2 = Z).
+	 */
+	static void MergeBoxesAlongAxis(TArray<FBox>& Boxes, int32 Axis);
+};